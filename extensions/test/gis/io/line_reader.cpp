@@ -0,0 +1,208 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+#include <boost/geometry/extensions/gis/io/line_reader.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/utility.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/write_wkb.hpp>
+
+
+template <typename Geometry>
+std::vector<Geometry> make_geometries(std::size_t count)
+{
+    std::vector<Geometry> result;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const x = double(i);
+        std::ostringstream out;
+        out << "LINESTRING(" << x << " 0," << x + 0.5 << " 1";
+        // Some lines are longer than the smallest chunks
+        for (std::size_t j = 0; j < i % 13; j++)
+        {
+            out << "," << x + 0.25 << " " << (j + 2);
+        }
+        out << ")";
+        result.push_back(bg::from_wkt<Geometry>(out.str()));
+    }
+    return result;
+}
+
+template <typename Geometry>
+std::string wkt_lines(std::vector<Geometry> const& geometries)
+{
+    std::string result;
+    for (std::size_t i = 0; i < geometries.size(); i++)
+    {
+        bg::write_wkt(geometries[i], result);
+        // Windows line ends and empty lines
+        result += i % 5 == 0 ? "\r\n" : i % 7 == 0 ? "\n\n" : "\n";
+    }
+    return result;
+}
+
+template <typename Geometry>
+std::string wkb_lines(std::vector<Geometry> const& geometries)
+{
+    std::string result;
+    for (Geometry const& geometry : geometries)
+    {
+        std::vector<boost::uint8_t> wkb;
+        bg::write_wkb(geometry, std::back_inserter(wkb));
+        std::string hex;
+        bg::wkb2hex(wkb.begin(), wkb.end(), hex);
+        result += hex;
+        result += "\n";
+    }
+    return result;
+}
+
+template <typename Geometry>
+bool first_x_less(Geometry const& g1, Geometry const& g2)
+{
+    return bg::get<0>(g1.front()) < bg::get<0>(g2.front());
+}
+
+template <typename Reader, typename Geometry>
+std::vector<Geometry> read_all(Reader& reader, std::vector<Geometry> const&)
+{
+    std::vector<Geometry> result;
+    std::vector<Geometry> batch;
+    while (reader.next(batch))
+    {
+        BOOST_CHECK(! batch.empty());
+        std::move(batch.begin(), batch.end(), std::back_inserter(result));
+    }
+    BOOST_CHECK(batch.empty());
+    BOOST_CHECK(! reader.next(batch));
+    return result;
+}
+
+template <typename Geometry>
+void check_equal(std::vector<Geometry> const& expected,
+                 std::vector<Geometry> const& result)
+{
+    BOOST_CHECK_EQUAL(expected.size(), result.size());
+    for (std::size_t i = 0; i < (std::min)(expected.size(), result.size()); i++)
+    {
+        BOOST_CHECK_MESSAGE(bg::equals(expected[i], result[i]), "geometry " << i);
+    }
+}
+
+template <typename Format, typename Geometry>
+void test_lines(std::string const& lines, std::vector<Geometry> const& expected)
+{
+    for (std::size_t chunk_size : {std::size_t(16), std::size_t(1000),
+                                   std::size_t(1) << 20})
+    {
+        {
+            std::istringstream is(lines);
+            bg::line_reader<Geometry, Format> reader(is, chunk_size);
+            check_equal(expected, read_all(reader, expected));
+        }
+
+        for (std::size_t threads : {1, 2, 4})
+        {
+            std::istringstream is(lines);
+            bg::line_reader<Geometry, Format> reader(bg::parallel_execution(threads),
+                                                     is, chunk_size);
+            check_equal(expected, read_all(reader, expected));
+        }
+
+        {
+            std::istringstream is(lines);
+            bg::line_reader<Geometry, Format> reader(bg::parallel_execution(4),
+                                                     is, chunk_size, false);
+            std::vector<Geometry> result = read_all(reader, expected);
+            std::sort(result.begin(), result.end(), first_x_less<Geometry>);
+            check_equal(expected, result);
+        }
+    }
+}
+
+template <typename Geometry>
+void test_errors(std::vector<Geometry> const& geometries)
+{
+    std::string lines = wkt_lines(geometries);
+    lines.insert(lines.size() / 2, "\nLINESTRING(1 2,\n");
+
+    for (std::size_t threads : {1, 4})
+    {
+        std::istringstream is(lines);
+        bg::line_reader<Geometry> reader(bg::parallel_execution(threads), is, 100);
+        std::vector<Geometry> batch;
+        std::size_t count = 0;
+        bool thrown = false;
+        try
+        {
+            while (reader.next(batch))
+            {
+                count += batch.size();
+            }
+        }
+        catch (bg::read_wkt_exception const&)
+        {
+            thrown = true;
+        }
+        BOOST_CHECK(thrown);
+        BOOST_CHECK(count < geometries.size());
+        BOOST_CHECK(! reader.next(batch));
+    }
+
+    std::istringstream is("0102\nXX\n");
+    bg::line_reader<Geometry, bg::format_wkb> reader(is);
+    std::vector<Geometry> batch;
+    BOOST_CHECK_THROW(reader.next(batch), bg::read_wkb_exception);
+}
+
+template <typename Geometry>
+void test_stopped_early(std::vector<Geometry> const& geometries)
+{
+    // The destructor stops the threads while chunks are being parsed
+    std::istringstream is(wkt_lines(geometries));
+    bg::line_reader<Geometry> reader(bg::parallel_execution(4), is, 64);
+    std::vector<Geometry> batch;
+    BOOST_CHECK(reader.next(batch));
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+
+    std::vector<linestring> const geometries = make_geometries<linestring>(2000);
+
+    test_lines<bg::format_wkt>(wkt_lines(geometries), geometries);
+    test_lines<bg::format_wkb>(wkb_lines(geometries), geometries);
+
+    // Empty input and input without a line end
+    test_lines<bg::format_wkt>("", std::vector<linestring>());
+    test_lines<bg::format_wkt>("\n\r\n\n", std::vector<linestring>());
+    test_lines<bg::format_wkt>("LINESTRING(0 0,1 1)",
+        std::vector<linestring>{bg::from_wkt<linestring>("LINESTRING(0 0,1 1)")});
+
+    test_errors(geometries);
+    test_stopped_early(geometries);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
@@ -0,0 +1,287 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/endian/conversion.hpp>
+
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/extensions/gis/io/shapefile/mapped_shapefile.hpp>
+#include <boost/geometry/extensions/gis/io/shapefile/read.hpp>
+
+
+// Writes the contents of .shp and .shx files
+class shapefile_writer
+{
+public:
+    explicit shapefile_writer(boost::int32_t type)
+        : m_type(type)
+    {}
+
+    void add_point(double x, double y)
+    {
+        std::string content;
+        put_little(content, m_type);
+        put_little(content, x);
+        put_little(content, y);
+        add_record(content);
+    }
+
+    // Adds a polyline or a polygon record
+    void add_parts(std::vector<std::vector<std::pair<double, double> > > const& parts)
+    {
+        std::string content;
+        put_little(content, m_type);
+        for (int i = 0; i < 4; i++)
+        {
+            put_little(content, 0.0); // box
+        }
+        boost::int32_t num_points = 0;
+        for (auto const& part : parts)
+        {
+            num_points += boost::int32_t(part.size());
+        }
+        put_little(content, boost::int32_t(parts.size()));
+        put_little(content, num_points);
+        boost::int32_t first = 0;
+        for (auto const& part : parts)
+        {
+            put_little(content, first);
+            first += boost::int32_t(part.size());
+        }
+        for (auto const& part : parts)
+        {
+            for (auto const& xy : part)
+            {
+                put_little(content, xy.first);
+                put_little(content, xy.second);
+            }
+        }
+        add_record(content);
+    }
+
+    std::string shp() const { return header(100 + m_records.size()) + m_records; }
+    std::string shx() const { return header(100 + m_index.size()) + m_index; }
+
+private:
+    template <typename T>
+    static void put_little(std::string& str, T value)
+    {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        if (boost::endian::order::native == boost::endian::order::big)
+        {
+            std::reverse(bytes, bytes + sizeof(T));
+        }
+        str.append(bytes, sizeof(T));
+    }
+
+    static void put_big(std::string& str, boost::int32_t value)
+    {
+        value = boost::endian::native_to_big(value);
+        str.append(reinterpret_cast<char const*>(&value), sizeof(value));
+    }
+
+    void add_record(std::string const& content)
+    {
+        put_big(m_index, boost::int32_t((100 + m_records.size()) / 2));
+        put_big(m_index, boost::int32_t(content.size() / 2));
+        put_big(m_records, boost::int32_t(m_index.size() / 8));
+        put_big(m_records, boost::int32_t(content.size() / 2));
+        m_records += content;
+    }
+
+    std::string header(std::size_t size) const
+    {
+        std::string result;
+        put_big(result, 9994);
+        for (int i = 0; i < 5; i++)
+        {
+            put_big(result, 0);
+        }
+        put_big(result, boost::int32_t(size / 2));
+        put_little(result, boost::int32_t(1000));
+        put_little(result, m_type);
+        for (int i = 0; i < 8; i++)
+        {
+            put_little(result, 0.0);
+        }
+        return result;
+    }
+
+    boost::int32_t m_type;
+    std::string m_records;
+    std::string m_index;
+};
+
+typedef std::vector<std::pair<double, double> > part_type;
+
+part_type square(double x, double y, double size, bool clockwise)
+{
+    part_type result;
+    result.emplace_back(x, y);
+    if (clockwise)
+    {
+        result.emplace_back(x, y + size);
+        result.emplace_back(x + size, y + size);
+        result.emplace_back(x + size, y);
+    }
+    else
+    {
+        result.emplace_back(x + size, y);
+        result.emplace_back(x + size, y + size);
+        result.emplace_back(x, y + size);
+    }
+    result.emplace_back(x, y);
+    return result;
+}
+
+template <typename Geometries>
+void check_equal(Geometries const& expected, Geometries const& result)
+{
+    BOOST_CHECK_EQUAL(expected.size(), result.size());
+    for (std::size_t i = 0; i < (std::min)(expected.size(), result.size()); i++)
+    {
+        BOOST_CHECK_MESSAGE(bg::equals(expected[i], result[i]), "geometry " << i);
+    }
+}
+
+template <typename Geometries>
+void test_read(shapefile_writer const& writer, std::size_t expected_count,
+               std::size_t expected_last_count = 0)
+{
+    std::string const shp = writer.shp();
+    std::string const shx = writer.shx();
+
+    std::istringstream is(shp);
+    Geometries expected;
+    bg::read_shapefile(is, expected);
+    BOOST_CHECK_EQUAL(expected.size(), expected_count);
+
+    bg::mapped_shapefile const mapped(shp.data(), shp.size(), shx.data(), shx.size());
+    for (std::size_t threads : {1, 4})
+    {
+        Geometries result;
+        bg::read_shapefile(bg::parallel_execution(threads), mapped, result);
+        check_equal(expected, result);
+    }
+
+    // Geometries appended to a non-empty range, as by reading the records
+    // one by one (the points of a point file are added to the last multi point)
+    {
+        Geometries initial;
+        initial.push_back(expected.front());
+
+        Geometries one_by_one = initial;
+        for (std::size_t i = 0; i < mapped.size(); i++)
+        {
+            mapped.read(i, one_by_one);
+        }
+        BOOST_CHECK_EQUAL(one_by_one.size(), expected_last_count > 0 ? 1u : expected.size() + 1);
+
+        for (std::size_t threads : {1, 4})
+        {
+            Geometries result = initial;
+            bg::read_shapefile(bg::parallel_execution(threads), mapped, result);
+            check_equal(one_by_one, result);
+        }
+    }
+
+    Geometries none;
+    BOOST_CHECK_THROW(mapped.read(mapped.size(), none), bg::read_shapefile_exception);
+    BOOST_CHECK(none.empty());
+
+    // Records read lazily, in any order
+    Geometries last;
+    mapped.read(mapped.size() - 1, last);
+    if (expected_last_count > 0)
+    {
+        // One point of the multi point
+        BOOST_CHECK_EQUAL(last.size(), 1u);
+        BOOST_CHECK_EQUAL(bg::num_points(last.back()), expected_last_count);
+    }
+    else
+    {
+        BOOST_CHECK(! last.empty() && bg::equals(last.back(), expected.back()));
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::linestring<P> linestring;
+
+    shapefile_writer polygons(5);
+    shapefile_writer polylines(3);
+    shapefile_writer points(1);
+    std::size_t polygon_count = 0;
+    for (int i = 0; i < 1000; i++)
+    {
+        double const x = i * 10.0;
+        if (i % 7 == 0)
+        {
+            // Two polygons, the second with a hole
+            polygons.add_parts({square(x, 0, 4, true), square(x, 5, 4, true),
+                                square(x + 1, 6, 1, false)});
+            polygon_count += 2;
+        }
+        else
+        {
+            polygons.add_parts({square(x, 0, 8, true), square(x + 2, 2, 2, false)});
+            polygon_count += 1;
+        }
+        polylines.add_parts({part_type{{x, 0}, {x + 1, 1}}, part_type{{x, 5}, {x, 6}}});
+        points.add_point(x, -x);
+    }
+
+    test_read<std::vector<polygon> >(polygons, polygon_count);
+    test_read<std::vector<bg::model::multi_polygon<polygon> > >(polygons, 1000);
+    test_read<std::vector<linestring> >(polylines, 2000);
+    test_read<std::vector<bg::model::multi_linestring<linestring> > >(polylines, 1000);
+    test_read<std::vector<P> >(points, 1000);
+    test_read<std::vector<bg::model::multi_point<P> > >(points, 1, 1);
+
+    // Memory mapped files
+    std::string const name = "mapped_shapefile_test";
+    std::ofstream(name + ".shp", std::ios::binary) << polygons.shp();
+    std::ofstream(name + ".shx", std::ios::binary) << polygons.shx();
+    {
+        bg::mapped_shapefile const mapped(name + ".shp", name + ".shx");
+        BOOST_CHECK_EQUAL(mapped.size(), 1000u);
+        BOOST_CHECK_EQUAL(mapped.type(), 5);
+        std::vector<polygon> result;
+        bg::read_shapefile(bg::parallel_execution(), mapped, result);
+        BOOST_CHECK_EQUAL(result.size(), polygon_count);
+    }
+    std::remove((name + ".shp").c_str());
+    std::remove((name + ".shx").c_str());
+
+    // Truncated file
+    std::string const shp = polygons.shp().substr(0, 5000);
+    std::string const shx = polygons.shx();
+    bg::mapped_shapefile const truncated(shp.data(), shp.size(), shx.data(), shx.size());
+    std::vector<polygon> result;
+    BOOST_CHECK_THROW(bg::read_shapefile(bg::parallel_execution(2), truncated, result),
+                      bg::read_shapefile_exception);
+    BOOST_CHECK(result.empty());
+}
+
+int test_main(int, char*[])
+{
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
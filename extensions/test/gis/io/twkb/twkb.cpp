@@ -0,0 +1,237 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+#include <boost/geometry/extensions/gis/io/twkb/read_twkb.hpp>
+#include <boost/geometry/extensions/gis/io/twkb/write_twkb.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/write_wkb.hpp>
+
+#include <boost/variant/variant.hpp>
+
+
+typedef std::vector<boost::uint8_t> bytes_type;
+
+template <typename Geometry>
+std::string to_wkt(Geometry const& geometry)
+{
+    std::ostringstream out;
+    out << bg::wkt(geometry);
+    return out.str();
+}
+
+template <typename Geometry>
+bytes_type to_twkb(Geometry const& geometry, bg::twkb_options const& options)
+{
+    bytes_type result;
+    bg::write_twkb(geometry, std::back_inserter(result), options);
+    return result;
+}
+
+template <typename Geometry>
+void test_options(std::string const& wkt, std::string const& expected,
+                  bg::twkb_options const& options)
+{
+    Geometry const geometry = bg::from_wkt<Geometry>(wkt);
+    bytes_type const twkb = to_twkb(geometry, options);
+
+    Geometry result;
+    BOOST_CHECK_MESSAGE(bg::read_twkb(twkb.begin(), twkb.end(), result),
+                        "read_twkb failed for " << wkt);
+    BOOST_CHECK_EQUAL(to_wkt(result), expected);
+}
+
+template <typename Geometry>
+void test_twkb(std::string const& wkt, std::string const& expected)
+{
+    bg::twkb_options options;
+    test_options<Geometry>(wkt, expected, options);
+    options.bbox = true;
+    test_options<Geometry>(wkt, expected, options);
+    options.size = true;
+    test_options<Geometry>(wkt, expected, options);
+    options.bbox = false;
+    test_options<Geometry>(wkt, expected, options);
+}
+
+template <typename Geometry>
+void test_twkb(std::string const& wkt)
+{
+    test_twkb<Geometry>(wkt, wkt);
+}
+
+template <typename Geometry>
+void test_invalid(bytes_type const& twkb)
+{
+    Geometry geometry;
+    BOOST_CHECK(! bg::read_twkb(twkb.begin(), twkb.end(), geometry));
+}
+
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::polygon<P, true, false> open_polygon;
+    typedef bg::model::multi_point<P> multi_point;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    test_twkb<P>("POINT(1 2)");
+    test_twkb<P>("POINT(-1 -2)");
+    test_twkb<linestring>("LINESTRING(1 2,3 4,-5 6)");
+    test_twkb<linestring>("LINESTRING()");
+    test_twkb<polygon>("POLYGON((0 0,0 5,5 5,5 0,0 0),(1 1,2 1,2 2,1 1))");
+    test_twkb<polygon>("POLYGON(())");
+    test_twkb<open_polygon>("POLYGON((0 0,0 5,5 5,5 0))", "POLYGON((0 0,0 5,5 5,5 0,0 0))");
+    test_twkb<multi_point>("MULTIPOINT((1 2),(3 4))");
+    test_twkb<multi_point>("MULTIPOINT()");
+    test_twkb<multi_linestring>("MULTILINESTRING((1 2,3 4),(5 6,7 8))");
+    test_twkb<multi_polygon>("MULTIPOLYGON(((0 0,0 5,5 5,5 0,0 0)),((6 6,6 7,7 7,6 6)))");
+    test_twkb<bg::model::ring<P> >("POLYGON((0 0,0 5,5 5,5 0,0 0))");
+    test_twkb<bg::model::box<P> >("BOX(1 2,3 4)", "POLYGON((1 2,1 4,3 4,3 2,1 2))");
+    test_twkb<bg::model::segment<P> >("SEGMENT(1 2,3 4)", "LINESTRING(1 2,3 4)");
+
+    // Open rings are written closed
+    {
+        bytes_type const twkb = to_twkb(bg::from_wkt<open_polygon>("POLYGON((0 0,0 5,5 5,5 0))"),
+                                        bg::twkb_options());
+        polygon closed;
+        BOOST_CHECK(bg::read_twkb(twkb.begin(), twkb.end(), closed));
+        BOOST_CHECK_EQUAL(to_wkt(closed), "POLYGON((0 0,0 5,5 5,5 0,0 0))");
+    }
+
+    // Precision
+    bg::twkb_options options(2);
+    test_options<P>("POINT(1.2345 -2.3456)", "POINT(1.23 -2.35)", options);
+    test_options<linestring>("LINESTRING(0.001 0.1,1.004 1.5)", "LINESTRING(0 0.1,1 1.5)", options);
+    options = bg::twkb_options(-2);
+    test_options<P>("POINT(1234 -5678)", "POINT(1200 -5700)", options);
+
+    // Dynamic geometries and geometry collections
+    typedef boost::variant<P, linestring, polygon> variant;
+    typedef bg::model::geometry_collection<variant> collection;
+    test_twkb<variant>("LINESTRING(1 2,3 4)");
+    test_twkb<variant>("POLYGON((0 0,0 5,5 5,5 0,0 0))");
+    test_twkb<collection>("GEOMETRYCOLLECTION(POINT(1 2),LINESTRING(1 2,3 4))");
+    test_twkb<collection>("GEOMETRYCOLLECTION()");
+
+    // Smaller than WKB
+    {
+        linestring const ls = bg::from_wkt<linestring>(
+            "LINESTRING(100 100,101 102,103 101,104 104,106 103)");
+        bytes_type wkb;
+        bg::write_wkb(ls, std::back_inserter(wkb));
+        BOOST_CHECK_LT(to_twkb(ls, bg::twkb_options()).size() * 5, wkb.size());
+    }
+
+    // Mismatching types and invalid input
+    {
+        bytes_type const twkb = to_twkb(bg::from_wkt<linestring>("LINESTRING(1 2,3 4)"),
+                                        bg::twkb_options());
+        test_invalid<P>(twkb);
+        test_invalid<polygon>(twkb);
+        test_invalid<linestring>(bytes_type(twkb.begin(), twkb.end() - 1));
+        test_invalid<linestring>(bytes_type());
+
+        // A count larger than the input
+        bytes_type huge = twkb;
+        huge[2] = 0xff;
+        huge.insert(huge.begin() + 3, 3, 0xff);
+        test_invalid<linestring>(huge);
+    }
+}
+
+template <typename P>
+void test_3d()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_2d;
+
+    test_twkb<P>("POINT(1 2 3)");
+    test_twkb<linestring>("LINESTRING(1 2 3,4 5 6)");
+
+    bg::twkb_options options(1);
+    options.z_precision = 0;
+    test_options<P>("POINT(1.25 2.25 3.25)", "POINT(1.3 2.3 3)", options);
+
+    // Z is dropped for 2D points and zero for 3D points read from 2D input
+    bytes_type twkb = to_twkb(bg::from_wkt<P>("POINT(1 2 3)"), bg::twkb_options());
+    point_2d p2;
+    BOOST_CHECK(bg::read_twkb(twkb.begin(), twkb.end(), p2));
+    BOOST_CHECK_EQUAL(to_wkt(p2), "POINT(1 2)");
+
+    twkb = to_twkb(p2, bg::twkb_options());
+    P p3;
+    BOOST_CHECK(bg::read_twkb(twkb.begin(), twkb.end(), p3));
+    BOOST_CHECK_EQUAL(to_wkt(p3), "POINT(1 2 0)");
+}
+
+// Encoding of the specification and PostGIS
+void test_encoding()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+
+    bytes_type twkb = to_twkb(bg::from_wkt<P>("POINT(1 2)"), bg::twkb_options());
+    BOOST_CHECK((twkb == bytes_type{ 0x01, 0x00, 0x02, 0x04 }));
+
+    // Precision 1, size and bbox
+    bg::twkb_options options(1);
+    options.bbox = true;
+    options.size = true;
+    twkb = to_twkb(bg::from_wkt<bg::model::linestring<P> >("LINESTRING(1 2,3 1)"), options);
+    BOOST_CHECK((twkb == bytes_type{ 0x22, 0x03, 0x09, 0x14, 0x28, 0x14, 0x14,
+                                     0x02, 0x14, 0x28, 0x28, 0x13 }));
+
+    BOOST_CHECK_THROW(to_twkb(P(1, 2), bg::twkb_options(8)), bg::invalid_input_exception);
+    BOOST_CHECK_THROW(to_twkb(P(1, 2), bg::twkb_options(-9)), bg::invalid_input_exception);
+
+    // Coordinates which are not finite or too large for the precision
+    double const nan = std::numeric_limits<double>::quiet_NaN();
+    double const inf = std::numeric_limits<double>::infinity();
+    BOOST_CHECK_THROW(to_twkb(P(nan, 2), bg::twkb_options()), bg::invalid_input_exception);
+    BOOST_CHECK_THROW(to_twkb(P(1, -inf), bg::twkb_options()), bg::invalid_input_exception);
+    BOOST_CHECK_THROW(to_twkb(P(1e300, 2), bg::twkb_options()), bg::invalid_input_exception);
+    BOOST_CHECK_THROW(to_twkb(P(1e12, 2), bg::twkb_options(7)), bg::invalid_input_exception);
+
+    // The differences of the largest coordinates fit
+    test_twkb<bg::model::linestring<P> >("LINESTRING(4e+18 -4e+18,-4e+18 4e+18)");
+
+    // Differences adding up to more than 64 bits
+    typedef bg::model::linestring<P> linestring;
+    test_invalid<linestring>(bytes_type{ 0x02, 0x00, 0x02,
+                                         0xfe, 0xff, 0xff, 0xff, 0xff,
+                                         0xff, 0xff, 0xff, 0xff, 0x01, 0x00,
+                                         0x02, 0x00 });
+    test_invalid<linestring>(bytes_type{ 0x02, 0x00, 0x02,
+                                         0xff, 0xff, 0xff, 0xff, 0xff,
+                                         0xff, 0xff, 0xff, 0xff, 0x01, 0x00,
+                                         0x01, 0x00 });
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+    test_all<bg::model::d2::point_xy<double> >();
+    test_3d<bg::model::point<double, 3, bg::cs::cartesian> >();
+    test_encoding();
+
+    return 0;
+}
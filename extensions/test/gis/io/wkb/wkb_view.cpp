@@ -0,0 +1,175 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+#include <boost/geometry/extensions/gis/io/wkb/utility.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/wkb_view.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/write_wkb.hpp>
+#include <boost/geometry/extensions/multi/gis/io/wkb/write_wkb.hpp>
+
+
+typedef std::vector<boost::uint8_t> byte_vector;
+
+template <typename Geometry>
+byte_vector to_wkb(std::string const& wkt)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+    byte_vector wkb;
+    BOOST_CHECK(bg::write_wkb(geometry, std::back_inserter(wkb)));
+    return wkb;
+}
+
+template <typename Geometry, typename View>
+void test_view(std::string const& wkt)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+    byte_vector const wkb = to_wkb<Geometry>(wkt);
+    View const view(wkb.data(), wkb.size());
+
+    BOOST_CHECK_EQUAL(bg::num_points(view), bg::num_points(geometry));
+    BOOST_CHECK_CLOSE(double(bg::area(view)), double(bg::area(geometry)), 1e-9);
+    BOOST_CHECK_CLOSE(double(bg::length(view)), double(bg::length(geometry)), 1e-9);
+
+    bg::model::box<typename bg::point_type<Geometry>::type> box1, box2;
+    bg::envelope(view, box1);
+    bg::envelope(geometry, box2);
+    BOOST_CHECK_MESSAGE(bg::equals(box1, box2), wkt << " envelope: " << bg::wkt(box1));
+
+    BOOST_CHECK(bg::intersects(view, box2));
+    BOOST_CHECK(bg::intersects(view, geometry));
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_point<P> multi_point;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    test_view<linestring, bg::wkb_linestring_view<P> >("LINESTRING(0 0,3 4,3 8)");
+    test_view<polygon, bg::wkb_polygon_view<P> >(
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 2),(6 6,8 6,8 8,6 6))");
+    test_view<multi_point, bg::wkb_multi_point_view<P> >("MULTIPOINT((1 2),(3 4),(5 6))");
+    test_view<multi_linestring, bg::wkb_multi_linestring_view<P> >(
+        "MULTILINESTRING((0 0,3 4),(1 1,2 2,3 1))");
+    test_view<multi_polygon, bg::wkb_multi_polygon_view<P> >(
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 2)),"
+        "((20 20,20 30,30 30,30 20,20 20)),((40 40,40 45,45 40,40 40)))");
+
+    // Relations between views
+    byte_vector const wkb_poly = to_wkb<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0))");
+    byte_vector const wkb_ls = to_wkb<linestring>("LINESTRING(5 5,20 20)");
+    byte_vector const wkb_pt = to_wkb<P>("POINT(3 4)");
+    bg::wkb_polygon_view<P> const poly(wkb_poly.data(), wkb_poly.size());
+    bg::wkb_linestring_view<P> const ls(wkb_ls.data(), wkb_ls.size());
+    bg::wkb_point_view<P> const pt(wkb_pt.data(), wkb_pt.size());
+    BOOST_CHECK(bg::intersects(poly, ls));
+    BOOST_CHECK(bg::within(pt, poly));
+    BOOST_CHECK_CLOSE(double(bg::distance(pt, ls)), std::sqrt(5.0), 1e-9);
+    BOOST_CHECK_EQUAL(bg::get<0>(pt), 3.0);
+    BOOST_CHECK_EQUAL(bg::get<1>(pt), 4.0);
+
+    P centroid;
+    bg::centroid(poly, centroid);
+    BOOST_CHECK_CLOSE(bg::get<0>(centroid), 5.0, 1e-9);
+
+    byte_vector const wkb_mpoly = to_wkb<multi_polygon>(
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((20 0,20 10,30 10,30 0,20 0)))");
+    bg::wkb_multi_polygon_view<P> const mpoly(wkb_mpoly.data(), wkb_mpoly.size());
+    BOOST_CHECK(bg::intersects(mpoly, ls));
+    BOOST_CHECK(bg::intersects(mpoly, poly));
+    bg::centroid(mpoly, centroid);
+    BOOST_CHECK_CLOSE(bg::get<0>(centroid), 15.0, 1e-9);
+
+    // Relations between multi views, their geometries are stored in the views
+    byte_vector const wkb_mls = to_wkb<multi_linestring>(
+        "MULTILINESTRING((0 0,3 4),(1 1,2 2,3 1))");
+    bg::wkb_multi_linestring_view<P> const mls(wkb_mls.data(), wkb_mls.size());
+    BOOST_CHECK(&bg::range::at(mls, 1) == &bg::range::at(mls, 1));
+    BOOST_CHECK(bg::intersects(mls, mls));
+    BOOST_CHECK(bg::intersects(mls, mpoly));
+    BOOST_CHECK(! bg::disjoint(mpoly, mls));
+    BOOST_CHECK(! bg::disjoint(mpoly, mpoly));
+    BOOST_CHECK(bg::disjoint(mls, bg::from_wkt<multi_linestring>("MULTILINESTRING((50 50,60 60))")));
+    BOOST_CHECK(bg::disjoint(mpoly, bg::from_wkt<multi_polygon>(
+        "MULTIPOLYGON(((50 50,50 60,60 60,60 50,50 50)))")));
+
+    // Copies of the views share the decoded points
+    bg::wkb_linestring_view<P> const copy = ls;
+    BOOST_CHECK(copy.begin() == ls.begin());
+    BOOST_CHECK(&*bg::exterior_ring(poly).begin() == &*bg::exterior_ring(poly).begin());
+}
+
+void test_byte_order()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+
+    // Big endian linestring LINESTRING(1 2,3 4)
+    byte_vector wkb;
+    BOOST_CHECK(bg::hex2wkb("000000000200000002"
+                            "3ff00000000000004000000000000000"
+                            "40080000000000004010000000000000",
+                            std::back_inserter(wkb)));
+    bg::wkb_linestring_view<point_type> const ls(wkb.data(), wkb.size());
+    BOOST_CHECK_EQUAL(ls.size(), 2u);
+    point_type const p = *(ls.begin() + 1);
+    BOOST_CHECK_EQUAL(bg::get<0>(p), 3.0);
+    BOOST_CHECK_EQUAL(bg::get<1>(p), 4.0);
+    BOOST_CHECK_CLOSE(double(bg::length(ls)), std::sqrt(8.0), 1e-9);
+
+    // Wrong type, truncated bytes and trailing bytes are rejected
+    typedef bg::wkb_polygon_view<point_type> polygon_view;
+    BOOST_CHECK_THROW(polygon_view(wkb.data(), wkb.size()), bg::read_wkb_exception);
+    BOOST_CHECK_THROW(bg::wkb_linestring_view<point_type>(wkb.data(), wkb.size() - 1),
+                      bg::read_wkb_exception);
+    wkb.push_back(0);
+    BOOST_CHECK_THROW(bg::wkb_linestring_view<point_type>(wkb.data(), wkb.size()),
+                      bg::read_wkb_exception);
+}
+
+void test_3d()
+{
+    typedef bg::model::point<double, 3, bg::cs::cartesian> point_type;
+    byte_vector const wkb = to_wkb<bg::model::linestring<point_type> >(
+        "LINESTRING(1 2 3,4 5 6)");
+    bg::wkb_linestring_view<point_type> const ls(wkb.data(), wkb.size());
+    BOOST_CHECK_CLOSE(double(bg::length(ls)), std::sqrt(27.0), 1e-9);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+    test_byte_order();
+    test_3d();
+
+    return 0;
+}
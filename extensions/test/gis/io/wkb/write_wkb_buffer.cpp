@@ -0,0 +1,79 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <deque>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+#include <boost/geometry/extensions/gis/io/wkb/write_wkb.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/write_wkb_buffer.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/wkb_size.hpp>
+#include <boost/geometry/extensions/multi/gis/io/wkb/write_wkb.hpp>
+
+
+template <typename Geometry>
+void test_geometry(std::string const& wkt)
+{
+    Geometry const geometry = bg::from_wkt<Geometry>(wkt);
+
+    std::vector<boost::uint8_t> expected;
+    bg::write_wkb(geometry, std::back_inserter(expected));
+
+    BOOST_CHECK_EQUAL(bg::wkb_size(geometry), expected.size());
+
+    std::vector<boost::uint8_t> buffer(bg::wkb_size(geometry));
+    boost::uint8_t* const end = bg::write_wkb_buffer(geometry, buffer.data());
+    BOOST_CHECK(end == buffer.data() + buffer.size());
+    BOOST_CHECK_MESSAGE(buffer == expected, "write_wkb_buffer differs for " << wkt);
+}
+
+template <typename P, bool Native>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+
+    BOOST_CHECK(bg::detail::wkb::is_native_point<P>::value == Native);
+    BOOST_CHECK(bg::detail::wkb::is_native_range<linestring>::value == Native);
+
+    test_geometry<P>("POINT(1 2)");
+    test_geometry<linestring>("LINESTRING(1 2,3 4,5 6)");
+    test_geometry<linestring>("LINESTRING()");
+    test_geometry<polygon>("POLYGON((0 0,0 5,5 5,5 0,0 0),(1 1,2 1,2 2,1 1))");
+    test_geometry<bg::model::multi_point<P>>("MULTIPOINT((1 2),(3 4))");
+    test_geometry<bg::model::multi_linestring<linestring>>(
+        "MULTILINESTRING((1 2,3 4),(5 6,7 8,9 10))");
+    test_geometry<bg::model::multi_polygon<polygon>>(
+        "MULTIPOLYGON(((0 0,0 5,5 5,5 0,0 0)),((6 6,6 7,7 7,6 6)))");
+
+    // Points not stored in a vector are written one by one
+    typedef bg::model::linestring<P, std::deque> deque_linestring;
+    BOOST_CHECK(! bg::detail::wkb::is_native_range<deque_linestring>::value);
+    test_geometry<deque_linestring>("LINESTRING(1 2,3 4,5 6)");
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<double, 2, bg::cs::cartesian>, true>();
+    test_all<bg::model::d2::point_xy<double>, true>();
+    test_all<bg::model::point<double, 3, bg::cs::cartesian>, true>();
+    test_all<bg::model::point<float, 2, bg::cs::cartesian>, false>();
+    test_all<bg::model::point<int, 3, bg::cs::cartesian>, false>();
+
+    return 0;
+}
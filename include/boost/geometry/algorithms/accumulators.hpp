@@ -0,0 +1,632 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_ACCUMULATORS_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_ACCUMULATORS_HPP
+
+#include <cstddef>
+#include <utility>
+
+#include <boost/geometry/algorithms/detail/equals/point_point.hpp>
+
+#include <boost/geometry/arithmetic/arithmetic.hpp>
+
+#include <boost/geometry/core/assert.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/ring.hpp>
+
+#include <boost/geometry/strategies/area/cartesian.hpp>
+#include <boost/geometry/strategies/area/geographic.hpp>
+#include <boost/geometry/strategies/area/services.hpp>
+#include <boost/geometry/strategies/area/spherical.hpp>
+#include <boost/geometry/strategies/centroid/cartesian.hpp>
+#include <boost/geometry/strategies/centroid/services.hpp>
+#include <boost/geometry/strategies/detail.hpp>
+#include <boost/geometry/strategies/length/cartesian.hpp>
+#include <boost/geometry/strategies/length/geographic.hpp>
+#include <boost/geometry/strategies/length/services.hpp>
+#include <boost/geometry/strategies/length/spherical.hpp>
+#include <boost/geometry/strategies/relate/cartesian.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace accumulators
+{
+
+
+// Stream of the points of rings, each ring ended by close_ring. The rings
+// are passed to the Policy, calculating the segments into its state and
+// adding the states of closed rings to its total.
+// The first ring of the stream is kept open, even if it is closed, because
+// it may continue the last ring of another stream merged before it.
+template <typename Point, typename Policy>
+class ring_stream
+{
+    typedef typename Policy::state_type state_type;
+    typedef typename Policy::total_type total_type;
+
+    struct part
+    {
+        state_type state;
+        Point first;
+        Point last;
+        std::size_t count = 0;
+    };
+
+public:
+    explicit ring_stream(Policy const& policy)
+        : m_policy(policy)
+        , m_head_closed(false)
+        , m_total(policy.initial_total())
+    {}
+
+    inline void add(Point const& point)
+    {
+        add(m_head_closed ? m_tail : m_head, point);
+    }
+
+    inline void close_ring()
+    {
+        if (! m_head_closed)
+        {
+            m_head_closed = true;
+        }
+        else if (m_tail.count > 0)
+        {
+            close(m_tail, m_total);
+            m_tail = part();
+        }
+    }
+
+    // Appends the stream of other, its points following the points of this
+    // stream
+    inline void merge(ring_stream const& other)
+    {
+        part& current = m_head_closed ? m_tail : m_head;
+        if (current.count == 0 && ! m_head_closed)
+        {
+            // This stream is empty (the policy is not assigned, strategies
+            // are not necessarily assignable)
+            m_head = other.m_head;
+            m_head_closed = other.m_head_closed;
+            m_tail = other.m_tail;
+            m_total = other.m_total;
+            return;
+        }
+
+        if (current.count > 0)
+        {
+            // The first ring of other continues the open ring
+            if (other.m_head.count > 0)
+            {
+                m_policy.apply(current.last, other.m_head.first, current.state);
+                m_policy.merge(current.state, other.m_head.state);
+                current.last = other.m_head.last;
+                current.count += other.m_head.count;
+            }
+            if (other.m_head_closed)
+            {
+                if (! m_head_closed)
+                {
+                    m_head_closed = true;
+                }
+                else
+                {
+                    close(m_tail, m_total);
+                    m_tail = part();
+                }
+            }
+        }
+        else if (other.m_head.count > 0)
+        {
+            // The first ring of other is a new ring
+            if (other.m_head_closed)
+            {
+                part head = other.m_head;
+                close(head, m_total);
+            }
+            else
+            {
+                m_tail = other.m_head;
+            }
+        }
+
+        m_policy.add_total(m_total, other.m_total);
+        if (other.m_head_closed)
+        {
+            m_tail = other.m_tail;
+        }
+    }
+
+    // Returns the total of the rings, including the open ring(s) closed
+    inline total_type total() const
+    {
+        total_type result = m_total;
+        if (m_head.count > 0)
+        {
+            part head = m_head;
+            close(head, result);
+        }
+        if (m_tail.count > 0)
+        {
+            part tail = m_tail;
+            close(tail, result);
+        }
+        return result;
+    }
+
+    inline bool empty() const
+    {
+        return m_head.count == 0;
+    }
+
+    inline Policy const& policy() const
+    {
+        return m_policy;
+    }
+
+private:
+    inline void add(part& p, Point const& point)
+    {
+        if (p.count == 0)
+        {
+            p.first = point;
+        }
+        else
+        {
+            m_policy.apply(p.last, point, p.state);
+        }
+        p.last = point;
+        ++p.count;
+    }
+
+    inline void close(part& p, total_type& total) const
+    {
+        m_policy.apply(p.last, p.first, p.state);
+        m_policy.add_closed(total, p.state);
+    }
+
+    Policy m_policy;
+    part m_head;
+    bool m_head_closed;
+    part m_tail;
+    total_type m_total;
+};
+
+
+template <typename Point, typename Strategy, bool Reverse>
+struct area_policy
+{
+    typedef typename Strategy::template state<Point> state_type;
+    typedef typename Strategy::template result_type<Point>::type total_type;
+
+    explicit area_policy(Strategy const& strategy)
+        : m_strategy(strategy)
+    {}
+
+    inline total_type initial_total() const
+    {
+        return total_type(0);
+    }
+
+    inline void apply(Point const& p1, Point const& p2, state_type& state) const
+    {
+        m_strategy.apply(p1, p2, state);
+    }
+
+    inline void merge(state_type& state, state_type const& other) const
+    {
+        state.merge(other);
+    }
+
+    inline void add_closed(total_type& total, state_type& state) const
+    {
+        total_type const area = m_strategy.result(state);
+        total += Reverse ? -area : area;
+    }
+
+    inline void add_total(total_type& total, total_type const& other) const
+    {
+        total += other;
+    }
+
+    Strategy m_strategy;
+};
+
+
+// The points are translated to the origin for precision, as the centroid
+// algorithm does, the sums of all rings are kept in one state
+template <typename Point, typename ResultPoint, typename Strategy>
+struct centroid_policy
+{
+    typedef typename Strategy::template state_type
+        <
+            Point, ResultPoint
+        >::type state_type;
+    typedef state_type total_type;
+
+    centroid_policy(Strategy const& strategy, Point const& origin, bool translate)
+        : m_strategy(strategy)
+        , m_origin(origin)
+        , m_translate(translate)
+    {}
+
+    inline total_type initial_total() const
+    {
+        return total_type();
+    }
+
+    inline void apply(Point const& p1, Point const& p2, state_type& state) const
+    {
+        if (m_translate)
+        {
+            Point t1 = p1, t2 = p2;
+            subtract_point(t1, m_origin);
+            subtract_point(t2, m_origin);
+            m_strategy.apply(t1, t2, state);
+        }
+        else
+        {
+            m_strategy.apply(p1, p2, state);
+        }
+    }
+
+    inline void merge(state_type& state, state_type const& other) const
+    {
+        state.merge(other);
+    }
+
+    inline void add_closed(total_type& total, state_type& state) const
+    {
+        total.merge(state);
+    }
+
+    inline void add_total(total_type& total, total_type const& other) const
+    {
+        total.merge(other);
+    }
+
+    Strategy m_strategy;
+    Point m_origin;
+    bool m_translate;
+};
+
+
+}} // namespace detail::accumulators
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Accumulates the area of rings streamed point by point
+\details The points of the rings are added one by one or in chunks, each
+    ring is ended by close_ring, closing it if necessary. The rings should
+    have the point order of the polygons, holes having the opposite order,
+    so the area is the area of the polygons. The area is calculated with
+    the state of the area strategy, the geometries are not built.
+    Accumulators processing consecutive chunks of the stream, e.g. in
+    different threads, can be merged. The points of a merged accumulator
+    added before its first close_ring continue the open ring of the
+    accumulator it is merged into.
+\ingroup area
+\tparam Point \tparam_point
+\tparam PointOrder The order of the points of the exterior rings
+\tparam Strategies An umbrella area strategy
+*/
+template
+<
+    typename Point,
+    order_selector PointOrder = clockwise,
+    typename Strategies = typename strategies::area::services::default_strategy
+        <
+            Point
+        >::type
+>
+class area_accumulator
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (strategies::detail::is_umbrella_strategy<Strategies>::value),
+        "The area accumulator requires an umbrella strategy.",
+        Strategies);
+
+    typedef decltype(std::declval<Strategies const&>().area(std::declval<Point const&>()))
+        strategy_type;
+    typedef detail::accumulators::area_policy
+        <
+            Point, strategy_type, PointOrder == counterclockwise
+        > policy_type;
+
+public:
+    typedef typename policy_type::total_type area_type;
+
+    explicit area_accumulator(Strategies const& strategies = Strategies())
+        : m_stream(policy_type(strategies.area(Point())))
+    {
+        concepts::check<Point const>();
+    }
+
+    //! Adds a point to the current ring
+    inline void add(Point const& point)
+    {
+        m_stream.add(point);
+    }
+
+    //! Adds the points [first, last) to the current ring
+    template <typename Iterator>
+    inline void add(Iterator first, Iterator last)
+    {
+        for (; first != last; ++first)
+        {
+            m_stream.add(*first);
+        }
+    }
+
+    //! Ends the current ring, the next points belong to a new ring
+    inline void close_ring()
+    {
+        m_stream.close_ring();
+    }
+
+    //! Appends the rings of other, the points of other following the
+    //! points of this accumulator
+    inline void merge(area_accumulator const& other)
+    {
+        m_stream.merge(other.m_stream);
+    }
+
+    //! Returns the area of the rings, including the current ring
+    inline area_type area() const
+    {
+        return m_stream.total();
+    }
+
+private:
+    detail::accumulators::ring_stream<Point, policy_type> m_stream;
+};
+
+
+/*!
+\brief Accumulates the centroid of rings streamed point by point
+\details The points of the rings are added one by one or in chunks, each
+    ring is ended by close_ring, closing it if necessary. Holes should have
+    the opposite point order of exterior rings. The centroid is calculated
+    with the state of the centroid strategy (Bashein-Detmer in cartesian
+    coordinate systems), the geometries are not built. Accumulators can be
+    merged as area accumulators, they should then use the same origin.
+\ingroup centroid
+\tparam Point \tparam_point
+\tparam ResultPoint The type of the centroid
+\tparam Strategies An umbrella centroid strategy
+*/
+template
+<
+    typename Point,
+    typename ResultPoint = Point,
+    typename Strategies = typename strategies::centroid::services::default_strategy
+        <
+            model::ring<Point>
+        >::type
+>
+class centroid_accumulator
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (strategies::detail::is_umbrella_strategy<Strategies>::value),
+        "The centroid accumulator requires an umbrella strategy.",
+        Strategies);
+
+    typedef decltype(std::declval<Strategies const&>().centroid(
+                std::declval<model::ring<Point> const&>())) strategy_type;
+    typedef detail::accumulators::centroid_policy
+        <
+            Point, ResultPoint, strategy_type
+        > policy_type;
+
+public:
+    //! The points are not translated, the accumulator can be merged with
+    //! other accumulators without origin
+    explicit centroid_accumulator(Strategies const& strategies = Strategies())
+        : m_stream(policy_type(strategies.centroid(model::ring<Point>()), Point(), false))
+    {
+        concepts::check<Point const>();
+    }
+
+    //! The points are translated to the origin (typically a point near
+    //! the rings) for precision
+    explicit centroid_accumulator(Point const& origin,
+                                  Strategies const& strategies = Strategies())
+        : m_stream(policy_type(strategies.centroid(model::ring<Point>()), origin, true))
+    {
+        concepts::check<Point const>();
+    }
+
+    //! Adds a point to the current ring
+    inline void add(Point const& point)
+    {
+        m_stream.add(point);
+    }
+
+    //! Adds the points [first, last) to the current ring
+    template <typename Iterator>
+    inline void add(Iterator first, Iterator last)
+    {
+        for (; first != last; ++first)
+        {
+            m_stream.add(*first);
+        }
+    }
+
+    //! Ends the current ring, the next points belong to a new ring
+    inline void close_ring()
+    {
+        m_stream.close_ring();
+    }
+
+    //! Appends the rings of other, the points of other following the
+    //! points of this accumulator
+    inline void merge(centroid_accumulator const& other)
+    {
+        BOOST_GEOMETRY_ASSERT(
+            other.m_stream.policy().m_translate == m_stream.policy().m_translate
+            && (! m_stream.policy().m_translate
+                || detail::equals::equals_point_point(other.m_stream.policy().m_origin,
+                                                      m_stream.policy().m_origin,
+                                                      strategies::relate::cartesian<>())));
+        m_stream.merge(other.m_stream);
+    }
+
+    //! Assigns the centroid of the rings, including the current ring.
+    //! Returns false if the area of the rings is zero.
+    inline bool centroid(ResultPoint& result) const
+    {
+        policy_type const& policy = m_stream.policy();
+        if (! policy.m_strategy.result(m_stream.total(), result))
+        {
+            return false;
+        }
+        if (policy.m_translate)
+        {
+            add_point(result, policy.m_origin);
+        }
+        return true;
+    }
+
+private:
+    detail::accumulators::ring_stream<Point, policy_type> m_stream;
+};
+
+
+/*!
+\brief Accumulates the length of linestrings streamed point by point
+\details The points of the linestrings are added one by one or in chunks,
+    each linestring is ended by end_linestring. Accumulators processing
+    consecutive chunks of the stream, e.g. in different threads, can be
+    merged. The points of a merged accumulator added before its first
+    end_linestring continue the linestring of the accumulator it is merged
+    into.
+\ingroup length
+\tparam Point \tparam_point
+\tparam Strategies An umbrella length strategy
+*/
+template
+<
+    typename Point,
+    typename Strategies = typename strategies::length::services::default_strategy
+        <
+            Point
+        >::type
+>
+class length_accumulator
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (strategies::detail::is_umbrella_strategy<Strategies>::value),
+        "The length accumulator requires an umbrella strategy.",
+        Strategies);
+
+    typedef decltype(std::declval<Strategies const&>().distance(
+                std::declval<Point const&>(), std::declval<Point const&>())) strategy_type;
+
+public:
+    typedef decltype(std::declval<strategy_type const&>().apply(
+                std::declval<Point const&>(), std::declval<Point const&>())) length_type;
+
+    explicit length_accumulator(Strategies const& strategies = Strategies())
+        : m_strategy(strategies.distance(Point(), Point()))
+        , m_length(0)
+        , m_has_head(false)
+        , m_head_ended(false)
+        , m_is_open(false)
+    {
+        concepts::check<Point const>();
+    }
+
+    //! Adds a point to the current linestring
+    inline void add(Point const& point)
+    {
+        if (m_is_open)
+        {
+            m_length += m_strategy.apply(m_last, point);
+        }
+        else if (! m_has_head && ! m_head_ended)
+        {
+            m_has_head = true;
+            m_head_first = point;
+        }
+        m_last = point;
+        m_is_open = true;
+    }
+
+    //! Adds the points [first, last) to the current linestring
+    template <typename Iterator>
+    inline void add(Iterator first, Iterator last)
+    {
+        for (; first != last; ++first)
+        {
+            add(*first);
+        }
+    }
+
+    //! Ends the current linestring, the next points belong to a new one
+    inline void end_linestring()
+    {
+        m_head_ended = true;
+        m_is_open = false;
+    }
+
+    //! Appends the linestrings of other, the points of other following the
+    //! points of this accumulator
+    inline void merge(length_accumulator const& other)
+    {
+        if (m_is_open && other.m_has_head)
+        {
+            m_length += m_strategy.apply(m_last, other.m_head_first);
+        }
+        if (! m_has_head && ! m_head_ended)
+        {
+            m_has_head = other.m_has_head;
+            m_head_first = other.m_head_first;
+            m_head_ended = other.m_head_ended;
+        }
+        m_length += other.m_length;
+        if (other.m_is_open)
+        {
+            m_last = other.m_last;
+            m_is_open = true;
+        }
+        else if (other.m_head_ended)
+        {
+            m_is_open = false;
+        }
+    }
+
+    //! Returns the length of the linestrings
+    inline length_type length() const
+    {
+        return m_length;
+    }
+
+private:
+    strategy_type m_strategy;
+    length_type m_length;
+    // The first point of the first linestring, which may continue
+    // a linestring of another accumulator
+    Point m_head_first;
+    bool m_has_head;
+    bool m_head_ended;
+    // The last point of the current linestring
+    Point m_last;
+    bool m_is_open;
+};
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_ACCUMULATORS_HPP
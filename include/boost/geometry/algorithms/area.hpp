@@ -19,6 +19,9 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_AREA_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_AREA_HPP
 
+#include <type_traits>
+#include <vector>
+
 #include <boost/core/ignore_unused.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
@@ -38,6 +41,7 @@
 #include <boost/geometry/algorithms/detail/calculate_sum.hpp>
 // #include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
 #include <boost/geometry/algorithms/detail/multi_sum.hpp>
+#include <boost/geometry/algorithms/detail/parallel_sum.hpp>
 #include <boost/geometry/algorithms/detail/visit.hpp>
 
 #include <boost/geometry/algorithms/area_result.hpp>
@@ -54,6 +58,7 @@
 #include <boost/geometry/strategies/default_strategy.hpp>
 
 #include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/parallel.hpp>
 
 #include <boost/geometry/views/detail/closed_clockwise_view.hpp>
 
@@ -354,7 +359,11 @@ area(Geometry const& geometry)
 [area_with_strategy_output]
 }
  */
-template <typename Geometry, typename Strategy>
+template
+<
+    typename Geometry, typename Strategy,
+    std::enable_if_t<! detail::parallel::is_execution_policy<Geometry>::value, int> = 0
+>
 inline typename area_result<Geometry, Strategy>::type
 area(Geometry const& geometry, Strategy const& strategy)
 {
@@ -366,6 +375,222 @@ area(Geometry const& geometry, Strategy const& strategy)
 }
 
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace area
+{
+
+// Only rings, polygons and multipolygons are calculated in parallel,
+// other geometries are calculated sequentially
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct area_parallel
+{
+    template <typename Strategies>
+    static inline typename area_result<Geometry, Strategies>::type
+    apply(Geometry const& geometry, Strategies const& strategies,
+          parallel_execution const& )
+    {
+        return dispatch::area<Geometry>::apply(geometry, strategies);
+    }
+};
+
+template <typename Geometry>
+struct area_parallel_rings
+{
+    template <typename Strategies>
+    static inline typename area_result<Geometry, Strategies>::type
+    apply(Geometry const& geometry, Strategies const& strategies,
+          parallel_execution const& policy)
+    {
+        std::vector<typename ring_type<Geometry>::type const*> rings;
+        detail::parallel_sum::collect_ranges<Geometry>::apply(geometry, rings);
+        return detail::parallel_sum::rings_area
+            <
+                typename area_result<Geometry, Strategies>::type
+            >(rings, strategies, policy);
+    }
+};
+
+template <typename Ring>
+struct area_parallel<Ring, ring_tag>
+    : area_parallel_rings<Ring>
+{};
+
+template <typename Polygon>
+struct area_parallel<Polygon, polygon_tag>
+    : area_parallel_rings<Polygon>
+{};
+
+template <typename MultiPolygon>
+struct area_parallel<MultiPolygon, multi_polygon_tag>
+    : area_parallel_rings<MultiPolygon>
+{};
+
+}} // namespace detail::area
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace resolve_strategy
+{
+
+template
+<
+    typename Strategy,
+    bool IsUmbrella = strategies::detail::is_umbrella_strategy<Strategy>::value
+>
+struct area_parallel
+{
+    template <typename Geometry>
+    static inline typename area_result<Geometry, Strategy>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          parallel_execution const& policy)
+    {
+        return detail::area::area_parallel
+            <
+                Geometry
+            >::apply(geometry, strategy, policy);
+    }
+};
+
+template <typename Strategy>
+struct area_parallel<Strategy, false>
+{
+    template <typename Geometry>
+    static auto apply(Geometry const& geometry, Strategy const& strategy,
+                      parallel_execution const& policy)
+    {
+        using strategies::area::services::strategy_converter;
+        return detail::area::area_parallel
+            <
+                Geometry
+            >::apply(geometry, strategy_converter<Strategy>::get(strategy), policy);
+    }
+};
+
+template <>
+struct area_parallel<default_strategy, false>
+{
+    template <typename Geometry>
+    static inline typename area_result<Geometry>::type
+    apply(Geometry const& geometry, default_strategy,
+          parallel_execution const& policy)
+    {
+        typedef typename strategies::area::services::default_strategy
+            <
+                Geometry
+            >::type strategy_type;
+
+        return detail::area::area_parallel
+            <
+                Geometry
+            >::apply(geometry, strategy_type(), policy);
+    }
+};
+
+} // namespace resolve_strategy
+
+
+namespace resolve_dynamic
+{
+
+// Dynamic geometries and geometry collections are calculated sequentially
+template <typename Geometry, typename Tag = typename geometry::tag<Geometry>::type>
+struct area_parallel
+{
+    template <typename Strategy>
+    static inline typename area_result<Geometry, Strategy>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          parallel_execution const& policy)
+    {
+        return resolve_strategy::area_parallel
+            <
+                Strategy
+            >::apply(geometry, strategy, policy);
+    }
+};
+
+template <typename Geometry>
+struct area_parallel<Geometry, dynamic_geometry_tag>
+{
+    template <typename Strategy>
+    static inline typename area_result<Geometry, Strategy>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          parallel_execution const& )
+    {
+        return area<Geometry>::apply(geometry, strategy);
+    }
+};
+
+template <typename Geometry>
+struct area_parallel<Geometry, geometry_collection_tag>
+{
+    template <typename Strategy>
+    static inline typename area_result<Geometry, Strategy>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          parallel_execution const& )
+    {
+        return area<Geometry>::apply(geometry, strategy);
+    }
+};
+
+} // namespace resolve_dynamic
+
+
+/*!
+\brief \brief_calc{area}, the work is split among threads
+\ingroup area
+\details The rings of polygons and multipolygons, and blocks of segments
+    of large rings, are calculated concurrently. The results are summed
+    with compensation of rounding errors, in an order independent on the
+    number of threads, so the result is the same for any number of threads.
+    It may differ slightly from the result of the sequential algorithm.
+    Other geometries are calculated sequentially.
+\tparam Geometry \tparam_geometry
+\param policy the parallel execution policy
+\param geometry \param_geometry
+\return \return_calc{area}
+
+\qbk{distinguish,parallel}
+*/
+template <typename Geometry>
+inline typename area_result<Geometry>::type
+area(parallel_execution const& policy, Geometry const& geometry)
+{
+    concepts::check<Geometry const>();
+
+    return resolve_dynamic::area_parallel
+        <
+            Geometry
+        >::apply(geometry, default_strategy(), policy);
+}
+
+/*!
+\brief \brief_calc{area} \brief_strategy, the work is split among threads
+\ingroup area
+\details \details_calc{area} \brief_strategy. The rings are calculated
+    concurrently as by area with the parallel execution policy.
+\tparam Geometry \tparam_geometry
+\tparam Strategy \tparam_strategy{Area}
+\param policy the parallel execution policy
+\param geometry \param_geometry
+\param strategy \param_strategy{area}
+\return \return_calc{area}
+
+\qbk{distinguish,parallel with strategy}
+*/
+template <typename Geometry, typename Strategy>
+inline typename area_result<Geometry, Strategy>::type
+area(parallel_execution const& policy, Geometry const& geometry,
+     Strategy const& strategy)
+{
+    concepts::check<Geometry const>();
+
+    return resolve_dynamic::area_parallel
+        <
+            Geometry
+        >::apply(geometry, strategy, policy);
+}
+
+
 }} // namespace boost::geometry
 
 
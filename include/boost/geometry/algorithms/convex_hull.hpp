@@ -23,5 +23,6 @@
 
 #include <boost/geometry/algorithms/detail/convex_hull/interface.hpp>
 #include <boost/geometry/algorithms/detail/convex_hull/graham_andrew.hpp>
+#include <boost/geometry/algorithms/detail/convex_hull/parallel.hpp>
 
 #endif // BOOST_GEOMETRY_ALGORITHMS_CONVEX_HULL_HPP
@@ -10,14 +10,19 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_FEATURE_POINT_TO_RANGE_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_FEATURE_POINT_TO_RANGE_HPP
 
+#include <cstddef>
+#include <type_traits>
 #include <utility>
 
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 #include <boost/range/size.hpp>
 
+#include <boost/geometry/algorithms/detail/distance/projected_point_block.hpp>
+#include <boost/geometry/core/access.hpp>
 #include <boost/geometry/core/assert.hpp>
 #include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
 #include <boost/geometry/strategies/distance.hpp>
 #include <boost/geometry/util/math.hpp>
 
@@ -43,6 +48,29 @@ class point_to_point_range
 protected:
     typedef typename boost::range_iterator<Range const>::type iterator_type;
 
+    // Contiguous double or float coordinates with the cartesian comparable
+    // strategy are processed by the (vectorized) block kernel
+    template <typename Strategy, typename Distance>
+    static inline void apply(Point const& point,
+                             iterator_type first,
+                             iterator_type last,
+                             Strategy const& ,
+                             iterator_type& it_min1,
+                             iterator_type& it_min2,
+                             Distance& dist_min,
+                             std::true_type /*use_block*/)
+    {
+        double d = 0;
+        std::size_t const i = detail::distance::nearest_segment(
+                                    double(geometry::get<0>(point)),
+                                    double(geometry::get<1>(point)),
+                                    detail::distance::block_coordinates(first),
+                                    std::size_t(last - first), d);
+        dist_min = Distance(d);
+        it_min1 = it_min2 = first + i;
+        ++it_min2;
+    }
+
     template <typename Strategy, typename Distance>
     static inline void apply(Point const& point,
                              iterator_type first,
@@ -65,6 +93,23 @@ protected:
             return;
         }
 
+        typedef std::integral_constant
+            <
+                bool,
+                detail::distance::use_projected_point_block
+                    <
+                        iterator_type, Strategy
+                    >::value
+                && geometry::dimension<Point>::value == 2
+            > use_block;
+
+        if (use_block::value)
+        {
+            apply(point, first, last, strategy, it_min1, it_min2, dist_min,
+                  use_block());
+            return;
+        }
+
         // start with first segment distance
         dist_min = strategy.apply(point, *prev, *it);
         iterator_type prev_min_dist = prev;
@@ -94,6 +139,17 @@ protected:
         ++it_min2;
     }
 
+    template <typename Strategy, typename Distance>
+    static inline void apply(Point const& ,
+                             iterator_type ,
+                             iterator_type ,
+                             Strategy const& ,
+                             iterator_type& ,
+                             iterator_type& ,
+                             Distance& ,
+                             std::false_type /*use_block*/)
+    {}
+
 public:
     typedef typename std::pair<iterator_type, iterator_type> return_type;
 
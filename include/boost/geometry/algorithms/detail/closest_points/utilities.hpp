@@ -10,7 +10,9 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_POINTS_UTILITIES_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_CLOSEST_POINTS_UTILITIES_HPP
 
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
 #include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/util/algorithm.hpp>
 
 namespace boost { namespace geometry
 {
@@ -20,8 +22,8 @@ namespace detail { namespace closest_points
 
 struct set_segment_from_points
 {
-    template <typename Point, typename Segment>
-    static inline void apply(Point const& p1, Point const& p2, Segment& segment)
+    template <typename Point1, typename Point2, typename Segment>
+    static inline void apply(Point1 const& p1, Point2 const& p2, Segment& segment)
     {
         assign_point_to_index<0>(p1, segment);
         assign_point_to_index<1>(p2, segment);
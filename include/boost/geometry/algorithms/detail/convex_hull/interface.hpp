@@ -51,6 +51,7 @@
 #include <boost/geometry/strategies/default_strategy.hpp>
 
 #include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/parallel.hpp>
 #include <boost/geometry/util/range.hpp>
 #include <boost/geometry/util/sequence.hpp>
 #include <boost/geometry/util/type_traits.hpp>
@@ -579,7 +580,11 @@ struct convex_hull<Geometry, dynamic_geometry_tag>
 
 \qbk{[include reference/algorithms/convex_hull.qbk]}
  */
-template<typename Geometry, typename OutputGeometry, typename Strategy>
+template
+<
+    typename Geometry, typename OutputGeometry, typename Strategy,
+    std::enable_if_t<! detail::parallel::is_execution_policy<Geometry>::value, int> = 0
+>
 inline void convex_hull(Geometry const& geometry, OutputGeometry& out, Strategy const& strategy)
 {
     if (geometry::is_empty(geometry))
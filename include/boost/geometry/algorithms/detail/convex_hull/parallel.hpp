@@ -0,0 +1,501 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_CONVEX_HULL_PARALLEL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_CONVEX_HULL_PARALLEL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/detail/convex_hull/graham_andrew.hpp>
+#include <boost/geometry/algorithms/detail/convex_hull/interface.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/multi_point.hpp>
+#include <boost/geometry/geometries/ring.hpp>
+
+#include <boost/geometry/strategies/default_strategy.hpp>
+
+#include <boost/geometry/util/parallel.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace convex_hull
+{
+
+
+// The extreme points of a point set in eight directions, forming the
+// Akl-Toussaint octagon. The points strictly inside of it are not
+// vertices of the convex hull. It is used in the cartesian system only.
+template <typename Point>
+class akl_toussaint_octagon
+{
+    typedef typename geometry::coordinate_type<Point>::type coordinate_type;
+
+public:
+    akl_toussaint_octagon()
+        : m_empty(true)
+        , m_count(0)
+    {}
+
+    inline void expand(Point const& point)
+    {
+        for (std::size_t i = 0; i < 8; i++)
+        {
+            if (m_empty || value(m_extremes[i], i) < value(point, i))
+            {
+                m_extremes[i] = point;
+            }
+        }
+        m_empty = false;
+    }
+
+    inline void expand(akl_toussaint_octagon const& other)
+    {
+        if (other.m_empty)
+        {
+            return;
+        }
+        for (std::size_t i = 0; i < 8; i++)
+        {
+            if (m_empty || value(m_extremes[i], i) < value(other.m_extremes[i], i))
+            {
+                m_extremes[i] = other.m_extremes[i];
+            }
+        }
+        m_empty = false;
+    }
+
+    // Builds the polygon of the distinct extremes, in counterclockwise order
+    inline void finish()
+    {
+        m_count = 0;
+        if (m_empty)
+        {
+            return;
+        }
+        for (std::size_t i = 0; i < 8; i++)
+        {
+            if (m_count == 0 || ! equals(m_polygon[m_count - 1], m_extremes[i]))
+            {
+                m_polygon[m_count++] = m_extremes[i];
+            }
+        }
+        if (m_count > 1 && equals(m_polygon[m_count - 1], m_polygon[0]))
+        {
+            m_count--;
+        }
+    }
+
+    // Returns true if the point is strictly inside of the octagon
+    template <typename SideStrategy>
+    inline bool covers_strictly(Point const& point, SideStrategy const& side) const
+    {
+        if (m_count < 3)
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < m_count; i++)
+        {
+            if (side.apply(m_polygon[i], m_polygon[(i + 1) % m_count], point) <= 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    // The coordinate of the point in the direction, counterclockwise
+    // starting with the bottom
+    static inline coordinate_type value(Point const& point, std::size_t direction)
+    {
+        coordinate_type const x = geometry::get<0>(point);
+        coordinate_type const y = geometry::get<1>(point);
+        switch (direction)
+        {
+            case 0 : return -y;
+            case 1 : return x - y;
+            case 2 : return x;
+            case 3 : return x + y;
+            case 4 : return y;
+            case 5 : return y - x;
+            case 6 : return -x;
+            default : return -x - y;
+        }
+    }
+
+    static inline bool equals(Point const& p1, Point const& p2)
+    {
+        return geometry::get<0>(p1) == geometry::get<0>(p2)
+            && geometry::get<1>(p1) == geometry::get<1>(p2);
+    }
+
+    std::array<Point, 8> m_extremes;
+    bool m_empty;
+    std::array<Point, 8> m_polygon;
+    std::size_t m_count;
+};
+
+
+template <typename Point>
+struct use_octagon_filter
+    : std::is_same<typename cs_tag<Point>::type, cartesian_tag>
+{};
+
+
+// Range of points passed to graham_andrew
+template <typename Range>
+struct input_range_proxy
+{
+    input_range_proxy(Range const& range)
+        : m_range(range)
+    {}
+
+    template <typename UnaryFunction>
+    inline void for_each_range(UnaryFunction fun) const
+    {
+        fun(m_range);
+    }
+
+    Range const& m_range;
+};
+
+
+// Appends the vertices of the convex hull of the points to the output,
+// the closing point is not appended
+template <typename Points, typename Output, typename Strategy>
+inline void append_hull_vertices(Points const& points, Output& output,
+                                 Strategy const& strategy)
+{
+    typedef typename boost::range_value<Points>::type point_type;
+
+    if (boost::empty(points))
+    {
+        return;
+    }
+
+    model::ring<point_type, true, false> hull;
+    graham_andrew<point_type>::apply(input_range_proxy<Points>(points),
+                                     hull, strategy);
+    output.insert(output.end(), hull.begin(), hull.end());
+}
+
+
+// Convex hull of a random access range of points, the octagon filter
+// is applied and the hulls of the chunks are computed concurrently
+struct convex_hull_points_parallel
+{
+    template <typename Range, typename OutputGeometry, typename Strategy>
+    static inline void apply(Range const& range, OutputGeometry& out,
+                             Strategy const& strategy,
+                             parallel_execution const& policy)
+    {
+        typedef typename geometry::point_type<Range>::type point_type;
+
+        std::size_t const size = boost::size(range);
+        std::size_t const workers = detail::parallel::worker_count(policy, size);
+        // A few chunks per worker, but not too small
+        std::size_t const chunk_size = (std::max)(size / (workers * 4),
+                                                  std::size_t(4096));
+        std::size_t const chunks = (size + chunk_size - 1) / chunk_size;
+
+        auto const chunk_begin = [&](std::size_t i)
+        {
+            return boost::begin(range) + (std::min)(i * chunk_size, size);
+        };
+
+        auto const side = strategy.side();
+
+        akl_toussaint_octagon<point_type> octagon;
+        if (use_octagon_filter<point_type>::value)
+        {
+            std::vector<akl_toussaint_octagon<point_type> > octagons(chunks);
+            detail::parallel::for_each_index(policy, chunks,
+                [&](std::size_t i, std::size_t )
+                {
+                    for (auto it = chunk_begin(i); it != chunk_begin(i + 1); ++it)
+                    {
+                        octagons[i].expand(*it);
+                    }
+                });
+            for (auto const& o : octagons)
+            {
+                octagon.expand(o);
+            }
+            octagon.finish();
+        }
+
+        std::vector<std::vector<point_type> > hulls(chunks);
+        detail::parallel::for_each_index(policy, chunks,
+            [&](std::size_t i, std::size_t )
+            {
+                std::vector<point_type> points;
+                for (auto it = chunk_begin(i); it != chunk_begin(i + 1); ++it)
+                {
+                    if (! octagon.covers_strictly(*it, side))
+                    {
+                        points.push_back(*it);
+                    }
+                }
+                append_hull_vertices(points, hulls[i], strategy);
+            });
+
+        // The hull of the vertices of the partial hulls is the hull
+        // of all points
+        model::multi_point<point_type> vertices;
+        for (auto const& hull : hulls)
+        {
+            vertices.insert(vertices.end(), hull.begin(), hull.end());
+        }
+
+        dispatch::convex_hull_out<OutputGeometry>::apply(vertices, out, strategy);
+    }
+};
+
+
+template
+<
+    typename Geometry,
+    typename Tag = typename tag<Geometry>::type
+>
+struct convex_hull_parallel
+{
+    template <typename OutputGeometry, typename Strategy>
+    static inline void apply(Geometry const& geometry, OutputGeometry& out,
+                             Strategy const& strategy,
+                             parallel_execution const& )
+    {
+        dispatch::convex_hull_out<OutputGeometry>::apply(geometry, out, strategy);
+    }
+};
+
+template <typename MultiPoint>
+struct convex_hull_parallel<MultiPoint, multi_point_tag>
+    : convex_hull_points_parallel
+{};
+
+template <typename Linestring>
+struct convex_hull_parallel<Linestring, linestring_tag>
+    : convex_hull_points_parallel
+{};
+
+template <typename Ring>
+struct convex_hull_parallel<Ring, ring_tag>
+    : convex_hull_points_parallel
+{};
+
+
+template <typename Strategy>
+struct convex_hull_parallel_strategy
+{
+    template <typename Geometry, typename OutputGeometry>
+    static inline void apply(Geometry const& geometry, OutputGeometry& out,
+                             Strategy const& strategy,
+                             parallel_execution const& policy)
+    {
+        convex_hull_parallel<Geometry>::apply(geometry, out, strategy, policy);
+    }
+};
+
+template <>
+struct convex_hull_parallel_strategy<geometry::default_strategy>
+{
+    template <typename Geometry, typename OutputGeometry>
+    static inline void apply(Geometry const& geometry, OutputGeometry& out,
+                             geometry::default_strategy const& ,
+                             parallel_execution const& policy)
+    {
+        using strategy_type = typename detail::convex_hull::default_strategy
+            <
+                Geometry
+            >::type;
+
+        convex_hull_parallel<Geometry>::apply(geometry, out, strategy_type(),
+                                              policy);
+    }
+};
+
+
+}} // namespace detail::convex_hull
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief \brief_calc{convex hull} \brief_strategy, concurrently
+\ingroup convex_hull
+\details The points of multi points, linestrings and rings strictly inside
+    of the octagon of their extremes (the Akl-Toussaint heuristic) are
+    discarded, in the cartesian coordinate system. Then the convex hulls
+    of chunks of the remaining points are calculated concurrently and
+    merged. The result is the same as the result of convex_hull. The hulls
+    of other geometries are calculated sequentially.
+\tparam Geometry the input geometry type
+\tparam OutputGeometry the output geometry type
+\tparam Strategy the strategy type
+\param policy the parallel execution policy
+\param geometry \param_geometry,  input geometry
+\param out \param_geometry \param_set{convex hull}
+\param strategy \param_strategy{area}
+ */
+template<typename Geometry, typename OutputGeometry, typename Strategy>
+inline void convex_hull(parallel_execution const& policy,
+                        Geometry const& geometry, OutputGeometry& out,
+                        Strategy const& strategy)
+{
+    concepts::check_concepts_and_equal_dimensions
+        <
+            const Geometry,
+            OutputGeometry
+        >();
+
+    if (geometry::is_empty(geometry))
+    {
+        // Leave output empty
+        return;
+    }
+
+    detail::convex_hull::convex_hull_parallel_strategy
+        <
+            Strategy
+        >::apply(geometry, out, strategy, policy);
+}
+
+/*!
+\brief \brief_calc{convex hull}, concurrently
+\ingroup convex_hull
+\details \details_calc{convex_hull,convex hull}.
+\tparam Geometry the input geometry type
+\tparam OutputGeometry the output geometry type
+\param policy the parallel execution policy
+\param geometry \param_geometry,  input geometry
+\param hull \param_geometry \param_set{convex hull}
+ */
+template<typename Geometry, typename OutputGeometry>
+inline void convex_hull(parallel_execution const& policy,
+                        Geometry const& geometry, OutputGeometry& hull)
+{
+    geometry::convex_hull(policy, geometry, hull, default_strategy());
+}
+
+
+/*!
+\brief Convex hull of a stream of points
+\ingroup convex_hull
+\details The points are added one by one, e.g. read from an input iterator,
+    without keeping all of them. The added points are collected in a block
+    which is replaced by the vertices of its convex hull when it is full.
+    In the cartesian coordinate system the points strictly inside of the
+    octagon of the extremes of the last hull are discarded immediately.
+\tparam Point the point type
+\tparam Strategy the convex hull strategy type
+ */
+template
+<
+    typename Point,
+    typename Strategy = typename detail::convex_hull::default_strategy
+        <
+            model::multi_point<Point>
+        >::type
+>
+class convex_hull_stream
+{
+public:
+    typedef Strategy strategy_type;
+
+    //! \param strategy the convex hull strategy
+    //! \param block_size the number of points collected before
+    //!     the hull is calculated
+    explicit convex_hull_stream(Strategy const& strategy = Strategy(),
+                                std::size_t block_size = 65536)
+        : m_strategy(strategy)
+        , m_block_size(block_size)
+        , m_hull_size(0)
+    {}
+
+    inline void add(Point const& point)
+    {
+        if (m_octagon.covers_strictly(point, m_strategy.side()))
+        {
+            return;
+        }
+        m_points.push_back(point);
+        if (m_points.size() >= m_hull_size + m_block_size)
+        {
+            reduce();
+        }
+    }
+
+    template <typename InputIterator>
+    inline void add(InputIterator first, InputIterator last)
+    {
+        for (; first != last; ++first)
+        {
+            add(*first);
+        }
+    }
+
+    //! Assigns the convex hull of the added points to the output geometry,
+    //! nothing is assigned if no point was added
+    template <typename OutputGeometry>
+    inline void hull(OutputGeometry& out) const
+    {
+        if (m_points.empty())
+        {
+            return;
+        }
+        dispatch::convex_hull_out<OutputGeometry>::apply(m_points, out, m_strategy);
+    }
+
+private:
+    inline void reduce()
+    {
+        model::multi_point<Point> vertices;
+        detail::convex_hull::append_hull_vertices(m_points, vertices, m_strategy);
+        m_points = std::move(vertices);
+        m_hull_size = m_points.size();
+
+        if (detail::convex_hull::use_octagon_filter<Point>::value)
+        {
+            detail::convex_hull::akl_toussaint_octagon<Point> octagon;
+            for (auto const& point : m_points)
+            {
+                octagon.expand(point);
+            }
+            octagon.finish();
+            m_octagon = octagon;
+        }
+    }
+
+    Strategy m_strategy;
+    std::size_t m_block_size;
+    std::size_t m_hull_size;
+    model::multi_point<Point> m_points;
+    detail::convex_hull::akl_toussaint_octagon<Point> m_octagon;
+};
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_CONVEX_HULL_PARALLEL_HPP
@@ -0,0 +1,445 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_DISTANCE_PROJECTED_POINT_BLOCK_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_DISTANCE_PROJECTED_POINT_BLOCK_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/strategies/cartesian/distance_projected_point.hpp>
+#include <boost/geometry/strategies/cartesian/distance_pythagoras.hpp>
+
+// The kernels use AVX or SSE2 if the compiler targets them, unless
+// BOOST_GEOMETRY_DISABLE_SIMD is defined
+#if ! defined(BOOST_GEOMETRY_DISABLE_SIMD)
+#if defined(__AVX__)
+#define BOOST_GEOMETRY_DETAIL_SIMD_AVX
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BOOST_GEOMETRY_DETAIL_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace distance
+{
+
+
+// The coordinate type of points stored as two contiguous coordinates,
+// void for other points
+template <typename Point>
+struct block_coordinate
+{
+    typedef void type;
+    static const bool is_contiguous = false;
+};
+
+template <typename T>
+struct block_coordinate<model::point<T, 2, cs::cartesian> >
+{
+    typedef T type;
+    static const bool is_contiguous
+        = sizeof(model::point<T, 2, cs::cartesian>) == 2 * sizeof(T);
+};
+
+template <typename T>
+struct block_coordinate<model::d2::point_xy<T, cs::cartesian> >
+{
+    typedef T type;
+    static const bool is_contiguous
+        = sizeof(model::d2::point_xy<T, cs::cartesian>) == 2 * sizeof(T);
+};
+
+
+// Checks if the points of the iterator are contiguous, double or float,
+// coordinates and the strategy is the comparable projected point strategy,
+// calculating in double, so the block kernels can be used
+template <typename Iterator, typename Strategy>
+struct use_projected_point_block
+{
+    typedef typename std::iterator_traits<Iterator>::value_type point_type;
+    typedef typename block_coordinate<point_type>::type coordinate_type;
+
+    static const bool value =
+        (std::is_same<coordinate_type, double>::value
+         || std::is_same<coordinate_type, float>::value)
+        && block_coordinate<point_type>::is_contiguous
+        && (std::is_pointer<Iterator>::value
+            || std::is_same<Iterator, typename std::vector<point_type>::const_iterator>::value
+            || std::is_same<Iterator, typename std::vector<point_type>::iterator>::value)
+        && std::is_same
+            <
+                Strategy,
+                strategy::distance::projected_point
+                    <
+                        void, strategy::distance::comparable::pythagoras<void>
+                    >
+            >::value;
+};
+
+
+template <typename Iterator>
+inline auto block_coordinates(Iterator it)
+{
+    typedef typename std::iterator_traits<Iterator>::value_type point_type;
+    typedef typename block_coordinate<point_type>::type coordinate_type;
+    return reinterpret_cast<coordinate_type const*>(std::addressof(*it));
+}
+
+
+// Comparable distance of point p to segment p1-p2, calculated in the same
+// way as the projected point strategy does
+inline double projected_point_cdistance(double px, double py,
+                                        double x1, double y1,
+                                        double x2, double y2)
+{
+    double const vx = x2 - x1;
+    double const vy = y2 - y1;
+    double const wx = px - x1;
+    double const wy = py - y1;
+    double const c1 = wx * vx + wy * vy;
+    if (c1 <= 0)
+    {
+        return wx * wx + wy * wy;
+    }
+    double const c2 = vx * vx + vy * vy;
+    if (c2 <= c1)
+    {
+        double const dx = px - x2;
+        double const dy = py - y2;
+        return dx * dx + dy * dy;
+    }
+    double const b = c1 / c2;
+    double const dx = px - (x1 + vx * b);
+    double const dy = py - (y1 + vy * b);
+    return dx * dx + dy * dy;
+}
+
+
+#if defined(BOOST_GEOMETRY_DETAIL_SIMD_AVX)
+
+inline __m256d load4(double const* p)
+{
+    return _mm256_loadu_pd(p);
+}
+
+inline __m256d load4(float const* p)
+{
+    return _mm256_cvtps_pd(_mm_loadu_ps(p));
+}
+
+// Lane-wise projected_point_cdistance
+inline __m256d projected_point_cdistance(__m256d px, __m256d py,
+                                         __m256d x1, __m256d y1,
+                                         __m256d x2, __m256d y2)
+{
+    __m256d const zero = _mm256_setzero_pd();
+    __m256d const vx = _mm256_sub_pd(x2, x1);
+    __m256d const vy = _mm256_sub_pd(y2, y1);
+    __m256d const wx = _mm256_sub_pd(px, x1);
+    __m256d const wy = _mm256_sub_pd(py, y1);
+    __m256d const c1 = _mm256_add_pd(_mm256_mul_pd(wx, vx), _mm256_mul_pd(wy, vy));
+    __m256d const c2 = _mm256_add_pd(_mm256_mul_pd(vx, vx), _mm256_mul_pd(vy, vy));
+    __m256d const b = _mm256_div_pd(c1, c2);
+
+    __m256d const dx2 = _mm256_sub_pd(px, x2);
+    __m256d const dy2 = _mm256_sub_pd(py, y2);
+    __m256d const dxp = _mm256_sub_pd(px, _mm256_add_pd(x1, _mm256_mul_pd(vx, b)));
+    __m256d const dyp = _mm256_sub_pd(py, _mm256_add_pd(y1, _mm256_mul_pd(vy, b)));
+
+    __m256d const d1 = _mm256_add_pd(_mm256_mul_pd(wx, wx), _mm256_mul_pd(wy, wy));
+    __m256d const d2 = _mm256_add_pd(_mm256_mul_pd(dx2, dx2), _mm256_mul_pd(dy2, dy2));
+    __m256d const dp = _mm256_add_pd(_mm256_mul_pd(dxp, dxp), _mm256_mul_pd(dyp, dyp));
+
+    __m256d const result = _mm256_blendv_pd(dp, d2, _mm256_cmp_pd(c2, c1, _CMP_LE_OQ));
+    return _mm256_blendv_pd(result, d1, _mm256_cmp_pd(c1, zero, _CMP_LE_OQ));
+}
+
+// Loads the x and y coordinates of four points, in the order 0, 2, 1, 3
+template <typename T>
+inline void load_xy4(T const* xy, __m256d& x, __m256d& y)
+{
+    __m256d const a = load4(xy);
+    __m256d const b = load4(xy + 4);
+    x = _mm256_unpacklo_pd(a, b);
+    y = _mm256_unpackhi_pd(a, b);
+}
+
+#elif defined(BOOST_GEOMETRY_DETAIL_SIMD_SSE2)
+
+inline __m128d load2(double const* p)
+{
+    return _mm_loadu_pd(p);
+}
+
+inline __m128d load2(float const* p)
+{
+    return _mm_cvtps_pd(_mm_castsi128_ps(
+        _mm_loadl_epi64(reinterpret_cast<__m128i const*>(p))));
+}
+
+inline __m128d select(__m128d mask, __m128d if_true, __m128d if_false)
+{
+    return _mm_or_pd(_mm_and_pd(mask, if_true), _mm_andnot_pd(mask, if_false));
+}
+
+// Lane-wise projected_point_cdistance
+inline __m128d projected_point_cdistance(__m128d px, __m128d py,
+                                         __m128d x1, __m128d y1,
+                                         __m128d x2, __m128d y2)
+{
+    __m128d const zero = _mm_setzero_pd();
+    __m128d const vx = _mm_sub_pd(x2, x1);
+    __m128d const vy = _mm_sub_pd(y2, y1);
+    __m128d const wx = _mm_sub_pd(px, x1);
+    __m128d const wy = _mm_sub_pd(py, y1);
+    __m128d const c1 = _mm_add_pd(_mm_mul_pd(wx, vx), _mm_mul_pd(wy, vy));
+    __m128d const c2 = _mm_add_pd(_mm_mul_pd(vx, vx), _mm_mul_pd(vy, vy));
+    __m128d const b = _mm_div_pd(c1, c2);
+
+    __m128d const dx2 = _mm_sub_pd(px, x2);
+    __m128d const dy2 = _mm_sub_pd(py, y2);
+    __m128d const dxp = _mm_sub_pd(px, _mm_add_pd(x1, _mm_mul_pd(vx, b)));
+    __m128d const dyp = _mm_sub_pd(py, _mm_add_pd(y1, _mm_mul_pd(vy, b)));
+
+    __m128d const d1 = _mm_add_pd(_mm_mul_pd(wx, wx), _mm_mul_pd(wy, wy));
+    __m128d const d2 = _mm_add_pd(_mm_mul_pd(dx2, dx2), _mm_mul_pd(dy2, dy2));
+    __m128d const dp = _mm_add_pd(_mm_mul_pd(dxp, dxp), _mm_mul_pd(dyp, dyp));
+
+    __m128d const result = select(_mm_cmple_pd(c2, c1), d2, dp);
+    return select(_mm_cmple_pd(c1, zero), d1, result);
+}
+
+// Loads the x and y coordinates of two points
+template <typename T>
+inline void load_xy2(T const* xy, __m128d& x, __m128d& y)
+{
+    __m128d const a = load2(xy);
+    __m128d const b = load2(xy + 2);
+    x = _mm_unpacklo_pd(a, b);
+    y = _mm_unpackhi_pd(a, b);
+}
+
+#endif
+
+
+// Keeps the first minimal (or maximal) value of the lanes, or of a scalar
+struct block_extreme
+{
+    double value;
+    std::size_t index;
+
+    template <bool Max>
+    inline void add(double v, std::size_t i)
+    {
+        if (Max ? (value < v || (v == value && i < index))
+                : (v < value || (v == value && i < index)))
+        {
+            value = v;
+            index = i;
+        }
+    }
+};
+
+
+// Returns the index i of the first segment (i, i + 1) of the count points
+// at the contiguous coordinates xy with the minimal comparable distance
+template <typename T>
+inline std::size_t nearest_segment(double px, double py,
+                                   T const* xy, std::size_t count,
+                                   double& distance)
+{
+    // The first segment is the initial minimum, as in the strategy based
+    // loop, so an infinite or NaN distance is returned in the same way
+    block_extreme result{projected_point_cdistance(px, py, xy[0], xy[1],
+                                                   xy[2], xy[3]), 0};
+    std::size_t i = 1;
+
+#if defined(BOOST_GEOMETRY_DETAIL_SIMD_AVX)
+    if (count >= 6)
+    {
+        __m256d const vpx = _mm256_set1_pd(px);
+        __m256d const vpy = _mm256_set1_pd(py);
+        __m256d best = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+        __m256d best_index = _mm256_setzero_pd();
+        // the lanes contain the segments i, i + 2, i + 1, i + 3
+        __m256d index = _mm256_set_pd(4, 2, 3, 1);
+        __m256d const four = _mm256_set1_pd(4);
+        for (; i + 4 < count; i += 4)
+        {
+            __m256d x1, y1, x2, y2;
+            load_xy4(xy + 2 * i, x1, y1);
+            load_xy4(xy + 2 * i + 2, x2, y2);
+            __m256d const d = projected_point_cdistance(vpx, vpy, x1, y1, x2, y2);
+            __m256d const less = _mm256_cmp_pd(d, best, _CMP_LT_OQ);
+            best = _mm256_blendv_pd(best, d, less);
+            best_index = _mm256_blendv_pd(best_index, index, less);
+            index = _mm256_add_pd(index, four);
+        }
+        double values[4], indexes[4];
+        _mm256_storeu_pd(values, best);
+        _mm256_storeu_pd(indexes, best_index);
+        for (int lane = 0; lane < 4; lane++)
+        {
+            result.add<false>(values[lane], std::size_t(indexes[lane]));
+        }
+    }
+#elif defined(BOOST_GEOMETRY_DETAIL_SIMD_SSE2)
+    if (count >= 4)
+    {
+        __m128d const vpx = _mm_set1_pd(px);
+        __m128d const vpy = _mm_set1_pd(py);
+        __m128d best = _mm_set1_pd(std::numeric_limits<double>::infinity());
+        __m128d best_index = _mm_setzero_pd();
+        __m128d index = _mm_set_pd(2, 1);
+        __m128d const two = _mm_set1_pd(2);
+        for (; i + 2 < count; i += 2)
+        {
+            __m128d x1, y1, x2, y2;
+            load_xy2(xy + 2 * i, x1, y1);
+            load_xy2(xy + 2 * i + 2, x2, y2);
+            __m128d const d = projected_point_cdistance(vpx, vpy, x1, y1, x2, y2);
+            __m128d const less = _mm_cmplt_pd(d, best);
+            best = select(less, d, best);
+            best_index = select(less, index, best_index);
+            index = _mm_add_pd(index, two);
+        }
+        double values[2], indexes[2];
+        _mm_storeu_pd(values, best);
+        _mm_storeu_pd(indexes, best_index);
+        for (int lane = 0; lane < 2; lane++)
+        {
+            result.add<false>(values[lane], std::size_t(indexes[lane]));
+        }
+    }
+#endif
+
+    for (; i + 1 < count; i++)
+    {
+        double const d = projected_point_cdistance(px, py,
+                                                   xy[2 * i], xy[2 * i + 1],
+                                                   xy[2 * i + 2], xy[2 * i + 3]);
+        if (d < result.value)
+        {
+            result.value = d;
+            result.index = i;
+        }
+    }
+
+    distance = result.value;
+    return result.index;
+}
+
+
+// Returns the index of the first of the count points at the contiguous
+// coordinates xy with the maximal comparable distance to segment p1-p2
+template <typename T>
+inline std::size_t farthest_point(double x1, double y1, double x2, double y2,
+                                  T const* xy, std::size_t count,
+                                  double& distance)
+{
+    block_extreme result{-1.0, count};
+    std::size_t i = 0;
+
+#if defined(BOOST_GEOMETRY_DETAIL_SIMD_AVX)
+    if (count >= 4)
+    {
+        __m256d const vx1 = _mm256_set1_pd(x1);
+        __m256d const vy1 = _mm256_set1_pd(y1);
+        __m256d const vx2 = _mm256_set1_pd(x2);
+        __m256d const vy2 = _mm256_set1_pd(y2);
+        __m256d best = _mm256_set1_pd(-1.0);
+        __m256d best_index = _mm256_setzero_pd();
+        // the lanes contain the points i, i + 2, i + 1, i + 3
+        __m256d index = _mm256_set_pd(3, 1, 2, 0);
+        __m256d const four = _mm256_set1_pd(4);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d px, py;
+            load_xy4(xy + 2 * i, px, py);
+            __m256d const d = projected_point_cdistance(px, py, vx1, vy1, vx2, vy2);
+            __m256d const greater = _mm256_cmp_pd(best, d, _CMP_LT_OQ);
+            best = _mm256_blendv_pd(best, d, greater);
+            best_index = _mm256_blendv_pd(best_index, index, greater);
+            index = _mm256_add_pd(index, four);
+        }
+        double values[4], indexes[4];
+        _mm256_storeu_pd(values, best);
+        _mm256_storeu_pd(indexes, best_index);
+        for (int lane = 0; lane < 4; lane++)
+        {
+            result.add<true>(values[lane], std::size_t(indexes[lane]));
+        }
+    }
+#elif defined(BOOST_GEOMETRY_DETAIL_SIMD_SSE2)
+    if (count >= 2)
+    {
+        __m128d const vx1 = _mm_set1_pd(x1);
+        __m128d const vy1 = _mm_set1_pd(y1);
+        __m128d const vx2 = _mm_set1_pd(x2);
+        __m128d const vy2 = _mm_set1_pd(y2);
+        __m128d best = _mm_set1_pd(-1.0);
+        __m128d best_index = _mm_setzero_pd();
+        __m128d index = _mm_set_pd(1, 0);
+        __m128d const two = _mm_set1_pd(2);
+        for (; i + 2 <= count; i += 2)
+        {
+            __m128d px, py;
+            load_xy2(xy + 2 * i, px, py);
+            __m128d const d = projected_point_cdistance(px, py, vx1, vy1, vx2, vy2);
+            __m128d const greater = _mm_cmplt_pd(best, d);
+            best = select(greater, d, best);
+            best_index = select(greater, index, best_index);
+            index = _mm_add_pd(index, two);
+        }
+        double values[2], indexes[2];
+        _mm_storeu_pd(values, best);
+        _mm_storeu_pd(indexes, best_index);
+        for (int lane = 0; lane < 2; lane++)
+        {
+            result.add<true>(values[lane], std::size_t(indexes[lane]));
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        double const d = projected_point_cdistance(xy[2 * i], xy[2 * i + 1],
+                                                   x1, y1, x2, y2);
+        if (result.value < d)
+        {
+            result.value = d;
+            result.index = i;
+        }
+    }
+
+    distance = result.value;
+    return result.index;
+}
+
+
+}} // namespace detail::distance
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_DISTANCE_PROJECTED_POINT_BLOCK_HPP
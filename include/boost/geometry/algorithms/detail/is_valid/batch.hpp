@@ -0,0 +1,385 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_BATCH_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_BATCH_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/detail/is_valid/buffers.hpp>
+#include <boost/geometry/algorithms/detail/is_valid/has_valid_self_turns.hpp>
+#include <boost/geometry/algorithms/detail/is_valid/interface.hpp>
+#include <boost/geometry/algorithms/validity_failure_type.hpp>
+
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/policies/is_valid/failure_type_policy.hpp>
+
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/detail.hpp>
+#include <boost/geometry/strategies/relate/services.hpp>
+
+#include <boost/geometry/util/parallel.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace is_valid
+{
+
+
+// The buffers reused in the checks of geometries of the same type
+template
+<
+    typename Geometry,
+    typename Strategy,
+    typename Tag = typename tag<Geometry>::type
+>
+struct batch_buffers
+{
+    typedef void type;
+};
+
+template <typename Geometry, typename Strategy>
+struct batch_buffers<Geometry, Strategy, ring_tag>
+{
+    typedef typename Strategy::cs_tag cs_tag;
+    typedef validity_buffers
+        <
+            typename has_valid_self_turns<Geometry, cs_tag>::turn_type,
+            cs_tag
+        > type;
+};
+
+template <typename Geometry, typename Strategy>
+struct batch_buffers<Geometry, Strategy, polygon_tag>
+    : batch_buffers<Geometry, Strategy, ring_tag>
+{};
+
+template <typename Geometry, typename Strategy>
+struct batch_buffers<Geometry, Strategy, multi_polygon_tag>
+    : batch_buffers<Geometry, Strategy, ring_tag>
+{};
+
+
+// Keeps the failure type, like failure_type_policy, and the buffers
+template <typename Buffers>
+class buffered_failure_type_policy
+{
+public:
+    typedef Buffers buffers_type;
+
+    inline void reset()
+    {
+        m_policy = failure_type_policy<>();
+    }
+
+    template <validity_failure_type Failure>
+    inline bool apply()
+    {
+        return m_policy.template apply<Failure>();
+    }
+
+    template <validity_failure_type Failure, typename Data>
+    inline bool apply(Data const& data)
+    {
+        return m_policy.template apply<Failure>(data);
+    }
+
+    template <validity_failure_type Failure, typename Data1, typename Data2>
+    inline bool apply(Data1 const& data1, Data2 const& data2)
+    {
+        return m_policy.template apply<Failure>(data1, data2);
+    }
+
+    inline validity_failure_type failure() const
+    {
+        return m_policy.failure();
+    }
+
+    inline buffers_type& buffers()
+    {
+        return m_buffers;
+    }
+
+private:
+    failure_type_policy<> m_policy;
+    buffers_type m_buffers;
+};
+
+template <>
+class buffered_failure_type_policy<void>
+    : public failure_type_policy<>
+{
+public:
+    inline void reset()
+    {
+        static_cast<failure_type_policy<>&>(*this) = failure_type_policy<>();
+    }
+};
+
+
+template
+<
+    typename Geometries,
+    typename RandomAccessIterator,
+    typename Strategy
+>
+inline std::size_t is_valid_batch(Geometries const& geometries,
+                                  RandomAccessIterator failures,
+                                  Strategy const& strategy,
+                                  parallel_execution const& policy)
+{
+    typedef typename boost::range_value<Geometries>::type geometry_type;
+    typedef typename boost::range_iterator<Geometries const>::type iterator_type;
+    typedef typename std::iterator_traits
+        <
+            RandomAccessIterator
+        >::value_type failure_value_type;
+    typedef buffered_failure_type_policy
+        <
+            typename batch_buffers<geometry_type, Strategy>::type
+        > visitor_type;
+
+    std::vector<iterator_type> items;
+    for (iterator_type it = boost::begin(geometries);
+         it != boost::end(geometries); ++it)
+    {
+        items.push_back(it);
+    }
+
+    // one visitor with its buffers and one counter per worker
+    std::size_t const workers = detail::parallel::worker_count(policy, items.size());
+    std::vector<visitor_type> visitors(workers);
+    std::vector<std::size_t> invalid_counts(workers, 0);
+
+    detail::parallel::for_each_index(policy, items.size(),
+        [&](std::size_t i, std::size_t worker)
+        {
+            visitor_type& visitor = visitors[worker];
+            visitor.reset();
+
+            resolve_dynamic::is_valid
+                <
+                    geometry_type
+                >::apply(*items[i], visitor, strategy);
+
+            failures[i] = static_cast<failure_value_type>(visitor.failure());
+            if (visitor.failure() != no_failure)
+            {
+                ++invalid_counts[worker];
+            }
+        });
+
+    std::size_t result = 0;
+    for (std::size_t count : invalid_counts)
+    {
+        result += count;
+    }
+    return result;
+}
+
+
+}} // namespace detail::is_valid
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace resolve_strategy
+{
+
+template
+<
+    typename Strategy,
+    bool IsUmbrella = strategies::detail::is_umbrella_strategy<Strategy>::value
+>
+struct is_valid_batch
+{
+    template <typename Geometries, typename RandomAccessIterator>
+    static inline std::size_t apply(Geometries const& geometries,
+                                    RandomAccessIterator failures,
+                                    Strategy const& strategy,
+                                    parallel_execution const& policy)
+    {
+        return detail::is_valid::is_valid_batch(geometries, failures,
+                                                strategy, policy);
+    }
+};
+
+template <typename Strategy>
+struct is_valid_batch<Strategy, false>
+{
+    template <typename Geometries, typename RandomAccessIterator>
+    static inline std::size_t apply(Geometries const& geometries,
+                                    RandomAccessIterator failures,
+                                    Strategy const& strategy,
+                                    parallel_execution const& policy)
+    {
+        using strategies::relate::services::strategy_converter;
+        return detail::is_valid::is_valid_batch(geometries, failures,
+                    strategy_converter<Strategy>::get(strategy), policy);
+    }
+};
+
+template <>
+struct is_valid_batch<default_strategy, false>
+{
+    // The strategy of dynamic geometries is resolved for each of them
+    template
+    <
+        typename Geometry,
+        typename Tag = typename tag<Geometry>::type
+    >
+    struct strategy_type
+    {
+        typedef typename strategies::relate::services::default_strategy
+            <
+                Geometry, Geometry
+            >::type type;
+    };
+
+    template <typename Geometry>
+    struct strategy_type<Geometry, dynamic_geometry_tag>
+    {
+        typedef default_strategy type;
+    };
+
+    template <typename Geometry>
+    struct strategy_type<Geometry, geometry_collection_tag>
+    {
+        typedef default_strategy type;
+    };
+
+    template <typename Geometries, typename RandomAccessIterator>
+    static inline std::size_t apply(Geometries const& geometries,
+                                    RandomAccessIterator failures,
+                                    default_strategy,
+                                    parallel_execution const& policy)
+    {
+        typedef typename strategy_type
+            <
+                typename boost::range_value<Geometries>::type
+            >::type strategy_t;
+
+        return detail::is_valid::is_valid_batch(geometries, failures,
+                                                strategy_t(), policy);
+    }
+};
+
+} // namespace resolve_strategy
+
+
+/*!
+\brief Checks the validity (in the OGC sense) of each geometry of a range
+\ingroup is_valid
+\details The geometries are checked concurrently and the internal buffers
+    are reused in the checks of subsequent geometries. For each geometry
+    the reason of the failure is written, the same as set by
+    is_valid(geometry, failure).
+\tparam Geometries \tparam_range{Geometries}
+\tparam RandomAccessIterator random access iterator to values of
+    validity_failure_type or of an integral type
+\tparam Strategy \tparam_strategy{Is_valid}
+\param policy the parallel execution policy
+\param geometries range of geometries
+\param failures the beginning of the range of the results, one for
+    each geometry
+\param strategy \param_strategy{is_valid}
+\return the number of invalid geometries
+
+\qbk{distinguish,parallel with strategy}
+*/
+template <typename Geometries, typename RandomAccessIterator, typename Strategy>
+inline std::size_t is_valid_batch(parallel_execution const& policy,
+                                  Geometries const& geometries,
+                                  RandomAccessIterator failures,
+                                  Strategy const& strategy)
+{
+    return resolve_strategy::is_valid_batch
+        <
+            Strategy
+        >::apply(geometries, failures, strategy, policy);
+}
+
+/*!
+\brief Checks the validity (in the OGC sense) of each geometry of a range
+\ingroup is_valid
+\tparam Geometries \tparam_range{Geometries}
+\tparam RandomAccessIterator random access iterator to values of
+    validity_failure_type or of an integral type
+\param policy the parallel execution policy
+\param geometries range of geometries
+\param failures the beginning of the range of the results, one for
+    each geometry
+\return the number of invalid geometries
+
+\qbk{distinguish,parallel}
+*/
+template <typename Geometries, typename RandomAccessIterator>
+inline std::size_t is_valid_batch(parallel_execution const& policy,
+                                  Geometries const& geometries,
+                                  RandomAccessIterator failures)
+{
+    return is_valid_batch(policy, geometries, failures, default_strategy());
+}
+
+/*!
+\brief Checks the validity (in the OGC sense) of each geometry of a range
+\ingroup is_valid
+\details The internal buffers are reused in the checks of subsequent
+    geometries.
+\tparam Geometries \tparam_range{Geometries}
+\tparam RandomAccessIterator random access iterator to values of
+    validity_failure_type or of an integral type
+\tparam Strategy \tparam_strategy{Is_valid}
+\param geometries range of geometries
+\param failures the beginning of the range of the results, one for
+    each geometry
+\param strategy \param_strategy{is_valid}
+\return the number of invalid geometries
+
+\qbk{distinguish,with strategy}
+*/
+template <typename Geometries, typename RandomAccessIterator, typename Strategy>
+inline std::size_t is_valid_batch(Geometries const& geometries,
+                                  RandomAccessIterator failures,
+                                  Strategy const& strategy)
+{
+    return is_valid_batch(parallel_execution(1), geometries, failures, strategy);
+}
+
+/*!
+\brief Checks the validity (in the OGC sense) of each geometry of a range
+\ingroup is_valid
+\tparam Geometries \tparam_range{Geometries}
+\tparam RandomAccessIterator random access iterator to values of
+    validity_failure_type or of an integral type
+\param geometries range of geometries
+\param failures the beginning of the range of the results, one for
+    each geometry
+\return the number of invalid geometries
+*/
+template <typename Geometries, typename RandomAccessIterator>
+inline std::size_t is_valid_batch(Geometries const& geometries,
+                                  RandomAccessIterator failures)
+{
+    return is_valid_batch(geometries, failures, default_strategy());
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_BATCH_HPP
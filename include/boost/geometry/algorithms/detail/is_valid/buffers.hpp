@@ -0,0 +1,200 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_BUFFERS_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_BUFFERS_HPP
+
+#include <cstddef>
+#include <deque>
+#include <type_traits>
+#include <vector>
+
+#include <boost/geometry/algorithms/detail/is_valid/complement_graph.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace is_valid
+{
+
+
+// Containers used by the validity checks of areal geometries, kept by
+// a visitor to reuse the allocated memory in subsequent checks.
+// A visitor owning buffers defines buffers_type and buffers().
+template <typename Turn, typename CSTag>
+class validity_buffers
+{
+public:
+    typedef std::vector<Turn> turns_type;
+    typedef complement_graph<typename Turn::point_type, CSTag> graph_type;
+
+    validity_buffers()
+        : m_graph(1)
+    {}
+
+    inline turns_type& turns()
+    {
+        m_turns.clear();
+        return m_turns;
+    }
+
+    inline graph_type& graph(std::size_t num_rings)
+    {
+        m_graph.clear(num_rings);
+        return m_graph;
+    }
+
+private:
+    turns_type m_turns;
+    graph_type m_graph;
+};
+
+
+template <typename T>
+struct void_type
+{
+    typedef void type;
+};
+
+template <typename VisitPolicy, typename Enable = void>
+struct visitor_buffers
+{
+    typedef void type;
+};
+
+template <typename VisitPolicy>
+struct visitor_buffers
+    <
+        VisitPolicy,
+        typename void_type<typename VisitPolicy::buffers_type>::type
+    >
+{
+    typedef typename VisitPolicy::buffers_type type;
+};
+
+
+template <typename Buffers, typename Turn>
+struct has_turns_buffer
+    : std::is_same<typename Buffers::turns_type::value_type, Turn>
+{};
+
+template <typename Turn>
+struct has_turns_buffer<void, Turn>
+    : std::false_type
+{};
+
+template <typename Buffers, typename Graph>
+struct has_graph_buffer
+    : std::is_same<typename Buffers::graph_type, Graph>
+{};
+
+template <typename Graph>
+struct has_graph_buffer<void, Graph>
+    : std::false_type
+{};
+
+
+// The container of turns, owned by the visitor if possible
+template
+<
+    typename VisitPolicy,
+    typename Turn,
+    bool UseBuffers = has_turns_buffer
+        <
+            typename visitor_buffers<VisitPolicy>::type, Turn
+        >::value
+>
+class turns_buffer
+{
+public:
+    typedef std::deque<Turn> type;
+
+    explicit turns_buffer(VisitPolicy& )
+    {}
+
+    inline type& get()
+    {
+        return m_turns;
+    }
+
+private:
+    type m_turns;
+};
+
+template <typename VisitPolicy, typename Turn>
+class turns_buffer<VisitPolicy, Turn, true>
+{
+public:
+    typedef typename visitor_buffers<VisitPolicy>::type::turns_type type;
+
+    explicit turns_buffer(VisitPolicy& visitor)
+        : m_turns(visitor.buffers().turns())
+    {}
+
+    inline type& get()
+    {
+        return m_turns;
+    }
+
+private:
+    type& m_turns;
+};
+
+
+// The complement graph, owned by the visitor if possible
+template
+<
+    typename VisitPolicy,
+    typename Graph,
+    bool UseBuffers = has_graph_buffer
+        <
+            typename visitor_buffers<VisitPolicy>::type, Graph
+        >::value
+>
+class graph_buffer
+{
+public:
+    graph_buffer(VisitPolicy& , std::size_t num_rings)
+        : m_graph(num_rings)
+    {}
+
+    inline Graph& get()
+    {
+        return m_graph;
+    }
+
+private:
+    Graph m_graph;
+};
+
+template <typename VisitPolicy, typename Graph>
+class graph_buffer<VisitPolicy, Graph, true>
+{
+public:
+    graph_buffer(VisitPolicy& visitor, std::size_t num_rings)
+        : m_graph(visitor.buffers().graph(num_rings))
+    {}
+
+    inline Graph& get()
+    {
+        return m_graph;
+    }
+
+private:
+    Graph& m_graph;
+};
+
+
+}} // namespace detail::is_valid
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_BUFFERS_HPP
@@ -14,7 +14,6 @@
 #include <cstddef>
 
 #include <set>
-#include <stack>
 #include <utility>
 #include <vector>
 
@@ -101,10 +100,13 @@ private:
     class has_cycles_dfs_data
     {
     public:
-        has_cycles_dfs_data(std::size_t num_nodes)
-            : m_visited(num_nodes, false)
-            , m_parent_id(num_nodes, -1)
-        {}
+        // initializes all vertices as non-visited and with no parent set,
+        // the memory allocated previously is reused
+        inline void reset(std::size_t num_nodes)
+        {
+            m_visited.assign(num_nodes, false);
+            m_parent_id.assign(num_nodes, -1);
+        }
 
         inline signed_size_type parent_id(vertex_handle v) const
         {
@@ -134,13 +136,14 @@ private:
     inline bool has_cycles(vertex_handle start_vertex,
                            has_cycles_dfs_data& data) const
     {
-        std::stack<vertex_handle> stack;
-        stack.push(start_vertex);
+        std::vector<vertex_handle>& stack = m_stack;
+        stack.clear();
+        stack.push_back(start_vertex);
 
         while ( !stack.empty() )
         {
-            vertex_handle v = stack.top();
-            stack.pop();
+            vertex_handle v = stack.back();
+            stack.pop_back();
 
             data.set_visited(v, true);
             for (typename neighbor_container::const_iterator nit
@@ -156,7 +159,7 @@ private:
                     else
                     {
                         data.set_parent_id(*nit, static_cast<signed_size_type>(v->id()));
-                        stack.push(*nit);
+                        stack.push_back(*nit);
                     }
                 }
             }
@@ -173,6 +176,17 @@ public:
         , m_neighbors(num_rings)
     {}
 
+    // removes all vertices and edges, the graph may then be reused for
+    // a polygon with num_rings rings
+    inline void clear(std::size_t num_rings)
+    {
+        m_num_rings = num_rings;
+        m_num_turns = 0;
+        m_vertices.clear();
+        m_neighbors.clear();
+        m_neighbors.resize(num_rings);
+    }
+
     // inserts a ring vertex in the graph and returns its handle
     // ring id's are zero-based (so the first interior ring has id 1)
     inline vertex_handle add_vertex(signed_size_type id)
@@ -208,8 +222,8 @@ public:
     inline bool has_cycles() const
     {
         // initialize all vertices as non-visited and with no parent set
-        // this is done by the constructor of has_cycles_dfs_data
-        has_cycles_dfs_data data(m_num_rings + m_num_turns);
+        has_cycles_dfs_data& data = m_dfs_data;
+        data.reset(m_num_rings + m_num_turns);
 
         // for each non-visited vertex, start a DFS from that vertex
         for (vertex_handle it = m_vertices.begin();
@@ -233,6 +247,10 @@ private:
     std::size_t m_num_rings, m_num_turns;
     vertex_container m_vertices;
     std::vector<neighbor_container> m_neighbors;
+
+    // buffers used by has_cycles()
+    mutable has_cycles_dfs_data m_dfs_data;
+    mutable std::vector<vertex_handle> m_stack;
 };
 
 
@@ -16,6 +16,7 @@
 #include <boost/core/ignore_unused.hpp>
 #include <boost/range/empty.hpp>
 
+#include <boost/geometry/algorithms/detail/is_valid/buffers.hpp>
 #include <boost/geometry/algorithms/detail/is_valid/is_acceptable_turn.hpp>
 #include <boost/geometry/algorithms/detail/overlay/get_turn_info.hpp>
 #include <boost/geometry/algorithms/detail/overlay/turn_info.hpp>
@@ -48,13 +49,13 @@ class has_valid_self_turns
 private:
     typedef typename point_type<Geometry>::type point_type;
 
+public:
     typedef typename geometry::rescale_policy_type
         <
             point_type,
             CSTag
         >::type rescale_policy_type;
 
-public:
     typedef detail::overlay::turn_info
         <
             point_type,
@@ -104,8 +105,8 @@ public:
     template <typename VisitPolicy, typename Strategy>
     static inline bool apply(Geometry const& geometry, VisitPolicy& visitor, Strategy const& strategy)
     {
-        std::vector<turn_type> turns;
-        return apply(geometry, turns, visitor, strategy);
+        turns_buffer<VisitPolicy, turn_type> buffer(visitor);
+        return apply(geometry, buffer.get(), visitor, strategy);
     }
 };
 
@@ -26,6 +26,7 @@
 #include <boost/geometry/strategies/default_strategy.hpp>
 #include <boost/geometry/strategies/detail.hpp>
 #include <boost/geometry/strategies/relate/services.hpp>
+#include <boost/geometry/util/parallel.hpp>
 
 
 namespace boost { namespace geometry
@@ -148,7 +149,11 @@ struct is_valid<Geometry, geometry_collection_tag>
 
 
 // Undocumented for now
-template <typename Geometry, typename VisitPolicy, typename Strategy>
+template
+<
+    typename Geometry, typename VisitPolicy, typename Strategy,
+    std::enable_if_t<! detail::parallel::is_execution_policy<Geometry>::value, int> = 0
+>
 inline bool is_valid(Geometry const& geometry,
                      VisitPolicy& visitor,
                      Strategy const& strategy)
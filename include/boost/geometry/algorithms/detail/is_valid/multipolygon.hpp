@@ -37,6 +37,7 @@
 #include <boost/geometry/algorithms/detail/check_iterator_range.hpp>
 #include <boost/geometry/algorithms/detail/partition.hpp>
 
+#include <boost/geometry/algorithms/detail/is_valid/buffers.hpp>
 #include <boost/geometry/algorithms/detail/is_valid/has_valid_self_turns.hpp>
 #include <boost/geometry/algorithms/detail/is_valid/is_acceptable_turn.hpp>
 #include <boost/geometry/algorithms/detail/is_valid/polygon.hpp>
@@ -307,7 +308,13 @@ public:
 
         typedef has_valid_self_turns<MultiPolygon, typename Strategy::cs_tag> has_valid_turns;
 
-        std::deque<typename has_valid_turns::turn_type> turns;
+        typedef turns_buffer
+            <
+                VisitPolicy, typename has_valid_turns::turn_type
+            > turns_buffer_type;
+
+        turns_buffer_type buffer(visitor);
+        typename turns_buffer_type::type& turns = buffer.get();
         bool has_invalid_turns =
             ! has_valid_turns::apply(multipolygon, turns, visitor, strategy);
         debug_print_turns(turns.begin(), turns.end());
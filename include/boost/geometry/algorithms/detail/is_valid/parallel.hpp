@@ -0,0 +1,832 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_PARALLEL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/empty.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/detail/assign_values.hpp>
+#include <boost/geometry/algorithms/detail/is_valid/debug_validity_phase.hpp>
+#include <boost/geometry/algorithms/detail/is_valid/has_valid_self_turns.hpp>
+#include <boost/geometry/algorithms/detail/is_valid/interface.hpp>
+#include <boost/geometry/algorithms/detail/is_valid/is_acceptable_turn.hpp>
+#include <boost/geometry/algorithms/detail/is_valid/multipolygon.hpp>
+#include <boost/geometry/algorithms/detail/is_valid/polygon.hpp>
+#include <boost/geometry/algorithms/detail/overlay/get_turn_info.hpp>
+#include <boost/geometry/algorithms/detail/overlay/self_turn_points.hpp>
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/validity_failure_type.hpp>
+
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/geometry/policies/is_valid/default_policy.hpp>
+#include <boost/geometry/policies/is_valid/failing_reason_policy.hpp>
+#include <boost/geometry/policies/is_valid/failure_type_policy.hpp>
+#include <boost/geometry/policies/predicate_based_interrupt_policy.hpp>
+#include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
+
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/detail.hpp>
+#include <boost/geometry/strategies/relate/services.hpp>
+
+#include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/parallel.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace is_valid
+{
+
+
+// Checks the validity of a multipolygon splitting the work among threads:
+// - the rings of the polygons are checked concurrently,
+// - the self turns of the polygons are computed concurrently, the turns
+//   between polygons are computed only for the pairs of polygons with
+//   intersecting envelopes, found with an rtree,
+// - the holes and the interiors of the polygons are checked concurrently,
+// - the interiors of polygons with intersecting envelopes, found with
+//   an rtree, are checked for overlap concurrently.
+// The concurrent checks are done with a policy rejecting any failure. The
+// checks which failed are then repeated sequentially with the visitor passed
+// by the user, in the order of is_valid_multipolygon, so the visitor reports
+// the same failure as the sequential algorithm.
+template <typename MultiPolygon, bool AllowEmptyMultiGeometries = true>
+class is_valid_multipolygon_parallel
+    : is_valid_polygon
+        <
+            typename boost::range_value<MultiPolygon>::type,
+            true // check only the validity of rings
+        >
+{
+private:
+    typedef is_valid_polygon
+        <
+            typename boost::range_value<MultiPolygon>::type,
+            true
+        > base;
+
+    typedef is_valid_multipolygon
+        <
+            MultiPolygon, AllowEmptyMultiGeometries
+        > sequential;
+
+    typedef typename boost::range_iterator
+        <
+            MultiPolygon const
+        >::type polygon_iterator;
+
+    // rejects all failures, used in the concurrent checks
+    typedef is_valid_default_policy<false, false> probe_policy;
+
+
+    // stops the partition of the sections when the turns of another
+    // polygon are found to be invalid
+    template <typename SectionVisitor>
+    struct interruptible_section_visitor
+    {
+        interruptible_section_visitor(SectionVisitor& visitor,
+                                      std::atomic<bool>& interrupted)
+            : m_visitor(visitor)
+            , m_interrupted(interrupted)
+        {}
+
+        template <typename Section>
+        inline bool apply(Section const& sec1, Section const& sec2)
+        {
+            if (m_interrupted.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+            if (! m_visitor.apply(sec1, sec2))
+            {
+                m_interrupted = true;
+                return false;
+            }
+            return true;
+        }
+
+        SectionVisitor& m_visitor;
+        std::atomic<bool>& m_interrupted;
+    };
+
+
+    template <typename VisitPolicy, typename Strategy>
+    static inline bool have_valid_rings(std::vector<polygon_iterator> const& polygons,
+                                        VisitPolicy& visitor,
+                                        Strategy const& strategy,
+                                        parallel_execution const& policy)
+    {
+        std::vector<char> invalid(polygons.size(), 0);
+
+        detail::parallel::for_each_index(policy, polygons.size(),
+            [&](std::size_t i, std::size_t)
+            {
+                probe_policy probe;
+                invalid[i] = ! base::apply(*polygons[i], probe, strategy);
+            });
+
+        for (std::size_t i = 0; i < polygons.size(); ++i)
+        {
+            if (invalid[i] && ! base::apply(*polygons[i], visitor, strategy))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+
+    // Computes the turns of each polygon with itself and with the polygons
+    // having greater indexes. Returns false if an invalid turn is found.
+    template <typename Turns, typename Strategy>
+    static inline bool compute_turns(MultiPolygon const& multipolygon,
+                                     std::vector<Turns>& self_turns,
+                                     std::vector<Turns>& cross_turns,
+                                     Strategy const& strategy,
+                                     parallel_execution const& policy)
+    {
+        typedef has_valid_self_turns
+            <
+                MultiPolygon, typename Strategy::cs_tag
+            > has_valid_turns;
+        typedef typename has_valid_turns::rescale_policy_type rescale_policy_type;
+
+        typedef model::box
+            <
+                typename geometry::robust_point_type
+                    <
+                        typename point_type<MultiPolygon>::type,
+                        rescale_policy_type
+                    >::type
+            > box_type;
+        typedef geometry::sections<box_type, 2> sections_type;
+        typedef typename boost::range_value<sections_type>::type section_type;
+        typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
+
+        typedef detail::overlay::get_turn_info
+            <
+                detail::overlay::assign_null_policy
+            > turn_policy;
+        typedef detail::overlay::stateless_predicate_based_interrupt_policy
+            <
+                is_acceptable_turn<MultiPolygon>
+            > interrupt_policy_type;
+        typedef detail::self_get_turn_points::self_section_visitor
+            <
+                false, MultiPolygon, Turns, turn_policy, Strategy,
+                rescale_policy_type, interrupt_policy_type
+            > section_visitor_type;
+
+        std::size_t const count = self_turns.size();
+
+        rescale_policy_type robust_policy
+            = geometry::get_rescale_policy<rescale_policy_type>(multipolygon, strategy);
+
+        // The sections of the multipolygon, the same as in self_turns,
+        // grouped by polygon
+        sections_type sections;
+        geometry::sectionalize<false, dimensions>(multipolygon, robust_policy,
+                                                  sections, strategy);
+
+        std::vector<std::vector<section_type> > polygon_sections(count);
+        for (section_type const& section : sections)
+        {
+            polygon_sections[section.ring_id.multi_index].push_back(section);
+        }
+
+        detail::section::get_section_box<Strategy> const get_box(strategy);
+        detail::section::overlaps_section_box<Strategy> const overlaps_box(strategy);
+
+        typedef std::pair<box_type, std::size_t> box_pair_type;
+        std::vector<box_type> polygon_boxes(count);
+        std::vector<box_pair_type> boxes;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (! polygon_sections[i].empty())
+            {
+                geometry::assign_inverse(polygon_boxes[i]);
+                for (section_type const& section : polygon_sections[i])
+                {
+                    get_box.apply(polygon_boxes[i], section);
+                }
+                boxes.push_back(box_pair_type(polygon_boxes[i], i));
+            }
+        }
+
+        typedef index::parameters<index::rstar<16>, Strategy> index_parameters_type;
+        index::rtree<box_pair_type, index_parameters_type>
+            rtree(boxes.begin(), boxes.end(),
+                  index_parameters_type(index::rstar<16>(), strategy));
+
+        std::atomic<bool> interrupted(false);
+
+        detail::parallel::for_each_index(policy, count,
+            [&](std::size_t i, std::size_t)
+            {
+                if (interrupted.load(std::memory_order_relaxed)
+                    || polygon_sections[i].empty())
+                {
+                    return;
+                }
+
+                interrupt_policy_type self_interrupt_policy;
+                section_visitor_type self_visitor(multipolygon, strategy,
+                                                  robust_policy, self_turns[i],
+                                                  self_interrupt_policy, 0, true);
+                interruptible_section_visitor<section_visitor_type>
+                    self_partition_visitor(self_visitor, interrupted);
+
+                geometry::partition
+                    <
+                        box_type
+                    >::apply(polygon_sections[i], self_partition_visitor,
+                             get_box, overlaps_box);
+
+                std::vector<box_pair_type> found;
+                rtree.query(index::intersects(polygon_boxes[i]),
+                            std::back_inserter(found));
+                std::sort(found.begin(), found.end(),
+                          [](box_pair_type const& left, box_pair_type const& right)
+                          {
+                              return left.second < right.second;
+                          });
+
+                interrupt_policy_type cross_interrupt_policy;
+                section_visitor_type cross_visitor(multipolygon, strategy,
+                                                   robust_policy, cross_turns[i],
+                                                   cross_interrupt_policy, 0, true);
+                interruptible_section_visitor<section_visitor_type>
+                    cross_partition_visitor(cross_visitor, interrupted);
+
+                for (box_pair_type const& pair : found)
+                {
+                    if (pair.second > i
+                        && ! geometry::partition
+                            <
+                                box_type
+                            >::apply(polygon_sections[i],
+                                     polygon_sections[pair.second],
+                                     cross_partition_visitor,
+                                     get_box, overlaps_box,
+                                     get_box, overlaps_box))
+                    {
+                        break;
+                    }
+                }
+
+                if (self_interrupt_policy.has_intersections
+                    || cross_interrupt_policy.has_intersections)
+                {
+                    interrupted = true;
+                }
+            });
+
+        return ! interrupted;
+    }
+
+
+    template
+    <
+        typename Predicate,
+        typename Turns,
+        typename VisitPolicy,
+        typename Strategy
+    >
+    static inline bool has_property_per_polygon(std::vector<polygon_iterator> const& polygons,
+                                                std::vector<char> const& invalid,
+                                                std::vector<Turns> const& self_turns,
+                                                VisitPolicy& visitor,
+                                                Strategy const& strategy)
+    {
+        for (std::size_t i = 0; i < polygons.size(); ++i)
+        {
+            if (invalid[i]
+                && ! Predicate::apply(*polygons[i],
+                                      self_turns[i].begin(),
+                                      self_turns[i].end(),
+                                      visitor,
+                                      strategy))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+
+    template <typename Turns>
+    static inline void mark_crossing_turns(Turns const& turns,
+                                           std::vector<char>& marks)
+    {
+        for (typename Turns::const_iterator it = turns.begin();
+             it != turns.end(); ++it)
+        {
+            if (! it->touch_only)
+            {
+                marks[it->operations[0].seg_id.multi_index] = 1;
+                marks[it->operations[1].seg_id.multi_index] = 1;
+            }
+        }
+    }
+
+
+    template <typename Turns, typename VisitPolicy, typename Strategy>
+    static inline
+    bool are_polygon_interiors_disjoint(std::vector<polygon_iterator> const& polygons,
+                                        std::vector<Turns> const& self_turns,
+                                        std::vector<Turns> const& cross_turns,
+                                        VisitPolicy& visitor,
+                                        Strategy const& strategy,
+                                        parallel_execution const& policy)
+    {
+        typedef geometry::model::box<typename point_type<MultiPolygon>::type> box_type;
+        typedef typename base::template partition_item<polygon_iterator, box_type> item_type;
+        typedef std::pair<box_type, std::size_t> box_pair_type;
+
+        std::size_t const count = polygons.size();
+
+        // mark all polygons that have crossing turns
+        std::vector<char> has_crossing_turns(count, 0);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            mark_crossing_turns(self_turns[i], has_crossing_turns);
+            mark_crossing_turns(cross_turns[i], has_crossing_turns);
+        }
+
+        std::vector<std::size_t> candidates;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (! has_crossing_turns[i])
+            {
+                candidates.push_back(i);
+            }
+        }
+
+        std::vector<box_pair_type> boxes(candidates.size());
+        detail::parallel::for_each_index(policy, candidates.size(),
+            [&](std::size_t k, std::size_t)
+            {
+                std::size_t const i = candidates[k];
+                boxes[k] = box_pair_type(geometry::return_envelope<box_type>(*polygons[i], strategy), i);
+            });
+
+        typedef index::parameters<index::rstar<16>, Strategy> index_parameters_type;
+        index::rtree<box_pair_type, index_parameters_type>
+            rtree(boxes.begin(), boxes.end(),
+                  index_parameters_type(index::rstar<16>(), strategy));
+
+        std::atomic<bool> items_overlap(false);
+
+        detail::parallel::for_each_index(policy, boxes.size(),
+            [&](std::size_t k, std::size_t)
+            {
+                if (items_overlap.load(std::memory_order_relaxed))
+                {
+                    return;
+                }
+
+                std::vector<box_pair_type> found;
+                rtree.query(index::intersects(boxes[k].first),
+                            std::back_inserter(found));
+
+                std::size_t const i = boxes[k].second;
+                item_type const item1(polygons[i]);
+                typename base::template item_visitor_type<Strategy> item_visitor(strategy);
+                for (box_pair_type const& pair : found)
+                {
+                    if (pair.second > i
+                        && ! item_visitor.apply(item1, item_type(polygons[pair.second])))
+                    {
+                        items_overlap = true;
+                        return;
+                    }
+                }
+            });
+
+        if (items_overlap)
+        {
+            return visitor.template apply<failure_intersecting_interiors>();
+        }
+        else
+        {
+            return visitor.template apply<no_failure>();
+        }
+    }
+
+public:
+    template <typename VisitPolicy, typename Strategy>
+    static inline bool apply(MultiPolygon const& multipolygon,
+                             VisitPolicy& visitor,
+                             Strategy const& strategy,
+                             parallel_execution const& policy)
+    {
+        typedef debug_validity_phase<MultiPolygon> debug_phase;
+
+        if (BOOST_GEOMETRY_CONDITION(AllowEmptyMultiGeometries)
+            && boost::empty(multipolygon))
+        {
+            return visitor.template apply<no_failure>();
+        }
+
+        std::vector<polygon_iterator> polygons;
+        for (polygon_iterator it = boost::begin(multipolygon);
+             it != boost::end(multipolygon); ++it)
+        {
+            polygons.push_back(it);
+        }
+
+        // check validity of all polygons ring
+        debug_phase::apply(1);
+
+        if (polygons.empty())
+        {
+            return sequential::apply(multipolygon, visitor, strategy);
+        }
+
+        if (! have_valid_rings(polygons, visitor, strategy, policy))
+        {
+            return false;
+        }
+
+
+        // compute turns and check if all are acceptable
+        debug_phase::apply(2);
+
+        typedef has_valid_self_turns<MultiPolygon, typename Strategy::cs_tag> has_valid_turns;
+        typedef std::deque<typename has_valid_turns::turn_type> turns_type;
+
+        std::vector<turns_type> self_turns(polygons.size());
+        std::vector<turns_type> cross_turns(polygons.size());
+        if (! compute_turns(multipolygon, self_turns, cross_turns, strategy, policy))
+        {
+            // The visitor gets the turns found by the sequential algorithm
+            turns_type turns;
+            if (! has_valid_turns::apply(multipolygon, turns, visitor, strategy))
+            {
+                return false;
+            }
+            // The visitor accepts invalid turns
+            return sequential::apply(multipolygon, visitor, strategy);
+        }
+
+        if (! visitor.template apply<no_failure>())
+        {
+            return false;
+        }
+
+
+        // check if each polygon's interior rings are inside the
+        // exterior and not one inside the other and
+        // check that each polygon's interior is connected
+        std::vector<char> invalid_holes(polygons.size(), 0);
+        std::vector<char> invalid_interior(polygons.size(), 0);
+        detail::parallel::for_each_index(policy, polygons.size(),
+            [&](std::size_t i, std::size_t)
+            {
+                probe_policy probe;
+                invalid_holes[i] = ! base::has_holes_inside::apply(*polygons[i],
+                                                    self_turns[i].begin(),
+                                                    self_turns[i].end(),
+                                                    probe, strategy);
+                invalid_interior[i] = ! base::has_connected_interior::apply(*polygons[i],
+                                                    self_turns[i].begin(),
+                                                    self_turns[i].end(),
+                                                    probe, strategy);
+            });
+
+        debug_phase::apply(3);
+
+        if (! has_property_per_polygon
+                <
+                    typename base::has_holes_inside
+                >(polygons, invalid_holes, self_turns, visitor, strategy))
+        {
+            return false;
+        }
+
+        debug_phase::apply(4);
+
+        if (! has_property_per_polygon
+                <
+                    typename base::has_connected_interior
+                >(polygons, invalid_interior, self_turns, visitor, strategy))
+        {
+            return false;
+        }
+
+
+        // check if polygon interiors are disjoint
+        debug_phase::apply(5);
+        return are_polygon_interiors_disjoint(polygons, self_turns, cross_turns,
+                                              visitor, strategy, policy);
+    }
+};
+
+
+}} // namespace detail::is_valid
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace resolve_strategy
+{
+
+template
+<
+    typename Strategy,
+    bool IsUmbrella = strategies::detail::is_umbrella_strategy<Strategy>::value
+>
+struct is_valid_parallel
+{
+    template <typename MultiPolygon, typename VisitPolicy>
+    static inline bool apply(MultiPolygon const& multipolygon,
+                             VisitPolicy& visitor,
+                             Strategy const& strategy,
+                             parallel_execution const& policy)
+    {
+        return detail::is_valid::is_valid_multipolygon_parallel
+            <
+                MultiPolygon
+            >::apply(multipolygon, visitor, strategy, policy);
+    }
+};
+
+template <typename Strategy>
+struct is_valid_parallel<Strategy, false>
+{
+    template <typename MultiPolygon, typename VisitPolicy>
+    static inline bool apply(MultiPolygon const& multipolygon,
+                             VisitPolicy& visitor,
+                             Strategy const& strategy,
+                             parallel_execution const& policy)
+    {
+        using strategies::relate::services::strategy_converter;
+        return detail::is_valid::is_valid_multipolygon_parallel
+            <
+                MultiPolygon
+            >::apply(multipolygon, visitor,
+                     strategy_converter<Strategy>::get(strategy), policy);
+    }
+};
+
+template <>
+struct is_valid_parallel<default_strategy, false>
+{
+    template <typename MultiPolygon, typename VisitPolicy>
+    static inline bool apply(MultiPolygon const& multipolygon,
+                             VisitPolicy& visitor,
+                             default_strategy,
+                             parallel_execution const& policy)
+    {
+        typedef typename strategies::relate::services::default_strategy
+            <
+                MultiPolygon, MultiPolygon
+            >::type strategy_type;
+
+        return detail::is_valid::is_valid_multipolygon_parallel
+            <
+                MultiPolygon
+            >::apply(multipolygon, visitor, strategy_type(), policy);
+    }
+};
+
+} // namespace resolve_strategy
+
+
+namespace resolve_dynamic
+{
+
+// Only multipolygons are checked in parallel, other geometries
+// are checked sequentially
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct is_valid_parallel
+{
+    template <typename VisitPolicy, typename Strategy>
+    static inline bool apply(Geometry const& geometry,
+                             VisitPolicy& visitor,
+                             Strategy const& strategy,
+                             parallel_execution const& )
+    {
+        return is_valid<Geometry>::apply(geometry, visitor, strategy);
+    }
+};
+
+template <typename Geometry>
+struct is_valid_parallel<Geometry, multi_polygon_tag>
+{
+    template <typename VisitPolicy, typename Strategy>
+    static inline bool apply(Geometry const& geometry,
+                             VisitPolicy& visitor,
+                             Strategy const& strategy,
+                             parallel_execution const& policy)
+    {
+        concepts::check<Geometry const>();
+
+        return resolve_strategy::is_valid_parallel
+            <
+                Strategy
+            >::apply(geometry, visitor, strategy, policy);
+    }
+};
+
+} // namespace resolve_dynamic
+
+
+// Undocumented for now
+template <typename Geometry, typename VisitPolicy, typename Strategy>
+inline bool is_valid(parallel_execution const& policy,
+                     Geometry const& geometry,
+                     VisitPolicy& visitor,
+                     Strategy const& strategy)
+{
+    return resolve_dynamic::is_valid_parallel
+        <
+            Geometry
+        >::apply(geometry, visitor, strategy, policy);
+}
+
+
+/*!
+\brief \brief_check{is valid (in the OGC sense)}, the work is split
+    among threads
+\ingroup is_valid
+\details The polygons of a multipolygon are checked concurrently and the
+    interactions between polygons are checked only for the polygons with
+    intersecting envelopes. Other geometries are checked sequentially.
+\tparam Geometry \tparam_geometry
+\tparam Strategy \tparam_strategy{Is_valid}
+\param policy the parallel execution policy
+\param geometry \param_geometry
+\param strategy \param_strategy{is_valid}
+\return \return_check{is valid (in the OGC sense)}
+
+\qbk{distinguish,parallel with strategy}
+*/
+template <typename Geometry, typename Strategy>
+inline bool is_valid(parallel_execution const& policy,
+                     Geometry const& geometry,
+                     Strategy const& strategy)
+{
+    is_valid_default_policy<> visitor;
+    return resolve_dynamic::is_valid_parallel
+        <
+            Geometry
+        >::apply(geometry, visitor, strategy, policy);
+}
+
+/*!
+\brief \brief_check{is valid (in the OGC sense)}, the work is split
+    among threads
+\ingroup is_valid
+\tparam Geometry \tparam_geometry
+\param policy the parallel execution policy
+\param geometry \param_geometry
+\return \return_check{is valid (in the OGC sense)}
+
+\qbk{distinguish,parallel}
+*/
+template <typename Geometry>
+inline bool is_valid(parallel_execution const& policy, Geometry const& geometry)
+{
+    return is_valid(policy, geometry, default_strategy());
+}
+
+/*!
+\brief \brief_check{is valid (in the OGC sense)}, the work is split
+    among threads
+\ingroup is_valid
+\tparam Geometry \tparam_geometry
+\tparam Strategy \tparam_strategy{Is_valid}
+\param policy the parallel execution policy
+\param geometry \param_geometry
+\param failure An enumeration value indicating that the geometry is
+    valid or not, and if not valid indicating the reason why, the same as
+    the value set by the sequential algorithm
+\param strategy \param_strategy{is_valid}
+\return \return_check{is valid (in the OGC sense)}
+
+\qbk{distinguish,parallel with failure value and strategy}
+*/
+template <typename Geometry, typename Strategy>
+inline bool is_valid(parallel_execution const& policy,
+                     Geometry const& geometry,
+                     validity_failure_type& failure,
+                     Strategy const& strategy)
+{
+    failure_type_policy<> visitor;
+    bool result = resolve_dynamic::is_valid_parallel
+        <
+            Geometry
+        >::apply(geometry, visitor, strategy, policy);
+    failure = visitor.failure();
+    return result;
+}
+
+/*!
+\brief \brief_check{is valid (in the OGC sense)}, the work is split
+    among threads
+\ingroup is_valid
+\tparam Geometry \tparam_geometry
+\param policy the parallel execution policy
+\param geometry \param_geometry
+\param failure An enumeration value indicating that the geometry is
+    valid or not, and if not valid indicating the reason why
+\return \return_check{is valid (in the OGC sense)}
+
+\qbk{distinguish,parallel with failure value}
+*/
+template <typename Geometry>
+inline bool is_valid(parallel_execution const& policy,
+                     Geometry const& geometry,
+                     validity_failure_type& failure)
+{
+    return is_valid(policy, geometry, failure, default_strategy());
+}
+
+/*!
+\brief \brief_check{is valid (in the OGC sense)}, the work is split
+    among threads
+\ingroup is_valid
+\tparam Geometry \tparam_geometry
+\tparam Strategy \tparam_strategy{Is_valid}
+\param policy the parallel execution policy
+\param geometry \param_geometry
+\param message A string containing a message stating if the geometry
+    is valid or not, and if not valid a reason why, the same as
+    the message set by the sequential algorithm
+\param strategy \param_strategy{is_valid}
+\return \return_check{is valid (in the OGC sense)}
+
+\qbk{distinguish,parallel with message and strategy}
+*/
+template <typename Geometry, typename Strategy>
+inline bool is_valid(parallel_execution const& policy,
+                     Geometry const& geometry,
+                     std::string& message,
+                     Strategy const& strategy)
+{
+    std::ostringstream stream;
+    failing_reason_policy<> visitor(stream);
+    bool result = resolve_dynamic::is_valid_parallel
+        <
+            Geometry
+        >::apply(geometry, visitor, strategy, policy);
+    message = stream.str();
+    return result;
+}
+
+/*!
+\brief \brief_check{is valid (in the OGC sense)}, the work is split
+    among threads
+\ingroup is_valid
+\tparam Geometry \tparam_geometry
+\param policy the parallel execution policy
+\param geometry \param_geometry
+\param message A string containing a message stating if the geometry
+    is valid or not, and if not valid a reason why
+\return \return_check{is valid (in the OGC sense)}
+
+\qbk{distinguish,parallel with message}
+*/
+template <typename Geometry>
+inline bool is_valid(parallel_execution const& policy,
+                     Geometry const& geometry,
+                     std::string& message)
+{
+    return is_valid(policy, geometry, message, default_strategy());
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_PARALLEL_HPP
@@ -53,6 +53,7 @@
 #include <boost/geometry/algorithms/detail/check_iterator_range.hpp>
 #include <boost/geometry/algorithms/detail/partition.hpp>
 
+#include <boost/geometry/algorithms/detail/is_valid/buffers.hpp>
 #include <boost/geometry/algorithms/detail/is_valid/complement_graph.hpp>
 #include <boost/geometry/algorithms/detail/is_valid/has_valid_self_turns.hpp>
 #include <boost/geometry/algorithms/detail/is_valid/is_acceptable_turn.hpp>
@@ -413,7 +414,9 @@ protected:
                     typename Strategy::cs_tag
                 > graph;
 
-            graph g(geometry::num_interior_rings(polygon) + 1);
+            graph_buffer<VisitPolicy, graph>
+                buffer(visitor, geometry::num_interior_rings(polygon) + 1);
+            graph& g = buffer.get();
             for (TurnIterator tit = first; tit != beyond; ++tit)
             {
                 typename graph::vertex_handle v1 = g.add_vertex
@@ -463,7 +466,13 @@ public:
 
         typedef has_valid_self_turns<Polygon, typename Strategy::cs_tag> has_valid_turns;
 
-        std::deque<typename has_valid_turns::turn_type> turns;
+        typedef turns_buffer
+            <
+                VisitPolicy, typename has_valid_turns::turn_type
+            > turns_buffer_type;
+
+        turns_buffer_type buffer(visitor);
+        typename turns_buffer_type::type& turns = buffer.get();
         bool has_invalid_turns
             = ! has_valid_turns::apply(polygon, turns, visitor, strategy);
         debug_print_turns(turns.begin(), turns.end());
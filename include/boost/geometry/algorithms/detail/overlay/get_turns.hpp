@@ -40,6 +40,7 @@
 #include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
 #include <boost/geometry/algorithms/detail/sections/section_functions.hpp>
 #include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+#include <boost/geometry/algorithms/detail/sections/sections_cache.hpp>
 
 #include <boost/geometry/core/access.hpp>
 #include <boost/geometry/core/assert.hpp>
@@ -358,8 +359,11 @@ public :
                         // (including, for areas, first-last segment
                         //  and two segments with one or more degenerate/duplicate
                         //  (zero-length) segments in between)
+                        // The sections can be passed in any order.
                         skip = ndi2 == ndi1 + 1
-                            || adjacent<Geometry1>(sec1, index1, index2);
+                            || ndi1 == ndi2 + 1
+                            || adjacent<Geometry1>(sec1, index1, index2)
+                            || adjacent<Geometry1>(sec1, index2, index1);
                     }
                 }
 
@@ -534,10 +538,17 @@ public:
         sections_type sec1, sec2;
         typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
 
-        geometry::sectionalize<Reverse1, dimensions>(geometry1, robust_policy,
-                                                     sec1, strategy, 0);
-        geometry::sectionalize<Reverse2, dimensions>(geometry2, robust_policy,
-                                                     sec2, strategy, 1);
+        // Sections of a geometry may be cached and passed with the strategy
+        sections_type const& sections1
+            = detail::section::sectionalize_or_get_cached
+                <
+                    Reverse1, dimensions
+                >(geometry1, robust_policy, sec1, strategy, 0);
+        sections_type const& sections2
+            = detail::section::sectionalize_or_get_cached
+                <
+                    Reverse2, dimensions
+                >(geometry2, robust_policy, sec2, strategy, 1);
 
         // ... and then partition them, intersecting overlapping sections in visitor method
         section_visitor
@@ -553,7 +564,7 @@ public:
         geometry::partition
             <
                 box_type
-            >::apply(sec1, sec2, visitor,
+            >::apply(sections1, sections2, visitor,
                      detail::section::get_section_box<Strategy>(strategy),
                      detail::section::overlaps_section_box<Strategy>(strategy));
     }
@@ -23,6 +23,8 @@
 #include <boost/geometry/algorithms/detail/overlay/do_reverse.hpp>
 #include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
 #include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_sweep.hpp>
+#include <boost/geometry/algorithms/detail/sections/sections_cache.hpp>
 
 #include <boost/geometry/core/access.hpp>
 #include <boost/geometry/core/coordinate_dimension.hpp>
@@ -154,8 +156,11 @@ struct get_turns
         typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
 
         sections_type sec;
-        geometry::sectionalize<Reverse, dimensions>(geometry, robust_policy,
-                                                    sec, strategy);
+        sections_type const& sections
+            = detail::section::sectionalize_or_get_cached
+                <
+                    Reverse, dimensions
+                >(geometry, robust_policy, sec, strategy);
 
         self_section_visitor
             <
@@ -165,12 +170,10 @@ struct get_turns
                       source_index, skip_adjacent);
 
         // false if interrupted
-        geometry::partition
+        detail::section::visit_overlapping_sections
             <
                 box_type
-            >::apply(sec, visitor,
-                     detail::section::get_section_box<Strategy>(strategy),
-                     detail::section::overlaps_section_box<Strategy>(strategy));
+            >(sections, visitor, strategy);
 
         return ! interrupt_policy.has_intersections;
     }
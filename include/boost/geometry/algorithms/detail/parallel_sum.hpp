@@ -0,0 +1,367 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARALLEL_SUM_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARALLEL_SUM_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/detail/dummy_geometries.hpp>
+
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/parallel.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+
+// Sum with the compensation of the rounding errors (Neumaier's variant
+// of Kahan summation)
+template <typename T>
+class compensated_sum
+{
+public:
+    compensated_sum()
+        : m_sum(0)
+        , m_compensation(0)
+    {}
+
+    inline void add(T const& value)
+    {
+        T const sum = m_sum + value;
+        if (math::abs(m_sum) >= math::abs(value))
+        {
+            m_compensation += (m_sum - sum) + value;
+        }
+        else
+        {
+            m_compensation += (value - sum) + m_sum;
+        }
+        m_sum = sum;
+    }
+
+    inline void add(compensated_sum const& other)
+    {
+        add(other.m_sum);
+        add(other.m_compensation);
+    }
+
+    inline T result() const
+    {
+        return m_sum + m_compensation;
+    }
+
+private:
+    T m_sum;
+    T m_compensation;
+};
+
+
+namespace parallel_sum
+{
+
+
+// The number of segments processed by one task. The tasks do not depend on
+// the number of threads, so the result does not depend on it either.
+static const std::size_t segments_per_task = 1024;
+
+
+// A task processes either whole ranges, if range_count > 0, or the segments
+// [first_segment, last_segment) of one range
+struct task
+{
+    std::size_t range;
+    std::size_t range_count;
+    std::size_t first_segment;
+    std::size_t last_segment;
+};
+
+template <typename SegmentCount>
+inline std::vector<task> make_tasks(std::size_t range_count,
+                                    SegmentCount const& segment_count)
+{
+    std::vector<task> result;
+    std::size_t i = 0;
+    while (i < range_count)
+    {
+        std::size_t const count = segment_count(i);
+        if (count > segments_per_task)
+        {
+            for (std::size_t s = 0; s < count; s += segments_per_task)
+            {
+                result.push_back(task{i, 0, s,
+                    (std::min)(s + segments_per_task, count)});
+            }
+            ++i;
+            continue;
+        }
+
+        task t{i, 0, 0, 0};
+        std::size_t total = 0;
+        while (i < range_count && total + segment_count(i) <= segments_per_task)
+        {
+            total += segment_count(i);
+            ++t.range_count;
+            ++i;
+        }
+        result.push_back(t);
+    }
+    return result;
+}
+
+
+// Returns the number of segments of a range, closed if Close is true
+template <bool Close, typename Range>
+inline std::size_t segment_count(Range const& range)
+{
+    std::size_t const n = boost::size(range);
+    return n == 0 ? 0 : Close ? n : n - 1;
+}
+
+// Calls function(p1, p2) for the segments [first, last) of a range,
+// the segment following the last point is the closing segment
+template <typename Range, typename Function>
+inline void for_each_segment(Range const& range,
+                             std::size_t first, std::size_t last,
+                             Function const& function)
+{
+    std::size_t const n = boost::size(range);
+    auto it = boost::begin(range);
+    std::advance(it, first);
+    for (std::size_t i = first; i < last; ++i)
+    {
+        auto next = i + 1 == n ? boost::begin(range) : std::next(it);
+        function(*it, *next);
+        it = next;
+    }
+}
+
+
+// Collects the rings of areal geometries or the linestrings of linear
+// geometries, in the order of the sequential algorithms
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct collect_ranges
+{
+    template <typename Range>
+    static inline void apply(Geometry const& geometry,
+                             std::vector<Range const*>& ranges)
+    {
+        ranges.push_back(&geometry);
+    }
+};
+
+template <typename Polygon>
+struct collect_ranges<Polygon, polygon_tag>
+{
+    template <typename Range>
+    static inline void apply(Polygon const& polygon,
+                             std::vector<Range const*>& ranges)
+    {
+        ranges.push_back(&exterior_ring(polygon));
+        for (auto const& ring : interior_rings(polygon))
+        {
+            ranges.push_back(&ring);
+        }
+    }
+};
+
+template <typename MultiGeometry>
+struct collect_multi_ranges
+{
+    template <typename Range>
+    static inline void apply(MultiGeometry const& multi,
+                             std::vector<Range const*>& ranges)
+    {
+        for (auto const& single : multi)
+        {
+            collect_ranges
+                <
+                    typename boost::range_value<MultiGeometry>::type
+                >::apply(single, ranges);
+        }
+    }
+};
+
+template <typename MultiPolygon>
+struct collect_ranges<MultiPolygon, multi_polygon_tag>
+    : collect_multi_ranges<MultiPolygon>
+{};
+
+template <typename MultiLinestring>
+struct collect_ranges<MultiLinestring, multi_linestring_tag>
+    : collect_multi_ranges<MultiLinestring>
+{};
+
+
+// Sum of the lengths of ranges (linestrings or rings)
+template <typename Result, bool Close, typename Range, typename Strategies>
+inline Result ranges_length(std::vector<Range const*> const& ranges,
+                            Strategies const& strategies,
+                            parallel_execution const& policy)
+{
+    auto const strategy = strategies.distance(dummy_point(), dummy_point());
+
+    std::vector<task> const tasks = make_tasks(ranges.size(),
+        [&](std::size_t i) { return segment_count<Close>(*ranges[i]); });
+
+    std::vector<compensated_sum<Result> > sums(tasks.size());
+    detail::parallel::for_each_index(policy, tasks.size(),
+        [&](std::size_t i, std::size_t)
+        {
+            task const& t = tasks[i];
+            auto const add = [&](auto const& p1, auto const& p2)
+            {
+                sums[i].add(Result(strategy.apply(p1, p2)));
+            };
+            if (t.range_count > 0)
+            {
+                for (std::size_t r = t.range; r < t.range + t.range_count; ++r)
+                {
+                    for_each_segment(*ranges[r], 0,
+                                     segment_count<Close>(*ranges[r]), add);
+                }
+            }
+            else
+            {
+                for_each_segment(*ranges[t.range], t.first_segment,
+                                 t.last_segment, add);
+            }
+        });
+
+    compensated_sum<Result> total;
+    for (auto const& sum : sums)
+    {
+        total.add(sum);
+    }
+    return total.result();
+}
+
+
+// Sum of the areas of rings. The states of the area strategy of blocks of
+// large rings are calculated concurrently and merged in order.
+template <typename Result, typename Ring, typename Strategies>
+inline Result rings_area(std::vector<Ring const*> const& rings,
+                         Strategies const& strategies,
+                         parallel_execution const& policy)
+{
+    if (rings.empty())
+    {
+        return Result(0);
+    }
+
+    static const bool close = geometry::closure<Ring>::value == open;
+    static const bool reverse = geometry::point_order<Ring>::value == counterclockwise;
+
+    using strategy_type = decltype(strategies.area(*rings.front()));
+    using state_type = typename strategy_type::template state<Ring>;
+
+    strategy_type const strategy = strategies.area(*rings.front());
+
+    // Rings with less points have no area, as in the sequential algorithm
+    auto const ring_segments = [&](std::size_t i)
+    {
+        return boost::size(*rings[i]) < detail::minimum_ring_size<Ring>::value
+             ? std::size_t(0)
+             : segment_count<close>(*rings[i]);
+    };
+
+    std::vector<task> const tasks = make_tasks(rings.size(), ring_segments);
+
+    struct task_result
+    {
+        compensated_sum<Result> sum;
+        state_type state;
+    };
+
+    std::vector<task_result> results(tasks.size());
+    detail::parallel::for_each_index(policy, tasks.size(),
+        [&](std::size_t i, std::size_t)
+        {
+            task const& t = tasks[i];
+            auto const apply = [&](state_type& state)
+            {
+                return [&](auto const& p1, auto const& p2)
+                {
+                    if (reverse)
+                    {
+                        strategy.apply(p2, p1, state);
+                    }
+                    else
+                    {
+                        strategy.apply(p1, p2, state);
+                    }
+                };
+            };
+            if (t.range_count > 0)
+            {
+                for (std::size_t r = t.range; r < t.range + t.range_count; ++r)
+                {
+                    std::size_t const count = ring_segments(r);
+                    if (count > 0)
+                    {
+                        state_type state;
+                        for_each_segment(*rings[r], 0, count, apply(state));
+                        results[i].sum.add(Result(strategy.result(state)));
+                    }
+                }
+            }
+            else
+            {
+                for_each_segment(*rings[t.range], t.first_segment,
+                                 t.last_segment, apply(results[i].state));
+            }
+        });
+
+    compensated_sum<Result> total;
+    state_type state;
+    for (std::size_t i = 0; i < tasks.size(); ++i)
+    {
+        task const& t = tasks[i];
+        if (t.range_count > 0)
+        {
+            total.add(results[i].sum);
+        }
+        else
+        {
+            state.merge(results[i].state);
+            if (t.last_segment == ring_segments(t.range))
+            {
+                total.add(Result(strategy.result(state)));
+                state = state_type();
+            }
+        }
+    }
+    return total.result();
+}
+
+
+} // namespace parallel_sum
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARALLEL_SUM_HPP
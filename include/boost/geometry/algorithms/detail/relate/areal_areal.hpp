@@ -703,7 +703,7 @@ struct areal_areal
         inline void turns(TurnIt first, TurnIt last)
         {
             // if those flags are set nothing will change
-            if ( (m_flags & 6) == 6 )
+            if ( m_flags == 7 )
             {
                 return;
             }
@@ -507,6 +507,83 @@ inline bool check_matrix(Mask const& mask, Matrix const& matrix)
     return check_dispatch<Mask>::apply(mask, matrix);
 }
 
+// satisfied_matrix()
+
+// The result of check_matrix() is known in advance if the mask only contains
+// 'T' and '*' elements and all 'T' elements are already set. Elements of the
+// matrix are never decreased so such mask can't be violated anymore.
+template <typename Mask>
+struct satisfied_dispatch
+{
+    template <typename Matrix>
+    static inline bool apply(Mask const& mask, Matrix const& matrix)
+    {
+        return per_one<interior, interior>(mask, matrix)
+            && per_one<interior, boundary>(mask, matrix)
+            && per_one<interior, exterior>(mask, matrix)
+            && per_one<boundary, interior>(mask, matrix)
+            && per_one<boundary, boundary>(mask, matrix)
+            && per_one<boundary, exterior>(mask, matrix)
+            && per_one<exterior, interior>(mask, matrix)
+            && per_one<exterior, boundary>(mask, matrix)
+            && per_one<exterior, exterior>(mask, matrix);
+    }
+
+    template <field F1, field F2, typename Matrix>
+    static inline bool per_one(Mask const& mask, Matrix const& matrix)
+    {
+        const char mask_el = mask.template get<F1, F2>();
+
+        if ( mask_el == 'T' )
+        {
+            return matrix.template get<F1, F2>() != 'F';
+        }
+
+        return mask_el == '*';
+    }
+};
+
+template <typename Masks, int I = 0, int N = std::tuple_size<Masks>::value>
+struct satisfied_dispatch_tuple
+{
+    template <typename Matrix>
+    static inline bool apply(Masks const& masks, Matrix const& matrix)
+    {
+        typedef typename std::tuple_element<I, Masks>::type mask_type;
+        mask_type const& mask = std::get<I>(masks);
+        return satisfied_dispatch<mask_type>::apply(mask, matrix)
+            || satisfied_dispatch_tuple<Masks, I+1>::apply(masks, matrix);
+    }
+};
+
+template <typename Masks, int N>
+struct satisfied_dispatch_tuple<Masks, N, N>
+{
+    template <typename Matrix>
+    static inline bool apply(Masks const&, Matrix const&)
+    {
+        return false;
+    }
+};
+
+template <typename ...Masks>
+struct satisfied_dispatch<std::tuple<Masks...>>
+{
+    typedef std::tuple<Masks...> mask_type;
+
+    template <typename Matrix>
+    static inline bool apply(mask_type const& mask, Matrix const& matrix)
+    {
+        return satisfied_dispatch_tuple<mask_type>::apply(mask, matrix);
+    }
+};
+
+template <typename Mask, typename Matrix>
+inline bool satisfied_matrix(Mask const& mask, Matrix const& matrix)
+{
+    return satisfied_dispatch<Mask>::apply(mask, matrix);
+}
+
 // matrix_width
 
 template <typename MatrixOrMask>
@@ -564,12 +641,14 @@ public:
     inline explicit mask_handler(Mask const& m)
         : interrupt(false)
         , m_mask(m)
+        , m_satisfied(false)
     {}
 
     result_type result() const
     {
-        return !interrupt
-            && check_matrix(m_mask, base_t::matrix());
+        return m_satisfied
+            || ( !interrupt
+              && check_matrix(m_mask, base_t::matrix()) );
     }
 
     template <field F1, field F2, char D>
@@ -590,6 +669,7 @@ public:
         else
         {
             base_t::template set<F1, F2, V>();
+            check_satisfied();
         }
     }
 
@@ -603,11 +683,24 @@ public:
         else
         {
             base_t::template update<F1, F2, V>();
+            check_satisfied();
         }
     }
 
 private:
+    // interrupt the analysis if the result is already known to be true
+    inline void check_satisfied()
+    {
+        if ( BOOST_GEOMETRY_CONDITION(Interrupt)
+          && satisfied_matrix(m_mask, base_t::matrix()) )
+        {
+            m_satisfied = true;
+            interrupt = true;
+        }
+    }
+
     Mask const& m_mask;
+    bool m_satisfied;
 };
 
 // --------------- FALSE MASK ----------------
@@ -1033,6 +1126,117 @@ struct static_check_matrix
     }
 };
 
+// static_satisfied_matrix
+
+template
+<
+    typename StaticMask,
+    bool IsSequence = util::is_sequence<StaticMask>::value
+>
+struct static_satisfied_dispatch
+{
+    template <field F1, field F2>
+    struct per_one
+    {
+        static const char mask_el = StaticMask::template static_get<F1, F2>::value;
+        static const bool enabled = mask_el == 'T' || mask_el == '*';
+
+        template <typename Matrix>
+        static inline bool apply(Matrix const& matrix)
+        {
+            return mask_el == '*'
+                || ( mask_el == 'T'
+                  && matrix.template get<F1, F2>() != 'F' );
+        }
+    };
+
+    // true if the mask can be satisfied before the analysis is finished
+    static const bool enabled = per_one<interior, interior>::enabled
+                             && per_one<interior, boundary>::enabled
+                             && per_one<interior, exterior>::enabled
+                             && per_one<boundary, interior>::enabled
+                             && per_one<boundary, boundary>::enabled
+                             && per_one<boundary, exterior>::enabled
+                             && per_one<exterior, interior>::enabled
+                             && per_one<exterior, boundary>::enabled
+                             && per_one<exterior, exterior>::enabled;
+
+    template <typename Matrix>
+    static inline bool apply(Matrix const& matrix)
+    {
+        return enabled
+            && per_one<interior, interior>::apply(matrix)
+            && per_one<interior, boundary>::apply(matrix)
+            && per_one<interior, exterior>::apply(matrix)
+            && per_one<boundary, interior>::apply(matrix)
+            && per_one<boundary, boundary>::apply(matrix)
+            && per_one<boundary, exterior>::apply(matrix)
+            && per_one<exterior, interior>::apply(matrix)
+            && per_one<exterior, boundary>::apply(matrix)
+            && per_one<exterior, exterior>::apply(matrix);
+    }
+};
+
+template
+<
+    typename Seq,
+    std::size_t I = 0,
+    std::size_t N = util::sequence_size<Seq>::value
+>
+struct static_satisfied_sequence
+{
+    typedef typename util::sequence_element<I, Seq>::type StaticMask;
+
+    static const bool enabled
+        = static_satisfied_dispatch<StaticMask>::enabled
+       || static_satisfied_sequence<Seq, I + 1>::enabled;
+
+    template <typename Matrix>
+    static inline bool apply(Matrix const& matrix)
+    {
+        return static_satisfied_dispatch
+                <
+                    StaticMask
+                >::apply(matrix)
+            || static_satisfied_sequence
+                <
+                    Seq, I + 1
+                >::apply(matrix);
+    }
+};
+
+template <typename Seq, std::size_t N>
+struct static_satisfied_sequence<Seq, N, N>
+{
+    static const bool enabled = false;
+
+    template <typename Matrix>
+    static inline bool apply(Matrix const& /*matrix*/)
+    {
+        return false;
+    }
+};
+
+template <typename StaticMask>
+struct static_satisfied_dispatch<StaticMask, true>
+    : static_satisfied_sequence<StaticMask>
+{};
+
+template <typename StaticMask>
+struct static_satisfied_matrix
+{
+    static const bool enabled = static_satisfied_dispatch<StaticMask>::enabled;
+
+    template <typename Matrix>
+    static inline bool apply(Matrix const& matrix)
+    {
+        return static_satisfied_dispatch
+                <
+                    StaticMask
+                >::apply(matrix);
+    }
+};
+
 // static_mask_handler
 
 template <typename StaticMask, bool Interrupt>
@@ -1048,16 +1252,19 @@ public:
 
     inline static_mask_handler()
         : interrupt(false)
+        , m_satisfied(false)
     {}
 
     inline explicit static_mask_handler(StaticMask const& /*dummy*/)
         : interrupt(false)
+        , m_satisfied(false)
     {}
 
     result_type result() const
     {
-        return (!Interrupt || !interrupt)
-            && static_check_matrix<StaticMask>::apply(base_type::matrix());
+        return m_satisfied
+            || ( (!Interrupt || !interrupt)
+              && static_check_matrix<StaticMask>::apply(base_type::matrix()) );
     }
 
     template <field F1, field F2, char D>
@@ -1109,6 +1316,7 @@ private:
     inline void set_dispatch(integral_constant<int, 1>)
     {
         base_type::template set<F1, F2, V>();
+        check_satisfied();
     }
     // else
     template <field F1, field F2, char V>
@@ -1126,11 +1334,26 @@ private:
     inline void update_dispatch(integral_constant<int, 1>)
     {
         base_type::template update<F1, F2, V>();
+        check_satisfied();
     }
     // else
     template <field F1, field F2, char V>
     inline void update_dispatch(integral_constant<int, 2>)
     {}
+
+    // interrupt the analysis if the result is already known to be true
+    inline void check_satisfied()
+    {
+        if ( BOOST_GEOMETRY_CONDITION(Interrupt
+                && static_satisfied_matrix<StaticMask>::enabled)
+          && static_satisfied_matrix<StaticMask>::apply(base_type::matrix()) )
+        {
+            m_satisfied = true;
+            interrupt = true;
+        }
+    }
+
+    bool m_satisfied;
 };
 
 // --------------- UTIL FUNCTIONS ----------------
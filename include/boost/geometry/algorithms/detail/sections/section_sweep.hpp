@@ -0,0 +1,587 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_SWEEP_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_SWEEP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <queue>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/detail/partition.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
+#include <boost/geometry/algorithms/detail/sweep.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace section
+{
+
+
+// Base of the strategies requesting the plane sweep of sections
+struct plane_sweep_base {};
+
+// Umbrella strategy requesting the plane sweep of sections in self turns
+template <typename Strategy>
+class plane_sweep_strategy
+    : public Strategy
+    , public plane_sweep_base
+{
+public:
+    explicit plane_sweep_strategy(Strategy const& strategy)
+        : Strategy(strategy)
+    {}
+
+    inline Strategy const& base() const
+    {
+        return *this;
+    }
+};
+
+
+template
+<
+    typename Strategy,
+    bool IsPlaneSweep = std::is_base_of<plane_sweep_base, Strategy>::value
+>
+struct use_plane_sweep
+    : std::false_type
+{};
+
+// The sweep line is perpendicular to the x axis, it is not used for
+// periodic coordinates
+template <typename Strategy>
+struct use_plane_sweep<Strategy, true>
+    : std::is_same<typename Strategy::cs_tag, cartesian_tag>
+{};
+
+
+template <typename Coordinate>
+struct section_event
+{
+    Coordinate x;
+    bool leave;
+    std::size_t index;
+};
+
+// Orders the events in the priority queue, the sections are entered
+// before the sections are left at the same x, so touching boxes overlap
+struct section_event_greater
+{
+    template <typename Event>
+    inline bool operator()(Event const& left, Event const& right) const
+    {
+        if (left.x != right.x)
+        {
+            return right.x < left.x;
+        }
+        return left.leave && ! right.leave;
+    }
+};
+
+
+template <typename Sections>
+struct section_sweep_initializer
+{
+    template <typename Queue, typename EventVisitor>
+    inline void apply(Sections const& sections, Queue& queue,
+                      EventVisitor& ) const
+    {
+        typedef typename Queue::value_type event_type;
+
+        for (std::size_t i = 0; i < boost::size(sections); ++i)
+        {
+            event_type enter, leave;
+            enter.x = geometry::get<min_corner, 0>(sections[i].bounding_box);
+            enter.leave = false;
+            enter.index = i;
+            leave.x = geometry::get<max_corner, 0>(sections[i].bounding_box);
+            leave.leave = true;
+            leave.index = i;
+            queue.push(enter);
+            queue.push(leave);
+        }
+    }
+};
+
+
+// Set of ranks, stored in words of bits with a word of bits per 64 words
+// above them, finding the next rank in a few steps
+class rank_set
+{
+    typedef boost::uint64_t word_type;
+    static const std::size_t word_size = 64;
+
+public:
+    static const std::size_t npos = std::size_t(-1);
+
+    explicit rank_set(std::size_t count)
+    {
+        do
+        {
+            count = (count + word_size - 1) / word_size;
+            m_levels.push_back(std::vector<word_type>(count, 0));
+        }
+        while (count > 1);
+    }
+
+    inline void insert(std::size_t rank)
+    {
+        for (std::size_t level = 0; level < m_levels.size(); ++level)
+        {
+            word_type& word = m_levels[level][rank / word_size];
+            bool const was_empty = word == 0;
+            word |= word_type(1) << (rank % word_size);
+            if (! was_empty)
+            {
+                return;
+            }
+            rank /= word_size;
+        }
+    }
+
+    inline void erase(std::size_t rank)
+    {
+        for (std::size_t level = 0; level < m_levels.size(); ++level)
+        {
+            word_type& word = m_levels[level][rank / word_size];
+            word &= ~(word_type(1) << (rank % word_size));
+            if (word != 0)
+            {
+                return;
+            }
+            rank /= word_size;
+        }
+    }
+
+    // Returns the first rank not lower than the rank, or npos
+    inline std::size_t next(std::size_t rank) const
+    {
+        std::size_t level = 0;
+        for (; level < m_levels.size(); ++level)
+        {
+            std::size_t const index = rank / word_size;
+            if (index >= m_levels[level].size())
+            {
+                return npos;
+            }
+            word_type const bits = m_levels[level][index]
+                                 & (~word_type(0) << (rank % word_size));
+            if (bits != 0)
+            {
+                rank = index * word_size + lowest_bit(bits);
+                break;
+            }
+            rank = index + 1;
+        }
+        if (level == m_levels.size())
+        {
+            return npos;
+        }
+        while (level > 0)
+        {
+            --level;
+            rank = rank * word_size + lowest_bit(m_levels[level][rank]);
+        }
+        return rank;
+    }
+
+private:
+    // Index of the lowest bit set, with a de Bruijn sequence
+    static inline std::size_t lowest_bit(word_type bits)
+    {
+        static const unsigned char table[64] =
+        {
+             0,  1, 48,  2, 57, 49, 28,  3, 61, 58, 50, 42, 38, 29, 17,  4,
+            62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12,  5,
+            63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+            46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6
+        };
+        return table[((bits & (0 - bits)) * word_type(0x03f79d71b4cb0a89ULL)) >> 58];
+    }
+
+    std::vector<std::vector<word_type> > m_levels;
+};
+
+
+// Keeps the sections crossed by the sweep line and finds the ones
+// overlapping a section in y, in a time proportional to their number plus
+// the logarithm of the number of sections. The y coordinates of the
+// sections are replaced by their ranks. A section overlaps another one if
+// it contains its lower end, or if it starts above it, up to its upper end.
+// The first ones are found in the nodes of a segment tree, the others by the
+// ranks of the lower ends of the active sections.
+class active_sections
+{
+    static const std::size_t npos = std::size_t(-1);
+
+    // Section in a list, the lists of the nodes and the ranks are stored
+    // in a single vector
+    struct item
+    {
+        std::size_t index;
+        std::size_t next;
+    };
+
+public:
+    template <typename Sections>
+    explicit active_sections(Sections const& sections)
+        : m_starts(0)
+    {
+        typedef typename boost::range_value<Sections>::type section_type;
+        typedef typename geometry::coordinate_type
+            <
+                typename section_type::box_type
+            >::type coordinate_type;
+
+        std::size_t const count = boost::size(sections);
+
+        std::vector<coordinate_type> ys;
+        ys.reserve(2 * count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            ys.push_back(geometry::get<min_corner, 1>(sections[i].bounding_box));
+            ys.push_back(geometry::get<max_corner, 1>(sections[i].bounding_box));
+        }
+        std::sort(ys.begin(), ys.end());
+        ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+
+        m_lower.reserve(count);
+        m_upper.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            m_lower.push_back(rank(ys,
+                geometry::get<min_corner, 1>(sections[i].bounding_box)));
+            m_upper.push_back(rank(ys,
+                geometry::get<max_corner, 1>(sections[i].bounding_box)));
+        }
+
+        m_rank_count = ys.size();
+        m_nodes.resize(2 * m_rank_count, std::size_t(npos));
+        m_ranks.resize(m_rank_count, std::size_t(npos));
+        m_start_counts.resize(m_rank_count, 0);
+        m_starts = rank_set(m_rank_count);
+        m_active.resize(count, false);
+        m_items.reserve(2 * count);
+    }
+
+    inline void insert(std::size_t index)
+    {
+        m_active[index] = true;
+
+        std::size_t const lower = m_lower[index];
+        push(m_ranks[lower], index);
+        if (m_start_counts[lower]++ == 0)
+        {
+            m_starts.insert(lower);
+        }
+
+        // The nodes of the segment tree covering the interval
+        for (std::size_t l = lower + m_rank_count,
+                         r = m_upper[index] + m_rank_count + 1;
+             l < r; l /= 2, r /= 2)
+        {
+            if (l % 2 == 1)
+            {
+                push(m_nodes[l++], index);
+            }
+            if (r % 2 == 1)
+            {
+                push(m_nodes[--r], index);
+            }
+        }
+    }
+
+    // The section is removed from the lists when they are visited
+    inline void erase(std::size_t index)
+    {
+        m_active[index] = false;
+
+        std::size_t const lower = m_lower[index];
+        if (--m_start_counts[lower] == 0)
+        {
+            m_starts.erase(lower);
+        }
+    }
+
+    // Calls the function with the active sections overlapping the
+    // section in y, stops if it returns false
+    template <typename Function>
+    inline bool visit(std::size_t index, Function const& function)
+    {
+        std::size_t const lower = m_lower[index];
+        for (std::size_t node = lower + m_rank_count; node > 0; node /= 2)
+        {
+            if (! visit_list(m_nodes[node], function))
+            {
+                return false;
+            }
+        }
+
+        std::size_t const upper = m_upper[index];
+        for (std::size_t r = m_starts.next(lower + 1);
+             r != rank_set::npos && r <= upper;
+             r = m_starts.next(r + 1))
+        {
+            if (! visit_list(m_ranks[r], function))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    template <typename Coordinates, typename Coordinate>
+    static inline std::size_t rank(Coordinates const& ys, Coordinate const& y)
+    {
+        return std::size_t(std::lower_bound(ys.begin(), ys.end(), y) - ys.begin());
+    }
+
+    inline void push(std::size_t& head, std::size_t index)
+    {
+        item const added = { index, head };
+        head = m_items.size();
+        m_items.push_back(added);
+    }
+
+    // Visits the active sections of a list and unlinks the others
+    template <typename Function>
+    inline bool visit_list(std::size_t& head, Function const& function)
+    {
+        for (std::size_t* link = &head; *link != npos; )
+        {
+            item const& current = m_items[*link];
+            if (! m_active[current.index])
+            {
+                *link = current.next;
+                continue;
+            }
+            if (! function(current.index))
+            {
+                return false;
+            }
+            link = &m_items[*link].next;
+        }
+        return true;
+    }
+
+    std::size_t m_rank_count;
+    std::vector<std::size_t> m_lower;
+    std::vector<std::size_t> m_upper;
+    std::vector<item> m_items;
+    std::vector<std::size_t> m_nodes;
+    std::vector<std::size_t> m_ranks;
+    std::vector<std::size_t> m_start_counts;
+    rank_set m_starts;
+    std::vector<bool> m_active;
+};
+
+
+// Visits the pairs of sections crossed by the sweep line with overlapping
+// boxes
+template <typename Sections, typename Visitor>
+class section_sweep_visitor
+{
+public:
+    section_sweep_visitor(Sections const& sections, Visitor& visitor)
+        : m_sections(sections)
+        , m_visitor(visitor)
+        , m_active(sections)
+        , m_interrupted(false)
+    {}
+
+    template <typename Event, typename Queue>
+    inline void apply(Event const& event, Queue& )
+    {
+        if (event.leave)
+        {
+            m_active.erase(event.index);
+            return;
+        }
+
+        std::size_t const index = event.index;
+        bool const completed = m_active.visit(index, [&](std::size_t other)
+        {
+            // The pairs are visited in the order of the sections
+            bool const before = other < index;
+            return m_visitor.apply(m_sections[before ? other : index],
+                                   m_sections[before ? index : other]);
+        });
+
+        if (! completed)
+        {
+            m_interrupted = true;
+            return;
+        }
+
+        m_active.insert(index);
+    }
+
+    inline bool interrupted() const
+    {
+        return m_interrupted;
+    }
+
+private:
+    Sections const& m_sections;
+    Visitor& m_visitor;
+    active_sections m_active;
+    bool m_interrupted;
+};
+
+
+template <typename SweepVisitor>
+struct section_sweep_interrupt_policy
+{
+    static bool const enabled = true;
+
+    explicit section_sweep_interrupt_policy(SweepVisitor const& visitor)
+        : m_visitor(visitor)
+    {}
+
+    template <typename Event>
+    inline bool apply(Event const& ) const
+    {
+        return m_visitor.interrupted();
+    }
+
+    SweepVisitor const& m_visitor;
+};
+
+
+// Visits the pairs of sections with overlapping boxes, like partition,
+// sweeping a line along the x axis. The visitor returns false to stop.
+// Returns false if interrupted.
+template <typename Sections, typename Visitor>
+inline bool sweep_sections(Sections const& sections, Visitor& visitor)
+{
+    typedef typename boost::range_value<Sections>::type section_type;
+    typedef section_event
+        <
+            typename geometry::coordinate_type
+                <
+                    typename section_type::box_type
+                >::type
+        > event_type;
+    typedef std::priority_queue
+        <
+            event_type, std::vector<event_type>, section_event_greater
+        > queue_type;
+    typedef section_sweep_visitor<Sections, Visitor> sweep_visitor_type;
+
+    queue_type queue;
+    section_sweep_initializer<Sections> initializer;
+    sweep_visitor_type sweep_visitor(sections, visitor);
+
+    geometry::sweep(sections, queue, initializer, sweep_visitor,
+                    section_sweep_interrupt_policy<sweep_visitor_type>(sweep_visitor));
+
+    return ! sweep_visitor.interrupted();
+}
+
+
+// Visits the pairs of sections of one geometry with overlapping boxes,
+// with the plane sweep if it is requested with the strategy,
+// otherwise with partition
+template
+<
+    typename Box,
+    typename Sections,
+    typename Visitor,
+    typename Strategy
+>
+inline bool visit_overlapping_sections(Sections const& sections,
+                                       Visitor& visitor,
+                                       Strategy const& strategy,
+                                       std::false_type /*use_plane_sweep*/)
+{
+    return geometry::partition
+        <
+            Box
+        >::apply(sections, visitor,
+                 detail::section::get_section_box<Strategy>(strategy),
+                 detail::section::overlaps_section_box<Strategy>(strategy));
+}
+
+template
+<
+    typename Box,
+    typename Sections,
+    typename Visitor,
+    typename Strategy
+>
+inline bool visit_overlapping_sections(Sections const& sections,
+                                       Visitor& visitor,
+                                       Strategy const& ,
+                                       std::true_type /*use_plane_sweep*/)
+{
+    return sweep_sections(sections, visitor);
+}
+
+template
+<
+    typename Box,
+    typename Sections,
+    typename Visitor,
+    typename Strategy
+>
+inline bool visit_overlapping_sections(Sections const& sections,
+                                       Visitor& visitor,
+                                       Strategy const& strategy)
+{
+    return visit_overlapping_sections<Box>(sections, visitor, strategy,
+                                           use_plane_sweep<Strategy>());
+}
+
+
+}} // namespace detail::section
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+    \brief Returns the strategy requesting the plane sweep of the monotonic
+        sections of a geometry in the computation of its self turns
+    \details The pairs of sections are found by sweeping a line along
+        the x axis instead of partitioning the sections. Only the pairs of
+        sections with overlapping boxes are visited, in O(n log n + k) for
+        n sections and k pairs, where partition also visits pairs of
+        sections which do not overlap. The partition is not replaced: with
+        its cheap rejection of these pairs it is usually as fast or faster,
+        e.g. for zigzagging rings. The sweep can be requested where the
+        visited pairs are expensive. It is used by is_valid, is_simple and
+        other algorithms computing self turns in the cartesian coordinate
+        system.
+    \ingroup sectionalize
+    \param strategy umbrella strategy used by the algorithm
+ */
+template <typename Strategy>
+inline detail::section::plane_sweep_strategy<Strategy>
+    with_plane_sweep(Strategy const& strategy)
+{
+    return detail::section::plane_sweep_strategy<Strategy>(strategy);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_SWEEP_HPP
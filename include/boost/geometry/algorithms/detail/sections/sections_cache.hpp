@@ -0,0 +1,275 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTIONS_CACHE_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTIONS_CACHE_HPP
+
+#include <type_traits>
+#include <utility>
+
+#include <boost/core/typeinfo.hpp>
+
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+
+#include <boost/geometry/core/point_type.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/policies/robustness/no_rescale_policy.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+    \brief Keeps the monotonic sections of a geometry to reuse them
+        in subsequent operations
+    \details The sections are created lazily, at the first operation which
+        needs them, once per orientation in which the geometry is processed,
+        and again if the type of the strategy differs from the one used
+        to create them.
+        The cache is used by get_turns and self_turns when it is passed
+        to an algorithm through with_sections_cache() and the operation
+        doesn't rescale the coordinates. Rescaled sections depend on the
+        envelopes of both geometries, so they cannot be reused. By default
+        the algorithms benefiting from the cache are disjoint, intersects,
+        relate, relation and the predicates based on them (e.g. within,
+        touches, crosses) if one of the geometries is a point, a multi point
+        or linear, and is_simple. Relate of two areal geometries,
+        is_valid of areal geometries, intersection, union, difference and
+        sym_difference rescale, unless BOOST_GEOMETRY_NO_ROBUSTNESS is
+        defined, and then they benefit as well.
+    \note The geometry must not be modified nor destroyed while the cache
+        is in use. The strategies used with the cache must be equal if
+        their types are the same. The cache is not thread-safe.
+    \ingroup sectionalize
+    \tparam Geometry type of the cached geometry
+ */
+template <typename Geometry>
+class sections_cache
+{
+public:
+    typedef Geometry geometry_type;
+    typedef model::box<typename geometry::point_type<Geometry>::type> box_type;
+    typedef geometry::sections<box_type, 2> sections_type;
+    typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
+
+    explicit sections_cache(Geometry const& geometry)
+        : m_geometry(geometry)
+    {
+        m_strategy[0] = nullptr;
+        m_strategy[1] = nullptr;
+    }
+
+    inline Geometry const& geometry() const
+    {
+        return m_geometry;
+    }
+
+    template <bool Reverse, typename Strategy>
+    inline sections_type const& get(Strategy const& strategy)
+    {
+        boost::core::typeinfo const& strategy_type = BOOST_CORE_TYPEID(Strategy);
+        if (m_strategy[Reverse] == nullptr || *m_strategy[Reverse] != strategy_type)
+        {
+            m_sections[Reverse].clear();
+            geometry::sectionalize<Reverse, dimensions>(m_geometry,
+                                                        detail::no_rescale_policy(),
+                                                        m_sections[Reverse],
+                                                        strategy);
+            m_strategy[Reverse] = &strategy_type;
+        }
+        return m_sections[Reverse];
+    }
+
+    //! Releases the sections, they are recreated at the next use
+    inline void clear()
+    {
+        for (int i = 0; i < 2; i++)
+        {
+            m_sections[i].clear();
+            m_strategy[i] = nullptr;
+        }
+    }
+
+private:
+    Geometry const& m_geometry;
+    sections_type m_sections[2];
+    // Type of the strategy used to create the sections, or null
+    boost::core::typeinfo const* m_strategy[2];
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace section
+{
+
+// Umbrella strategy carrying a sections_cache down to get_turns.
+template <typename Strategy, typename Geometry>
+class cached_sections_strategy
+    : public Strategy
+{
+public:
+    typedef geometry::sections_cache<Geometry> sections_cache_type;
+
+    cached_sections_strategy(Strategy const& strategy,
+                             sections_cache_type& cache)
+        : Strategy(strategy)
+        , m_cache(&cache)
+    {}
+
+    inline Strategy const& base() const
+    {
+        return *this;
+    }
+
+    inline sections_cache_type& sections_cache() const
+    {
+        return *m_cache;
+    }
+
+private:
+    sections_cache_type* m_cache;
+};
+
+
+// True if the strategy carries the cache of sections of Geometry usable as Sections
+template <typename Strategy, typename Geometry, typename Sections>
+struct is_cached_sections_strategy
+    : std::false_type
+{};
+
+template <typename Strategy, typename Geometry, typename Sections>
+struct is_cached_sections_strategy
+    <
+        cached_sections_strategy<Strategy, Geometry>, Geometry, Sections
+    >
+    : std::is_same
+        <
+            typename geometry::sections_cache<Geometry>::sections_type,
+            Sections
+        >
+{};
+
+
+template
+<
+    bool Reverse,
+    typename DimensionVector,
+    typename Geometry,
+    typename Sections,
+    typename RobustPolicy,
+    typename Strategy,
+    bool UseCache = false
+>
+struct get_sections
+{
+    static inline Sections const& apply(Geometry const& geometry,
+                                        RobustPolicy const& robust_policy,
+                                        Sections& sections,
+                                        Strategy const& strategy,
+                                        int source_index)
+    {
+        geometry::sectionalize<Reverse, DimensionVector>(geometry, robust_policy,
+                                                         sections, strategy,
+                                                         source_index);
+        return sections;
+    }
+};
+
+template
+<
+    bool Reverse,
+    typename DimensionVector,
+    typename Geometry,
+    typename Sections,
+    typename RobustPolicy,
+    typename Strategy
+>
+struct get_sections
+    <
+        Reverse, DimensionVector, Geometry, Sections, RobustPolicy, Strategy, true
+    >
+{
+    static inline Sections const& apply(Geometry const& geometry,
+                                        RobustPolicy const& robust_policy,
+                                        Sections& sections,
+                                        Strategy const& strategy,
+                                        int source_index)
+    {
+        if (&strategy.sections_cache().geometry() == &geometry)
+        {
+            // NOTE: the source_index of ring identifiers of cached sections
+            //   is always 0, it's not used by get_turns
+            return strategy.sections_cache().template get<Reverse>(strategy.base());
+        }
+
+        return get_sections
+            <
+                Reverse, DimensionVector, Geometry, Sections, RobustPolicy, Strategy
+            >::apply(geometry, robust_policy, sections, strategy, source_index);
+    }
+};
+
+// Returns the sections of the geometry, taken from the sections_cache
+// passed with the strategy if possible, otherwise stored in sections
+template
+<
+    bool Reverse,
+    typename DimensionVector,
+    typename Geometry,
+    typename Sections,
+    typename RobustPolicy,
+    typename Strategy
+>
+inline Sections const& sectionalize_or_get_cached(Geometry const& geometry,
+                                                  RobustPolicy const& robust_policy,
+                                                  Sections& sections,
+                                                  Strategy const& strategy,
+                                                  int source_index = 0)
+{
+    typedef is_cached_sections_strategy<Strategy, Geometry, Sections> is_cached;
+
+    static const bool use_cache = is_cached::value
+        && std::is_same<RobustPolicy, detail::no_rescale_policy>::value
+        && std::is_same
+            <
+                DimensionVector,
+                std::integer_sequence<std::size_t, 0, 1>
+            >::value;
+
+    return get_sections
+        <
+            Reverse, DimensionVector, Geometry, Sections, RobustPolicy, Strategy,
+            use_cache
+        >::apply(geometry, robust_policy, sections, strategy, source_index);
+}
+
+}} // namespace detail::section
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+    \brief Returns the strategy passing the sections_cache to the algorithm
+    \ingroup sectionalize
+    \param strategy umbrella strategy used by the algorithm
+    \param cache sections of one of the geometries passed to the algorithm
+ */
+template <typename Strategy, typename Geometry>
+inline detail::section::cached_sections_strategy<Strategy, Geometry>
+    with_sections_cache(Strategy const& strategy, sections_cache<Geometry>& cache)
+{
+    return detail::section::cached_sections_strategy
+        <
+            Strategy, Geometry
+        >(strategy, cache);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTIONS_CACHE_HPP
@@ -0,0 +1,265 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_SIMPLIFY_VISVALINGAM_WHYATT_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_SIMPLIFY_VISVALINGAM_WHYATT_HPP
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace simplify
+{
+
+
+// Binary min heap of the vertices of a range, keyed by their areas,
+// keeping the position of each vertex so its key can be changed.
+// Vertices with the same area are ordered by their index.
+template <typename Areas>
+class effective_area_heap
+{
+public:
+    explicit effective_area_heap(Areas const& areas)
+        : m_areas(areas)
+        , m_positions(boost::size(areas), 0)
+    {}
+
+    // Builds the heap of the vertices [first, last)
+    inline void assign(std::size_t first, std::size_t last)
+    {
+        m_heap.clear();
+        for (std::size_t i = first; i < last; i++)
+        {
+            m_positions[i] = m_heap.size();
+            m_heap.push_back(i);
+        }
+        for (std::size_t i = m_heap.size() / 2; i > 0; i--)
+        {
+            down(i - 1);
+        }
+    }
+
+    inline bool empty() const
+    {
+        return m_heap.empty();
+    }
+
+    inline std::size_t pop()
+    {
+        std::size_t const result = m_heap.front();
+        swap_at(0, m_heap.size() - 1);
+        m_heap.pop_back();
+        if (! m_heap.empty())
+        {
+            down(0);
+        }
+        return result;
+    }
+
+    // Restores the heap after the area of the vertex is changed
+    inline void update(std::size_t vertex)
+    {
+        up(m_positions[vertex]);
+        down(m_positions[vertex]);
+    }
+
+private:
+    inline bool less(std::size_t i, std::size_t j) const
+    {
+        std::size_t const vi = m_heap[i];
+        std::size_t const vj = m_heap[j];
+        if (m_areas[vi] < m_areas[vj] || m_areas[vj] < m_areas[vi])
+        {
+            return m_areas[vi] < m_areas[vj];
+        }
+        return vi < vj;
+    }
+
+    inline void swap_at(std::size_t i, std::size_t j)
+    {
+        std::swap(m_heap[i], m_heap[j]);
+        m_positions[m_heap[i]] = i;
+        m_positions[m_heap[j]] = j;
+    }
+
+    inline void up(std::size_t i)
+    {
+        while (i > 0 && less(i, (i - 1) / 2))
+        {
+            swap_at(i, (i - 1) / 2);
+            i = (i - 1) / 2;
+        }
+    }
+
+    inline void down(std::size_t i)
+    {
+        std::size_t const size = m_heap.size();
+        for (;;)
+        {
+            std::size_t smallest = i;
+            std::size_t const left = 2 * i + 1;
+            if (left < size && less(left, smallest))
+            {
+                smallest = left;
+            }
+            if (left + 1 < size && less(left + 1, smallest))
+            {
+                smallest = left + 1;
+            }
+            if (smallest == i)
+            {
+                return;
+            }
+            swap_at(i, smallest);
+            i = smallest;
+        }
+    }
+
+    Areas const& m_areas;
+    std::vector<std::size_t> m_heap;
+    std::vector<std::size_t> m_positions;
+};
+
+
+/*!
+\brief Calculates the effective areas of the points of a range, the
+    areas of the triangles formed with their neighbours when the points
+    are removed by the Visvalingam-Whyatt algorithm
+\details The point with the smallest triangle is removed first, after
+    which the triangles of its neighbours are recalculated. The area of
+    a point is never less than the area of a point removed before it,
+    so the points kept by the algorithm for any minimal area are the
+    points with a larger effective area. The first and the last point
+    are never removed, they get the highest area.
+*/
+template <typename Range, typename Areas, typename AreaStrategy>
+inline void effective_areas(Range const& range, Areas& areas,
+                            AreaStrategy const& area_strategy)
+{
+    typedef typename boost::range_value<Range>::type point_type;
+    typedef typename boost::range_value<Areas>::type area_type;
+
+    std::size_t const size = boost::size(range);
+
+    auto const triangle_area = [&](std::size_t i0, std::size_t i1, std::size_t i2)
+    {
+        typename AreaStrategy::template state<point_type> state;
+        area_strategy.apply(geometry::range::at(range, i0),
+                            geometry::range::at(range, i1), state);
+        area_strategy.apply(geometry::range::at(range, i1),
+                            geometry::range::at(range, i2), state);
+        area_strategy.apply(geometry::range::at(range, i2),
+                            geometry::range::at(range, i0), state);
+        return area_type(geometry::math::abs(area_strategy.result(state)));
+    };
+
+    areas.assign(size, (std::numeric_limits<area_type>::max)());
+    if (size < 3)
+    {
+        return;
+    }
+
+    // Neighbours of the points not removed yet
+    std::vector<std::size_t> previous(size), next(size);
+    for (std::size_t i = 1; i + 1 < size; i++)
+    {
+        previous[i] = i - 1;
+        next[i] = i + 1;
+        areas[i] = triangle_area(i - 1, i, i + 1);
+    }
+
+    effective_area_heap<Areas> heap(areas);
+    heap.assign(1, size - 1);
+
+    while (! heap.empty())
+    {
+        std::size_t const vertex = heap.pop();
+        area_type const area = areas[vertex];
+        std::size_t const p = previous[vertex];
+        std::size_t const n = next[vertex];
+        next[p] = n;
+        previous[n] = p;
+
+        if (p > 0)
+        {
+            area_type const a = triangle_area(previous[p], p, n);
+            areas[p] = a < area ? area : a;
+            heap.update(p);
+        }
+        if (n + 1 < size)
+        {
+            area_type const a = triangle_area(p, n, next[n]);
+            areas[n] = a < area ? area : a;
+            heap.update(n);
+        }
+    }
+}
+
+
+/*!
+\brief Implements the simplify algorithm with the Visvalingam-Whyatt
+    algorithm, removing the points with the smallest effective area
+\details The points are kept if their effective area is larger than
+    the minimal area passed instead of the distance. The triangle areas
+    are calculated with the area strategy of the umbrella strategy,
+    which is available in all coordinate systems.
+\note The effective areas are calculated in O(n log n), the removed
+    points are kept in a heap with the areas of their triangles.
+*/
+class visvalingam_whyatt
+{
+public:
+    template <typename Range, typename OutputIterator, typename Area, typename Strategies>
+    static inline OutputIterator apply(Range const& range,
+                                       OutputIterator out,
+                                       Area const& min_area,
+                                       Strategies const& strategies)
+    {
+        typedef typename boost::range_value<Range>::type point_type;
+
+        auto area_strategy = strategies.area(range);
+        typedef typename decltype(area_strategy)::template result_type
+            <
+                point_type
+            >::type area_type;
+
+        std::vector<area_type> areas;
+        detail::simplify::effective_areas(range, areas, area_strategy);
+
+        std::size_t i = 0;
+        for (auto it = boost::begin(range); it != boost::end(range); ++it, ++i)
+        {
+            if (min_area < areas[i])
+            {
+                *out = *it;
+                ++out;
+            }
+        }
+        return out;
+    }
+};
+
+
+}} // namespace detail::simplify
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_SIMPLIFY_VISVALINGAM_WHYATT_HPP
@@ -16,11 +16,7 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DISCRETE_FRECHET_DISTANCE_HPP
 
 #include <algorithm>
-
-#ifdef BOOST_GEOMETRY_DEBUG_FRECHET_DISTANCE
-#include <iostream>
-#endif
-
+#include <cstddef>
 #include <iterator>
 #include <utility>
 #include <vector>
@@ -29,7 +25,6 @@
 #include <boost/geometry/algorithms/detail/dummy_geometries.hpp>
 #include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
 #include <boost/geometry/algorithms/not_implemented.hpp>
-#include <boost/geometry/core/assert.hpp>
 #include <boost/geometry/core/tag.hpp>
 #include <boost/geometry/core/tags.hpp>
 #include <boost/geometry/core/point_type.hpp>
@@ -37,8 +32,10 @@
 #include <boost/geometry/strategies/discrete_distance/cartesian.hpp>
 #include <boost/geometry/strategies/discrete_distance/geographic.hpp>
 #include <boost/geometry/strategies/discrete_distance/spherical.hpp>
+#include <boost/geometry/strategies/distance.hpp>
 #include <boost/geometry/strategies/distance_result.hpp>
 #include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/type_traits_std.hpp>
 
 
 namespace boost { namespace geometry
@@ -48,27 +45,165 @@ namespace boost { namespace geometry
 namespace detail { namespace discrete_frechet_distance
 {
 
-// TODO: The implementation should calculate comparable distances
 
-template <typename SizeType1, typename SizeType2, typename ResultType>
-class coup_mat
+template <typename Strategies>
+inline auto comparable_strategy(Strategies const& strategies)
+{
+    auto const strategy = strategies.distance(dummy_point(), dummy_point());
+    return geometry::strategy::distance::services::get_comparable
+        <
+            util::remove_cref_t<decltype(strategy)>
+        >::apply(strategy);
+}
+
+// Cell of the coupling matrix, the comparable coupling distance and the
+// points of which it is the distance
+template <typename Distance>
+struct coupling_cell
+{
+    Distance distance;
+    std::size_t index1;
+    std::size_t index2;
+};
+
+// Calculates the coupling matrix row by row, the rows along the second
+// range, keeping only the previous row.
+template <typename Range1, typename Range2, typename Distance, typename Strategy>
+inline coupling_cell<Distance> coupling_measure(Range1 const& r1, Range2 const& r2,
+                                                Strategy const& cstrategy)
+{
+    typedef coupling_cell<Distance> cell_type;
+
+    auto const min_cell = [](cell_type const& c1, cell_type const& c2)
+    {
+        return c2.distance < c1.distance ? c2 : c1;
+    };
+    auto const max_cell = [](cell_type const& c1, cell_type const& c2)
+    {
+        return c1.distance < c2.distance ? c2 : c1;
+    };
+
+    std::size_t const a = boost::size(r1);
+    std::size_t const b = boost::size(r2);
+
+    std::vector<cell_type> previous(b), current(b);
+    for (std::size_t i = 0; i < a; i++)
+    {
+        auto const& p1 = range::at(r1, i);
+        for (std::size_t j = 0; j < b; j++)
+        {
+            cell_type const cell{cstrategy.apply(p1, range::at(r2, j)), i, j};
+            if (i == 0 && j == 0)
+            {
+                current[j] = cell;
+            }
+            else if (i == 0)
+            {
+                current[j] = max_cell(current[j - 1], cell);
+            }
+            else if (j == 0)
+            {
+                current[j] = max_cell(previous[j], cell);
+            }
+            else
+            {
+                current[j] = max_cell(min_cell(current[j - 1],
+                                               min_cell(previous[j], previous[j - 1])),
+                                      cell);
+            }
+        }
+        std::swap(previous, current);
+    }
+    return previous[b - 1];
+}
+
+// Checks if the coupling measure is not larger than the maximal distance,
+// keeping the reachable part of the previous row of the free space. The
+// free cells of a row reachable from the previous row start at the first
+// reachable cell of the previous row, so the cells before are skipped, and
+// end after the last reachable cell of the previous row, continued by the
+// free cells next to it. If no cell of a row is reachable, the rest of the
+// matrix is not either.
+template <typename Range1, typename Range2, typename Distance, typename Strategy>
+inline bool coupling_within(Range1 const& r1, Range2 const& r2,
+                            Distance const& max_distance,
+                            Strategy const& cstrategy)
 {
-public:
-    coup_mat(SizeType1 w, SizeType2 h)
-        : m_data(w * h,-1), m_width(w), m_height(h)
-    {}
+    std::size_t const a = boost::size(r1);
+    std::size_t const b = boost::size(r2);
+
+    auto const is_free = [&](std::size_t i, std::size_t j)
+    {
+        return ! (max_distance < cstrategy.apply(range::at(r1, i), range::at(r2, j)));
+    };
 
-    ResultType & operator()(SizeType1 i, SizeType2 j)
+    if (! is_free(0, 0) || ! is_free(a - 1, b - 1))
     {
-        BOOST_GEOMETRY_ASSERT(i < m_width && j < m_height);
-        return m_data[j * m_width + i];
+        return false;
     }
 
-private:
-    std::vector<ResultType> m_data;
-    SizeType1 m_width;
-    SizeType2 m_height;
-};
+    std::vector<char> previous(b, 0), current(b, 0);
+
+    // Reachable cells [first, last] of the previous row
+    std::size_t first = 0;
+    std::size_t last = 0;
+    previous[0] = 1;
+    for (std::size_t j = 1; j < b && is_free(0, j); j++)
+    {
+        previous[j] = 1;
+        last = j;
+    }
+
+    for (std::size_t i = 1; i < a; i++)
+    {
+        bool found = false;
+        std::size_t row_first = 0;
+        std::size_t row_last = 0;
+        for (std::size_t j = first; j < b; j++)
+        {
+            bool const from_previous = j <= last
+                && (previous[j] != 0 || (j > first && previous[j - 1] != 0));
+            bool const from_current = j > first && current[j - 1] != 0;
+            bool const from_diagonal = j == last + 1 && previous[last] != 0;
+
+            if (! from_previous && ! from_current && ! from_diagonal)
+            {
+                current[j] = 0;
+                if (j > last)
+                {
+                    break;
+                }
+                continue;
+            }
+
+            current[j] = is_free(i, j) ? 1 : 0;
+            if (current[j] != 0)
+            {
+                if (! found)
+                {
+                    row_first = j;
+                    found = true;
+                }
+                row_last = j;
+            }
+            else if (j > last)
+            {
+                break;
+            }
+        }
+
+        if (! found)
+        {
+            return false;
+        }
+
+        std::swap(previous, current);
+        first = row_first;
+        last = row_last;
+    }
+
+    return last == b - 1;
+}
 
 struct linestring_linestring
 {
@@ -76,64 +211,69 @@ struct linestring_linestring
     static inline auto apply(Linestring1 const& ls1, Linestring2 const& ls2,
                              Strategies const& strategies)
     {
-        typedef typename distance_result
-            <
-                typename point_type<Linestring1>::type,
-                typename point_type<Linestring2>::type,
-                Strategies
-            >::type result_type;
-        typedef typename boost::range_size<Linestring1>::type size_type1;
-        typedef typename boost::range_size<Linestring2>::type size_type2;
+        typedef typename point_type<Linestring1>::type point_type1;
+        typedef typename point_type<Linestring2>::type point_type2;
 
         boost::geometry::detail::throw_on_empty_input(ls1);
         boost::geometry::detail::throw_on_empty_input(ls2);
 
         // We can assume the inputs are not empty
         auto const strategy = strategies.distance(dummy_point(), dummy_point());
+        auto const cstrategy = comparable_strategy(strategies);
 
-        size_type1 const a = boost::size(ls1);
-        size_type2 const b = boost::size(ls2);
-
-        //Coupling Matrix CoupMat(a,b,-1);
-        coup_mat<size_type1, size_type2, result_type> coup_matrix(a, b);
+        typedef typename geometry::strategy::distance::services::return_type
+            <
+                util::remove_cref_t<decltype(cstrategy)>,
+                point_type1, point_type2
+            >::type comparable_type;
 
-        result_type const not_feasible = -100;
-        //findin the Coupling Measure
-        for (size_type1 i = 0 ; i < a ; i++ )
+        // The coupling measure is symmetric, the rows are along the shorter
+        // linestring
+        if (boost::size(ls2) <= boost::size(ls1))
         {
-            for (size_type2 j = 0 ; j < b ; j++ )
-            {
-                result_type dis = strategy.apply(range::at(ls1,i), range::at(ls2,j));
-                if(i==0 && j==0)
-                    coup_matrix(i,j) = dis;
-                else if(i==0 && j>0)
-                    coup_matrix(i,j) =
-                        (std::max)(coup_matrix(i,j-1), dis);
-                else if(i>0 && j==0)
-                    coup_matrix(i,j) =
-                        (std::max)(coup_matrix(i-1,j), dis);
-                else if(i>0 && j>0)
-                    coup_matrix(i,j) =
-                        (std::max)((std::min)(coup_matrix(i,j-1),
-                                              (std::min)(coup_matrix(i-1,j),
-                                                         coup_matrix(i-1,j-1))),
-                                   dis);
-                else
-                    coup_matrix(i,j) = not_feasible;
-            }
+            auto const cell = coupling_measure<Linestring1, Linestring2, comparable_type>(
+                                    ls1, ls2, cstrategy);
+            return strategy.apply(range::at(ls1, cell.index1),
+                                  range::at(ls2, cell.index2));
         }
 
-        #ifdef BOOST_GEOMETRY_DEBUG_FRECHET_DISTANCE
-        //Print CoupLing Matrix
-        for(size_type i = 0; i <a; i++)
+        auto const cell = coupling_measure<Linestring2, Linestring1, comparable_type>(
+                                ls2, ls1, cstrategy);
+        return strategy.apply(range::at(ls1, cell.index2),
+                              range::at(ls2, cell.index1));
+    }
+};
+
+struct linestring_linestring_within
+{
+    template
+    <
+        typename Linestring1, typename Linestring2,
+        typename Distance, typename Strategies
+    >
+    static inline bool apply(Linestring1 const& ls1, Linestring2 const& ls2,
+                             Distance const& max_distance,
+                             Strategies const& strategies)
+    {
+        typedef typename point_type<Linestring1>::type point_type1;
+        typedef typename point_type<Linestring2>::type point_type2;
+
+        boost::geometry::detail::throw_on_empty_input(ls1);
+        boost::geometry::detail::throw_on_empty_input(ls2);
+
+        auto const cstrategy = comparable_strategy(strategies);
+        typedef util::remove_cref_t<decltype(cstrategy)> comparable_strategy_type;
+
+        auto const cmax = geometry::strategy::distance::services::result_from_distance
+            <
+                comparable_strategy_type, point_type1, point_type2
+            >::apply(cstrategy, max_distance);
+
+        if (boost::size(ls2) <= boost::size(ls1))
         {
-            for(size_type j = 0; j <b; j++)
-            std::cout << coup_matrix(i,j) << " ";
-            std::cout << std::endl;
+            return coupling_within(ls1, ls2, cmax, cstrategy);
         }
-        #endif
-
-        return coup_matrix(a-1,b-1);
+        return coupling_within(ls2, ls1, cmax, cstrategy);
     }
 };
 
@@ -164,6 +304,27 @@ struct discrete_frechet_distance
     : detail::discrete_frechet_distance::linestring_linestring
 {};
 
+template
+<
+    typename Geometry1,
+    typename Geometry2,
+    typename Tag1 = typename tag<Geometry1>::type,
+    typename Tag2 = typename tag<Geometry2>::type
+>
+struct discrete_frechet_distance_within : not_implemented<Tag1, Tag2>
+{};
+
+template <typename Linestring1, typename Linestring2>
+struct discrete_frechet_distance_within
+    <
+        Linestring1,
+        Linestring2,
+        linestring_tag,
+        linestring_tag
+    >
+    : detail::discrete_frechet_distance::linestring_linestring_within
+{};
+
 } // namespace dispatch
 #endif // DOXYGEN_NO_DISPATCH
 
@@ -223,6 +384,62 @@ struct discrete_frechet_distance<default_strategy, false>
     }
 };
 
+template
+<
+    typename Strategies,
+    bool IsUmbrella = strategies::detail::is_umbrella_strategy<Strategies>::value
+>
+struct discrete_frechet_distance_within
+{
+    template <typename Geometry1, typename Geometry2, typename Distance>
+    static inline bool apply(Geometry1 const& geometry1, Geometry2 const& geometry2,
+                             Distance const& max_distance,
+                             Strategies const& strategies)
+    {
+        return dispatch::discrete_frechet_distance_within
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2, max_distance, strategies);
+    }
+};
+
+template <typename Strategy>
+struct discrete_frechet_distance_within<Strategy, false>
+{
+    template <typename Geometry1, typename Geometry2, typename Distance>
+    static inline bool apply(Geometry1 const& geometry1, Geometry2 const& geometry2,
+                             Distance const& max_distance,
+                             Strategy const& strategy)
+    {
+        using strategies::discrete_distance::services::strategy_converter;
+        return dispatch::discrete_frechet_distance_within
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2, max_distance,
+                     strategy_converter<Strategy>::get(strategy));
+    }
+};
+
+template <>
+struct discrete_frechet_distance_within<default_strategy, false>
+{
+    template <typename Geometry1, typename Geometry2, typename Distance>
+    static inline bool apply(Geometry1 const& geometry1, Geometry2 const& geometry2,
+                             Distance const& max_distance,
+                             default_strategy const&)
+    {
+        typedef typename strategies::discrete_distance::services::default_strategy
+            <
+                Geometry1, Geometry2
+            >::type strategies_type;
+
+        return dispatch::discrete_frechet_distance_within
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2, max_distance, strategies_type());
+    }
+};
+
 } // namespace resolve_strategy
 
 
@@ -291,6 +508,61 @@ inline auto discrete_frechet_distance(Geometry1 const& geometry1,
             >::apply(geometry1, geometry2, default_strategy());
 }
 
+/*!
+\brief Check if the discrete Frechet distance between two geometries
+       (currently LineString-LineString) is not larger than a distance,
+       using specified strategy.
+\details Only the part of the coupling matrix reachable within the distance
+       is visited, and the check stops as soon as no further cell can be
+       reached. This is usually much faster than calculating the distance.
+\ingroup discrete_frechet_distance
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Distance numerical type
+\tparam Strategy A type fulfilling a DistanceStrategy concept
+\param geometry1 Input geometry
+\param geometry2 Input geometry
+\param max_distance Maximal Frechet distance
+\param strategy Distance strategy to be used to calculate Pt-Pt distance
+\return True if the discrete Frechet distance is not larger than max_distance
+
+\qbk{distinguish,with strategy}
+*/
+template <typename Geometry1, typename Geometry2, typename Distance, typename Strategy>
+inline bool discrete_frechet_distance_within(Geometry1 const& geometry1,
+                                             Geometry2 const& geometry2,
+                                             Distance const& max_distance,
+                                             Strategy const& strategy)
+{
+    return resolve_strategy::discrete_frechet_distance_within
+            <
+                Strategy
+            >::apply(geometry1, geometry2, max_distance, strategy);
+}
+
+/*!
+\brief Check if the discrete Frechet distance between two geometries
+       (currently LineString-LineString) is not larger than a distance.
+\ingroup discrete_frechet_distance
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Distance numerical type
+\param geometry1 Input geometry
+\param geometry2 Input geometry
+\param max_distance Maximal Frechet distance
+\return True if the discrete Frechet distance is not larger than max_distance
+*/
+template <typename Geometry1, typename Geometry2, typename Distance>
+inline bool discrete_frechet_distance_within(Geometry1 const& geometry1,
+                                             Geometry2 const& geometry2,
+                                             Distance const& max_distance)
+{
+    return resolve_strategy::discrete_frechet_distance_within
+            <
+                default_strategy
+            >::apply(geometry1, geometry2, max_distance, default_strategy());
+}
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_ALGORITHMS_DISCRETE_FRECHET_DISTANCE_HPP
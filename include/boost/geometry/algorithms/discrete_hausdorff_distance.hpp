@@ -21,14 +21,18 @@
 #include <iostream>
 #endif
 
+#include <cstddef>
 #include <iterator>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include <limits>
 
+#include <boost/geometry/algorithms/comparable_distance.hpp>
 #include <boost/geometry/algorithms/detail/dummy_geometries.hpp>
 #include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
 #include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/point_type.hpp>
 #include <boost/geometry/core/tag.hpp>
 #include <boost/geometry/core/tags.hpp>
@@ -36,14 +40,13 @@
 #include <boost/geometry/strategies/discrete_distance/cartesian.hpp>
 #include <boost/geometry/strategies/discrete_distance/geographic.hpp>
 #include <boost/geometry/strategies/discrete_distance/spherical.hpp>
+#include <boost/geometry/strategies/distance.hpp>
 #include <boost/geometry/strategies/distance_result.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/util/parallel.hpp>
 #include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/type_traits_std.hpp>
 
-// Note that in order for this to work umbrella strategy has to contain
-// index strategies.
-#ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
-#include <boost/geometry/index/rtree.hpp>
-#endif // BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
 
 namespace boost { namespace geometry
 {
@@ -52,7 +55,17 @@ namespace boost { namespace geometry
 namespace detail { namespace discrete_hausdorff_distance
 {
 
-// TODO: The implementation should calculate comparable distances
+
+template <typename Strategies>
+inline auto comparable_strategy(Strategies const& strategies)
+{
+    auto const strategy = strategies.distance(dummy_point(), dummy_point());
+    return geometry::strategy::distance::services::get_comparable
+        <
+            util::remove_cref_t<decltype(strategy)>
+        >::apply(strategy);
+}
+
 
 struct point_range
 {
@@ -60,79 +73,240 @@ struct point_range
     static inline auto apply(Point const& pnt, Range const& rng,
                              Strategies const& strategies)
     {
-        typedef typename distance_result
-            <
-                Point,
-                typename point_type<Range>::type,
-                Strategies
-            >::type result_type;
-
         typedef typename boost::range_size<Range>::type size_type;
 
         boost::geometry::detail::throw_on_empty_input(rng);
 
         auto const strategy = strategies.distance(dummy_point(), dummy_point());
+        auto const cstrategy = comparable_strategy(strategies);
 
         size_type const n = boost::size(rng);
-        result_type dis_min = 0;
-        bool is_dis_min_set = false;
+        size_type nearest = 0;
+        auto dis_min = cstrategy.apply(pnt, range::at(rng, 0));
 
-        for (size_type i = 0 ; i < n ; i++)
+        for (size_type i = 1 ; i < n ; i++)
         {
-            result_type dis_temp = strategy.apply(pnt, range::at(rng, i));
-            if (! is_dis_min_set || dis_temp < dis_min)
+            auto const dis_temp = cstrategy.apply(pnt, range::at(rng, i));
+            if (dis_temp < dis_min)
             {
                 dis_min = dis_temp;
-                is_dis_min_set = true;
+                nearest = i;
             }
         }
-        return dis_min;
+        return strategy.apply(pnt, range::at(rng, nearest));
+    }
+
+    template <typename Point, typename Range, typename Strategies>
+    static inline auto apply(Point const& pnt, Range const& rng,
+                             Strategies const& strategies,
+                             parallel_execution const& )
+    {
+        return apply(pnt, rng, strategies);
     }
 };
 
+
+// The points of the second range in a packed rtree, used for cartesian
+// ranges not too small
+template <typename Range>
+struct use_rtree
+{
+    static const bool value = std::is_same
+        <
+            typename cs_tag<Range>::type, cartesian_tag
+        >::value;
+
+    static inline bool apply(Range const& range)
+    {
+        return value && boost::size(range) > 32;
+    }
+};
+
+template <typename Range, bool UseRtree = use_rtree<Range>::value>
+class nearest_finder
+{
+    typedef typename point_type<Range>::type point_type;
+
+public:
+    nearest_finder(Range const& range)
+        : m_range(range)
+    {}
+
+    // Finds the nearest point, from the hint on, until a point not further
+    // than the limit is found (then the nearest distance is not known).
+    // Returns false in that case.
+    template <typename Point, typename Distance, typename Strategy>
+    inline bool apply(Point const& point, bool is_limited, Distance const& limit,
+                      std::size_t& hint, Distance& distance,
+                      Strategy const& cstrategy) const
+    {
+        std::size_t const n = boost::size(m_range);
+        std::size_t nearest = hint;
+        distance = cstrategy.apply(point, range::at(m_range, hint));
+        for (std::size_t k = 1; k < n; k++)
+        {
+            if (is_limited && ! (limit < distance))
+            {
+                hint = nearest;
+                return false;
+            }
+
+            std::size_t const i = (hint + k) % n;
+            Distance const d = cstrategy.apply(point, range::at(m_range, i));
+            if (d < distance)
+            {
+                distance = d;
+                nearest = i;
+            }
+        }
+        hint = nearest;
+        return ! is_limited || limit < distance;
+    }
+
+private:
+    Range const& m_range;
+};
+
+template <typename Range>
+class nearest_finder<Range, true>
+{
+    typedef typename point_type<Range>::type point_type;
+    typedef std::pair<point_type, std::size_t> value_type;
+    typedef index::rtree<value_type, index::rstar<16> > rtree_type;
+
+public:
+    nearest_finder(Range const& range)
+        : m_range(range)
+        , m_scan(range)
+    {
+        if (use_rtree<Range>::apply(range))
+        {
+            std::vector<value_type> values;
+            values.reserve(boost::size(range));
+            std::size_t i = 0;
+            for (auto it = boost::begin(range); it != boost::end(range); ++it, ++i)
+            {
+                values.emplace_back(*it, i);
+            }
+            // The packing algorithm is used by this constructor
+            m_rtree = rtree_type(values);
+        }
+    }
+
+    template <typename Point, typename Distance, typename Strategy>
+    inline bool apply(Point const& point, bool is_limited, Distance const& limit,
+                      std::size_t& hint, Distance& distance,
+                      Strategy const& cstrategy) const
+    {
+        if (m_rtree.empty())
+        {
+            return m_scan.apply(point, is_limited, limit, hint, distance, cstrategy);
+        }
+
+        // The point near the previous one is usually close enough
+        distance = cstrategy.apply(point, range::at(m_range, hint));
+        if (is_limited && ! (limit < distance))
+        {
+            return false;
+        }
+
+        value_type nearest;
+        m_rtree.query(index::nearest(point, 1), &nearest);
+        Distance const d = cstrategy.apply(point, nearest.first);
+        if (d < distance)
+        {
+            distance = d;
+            hint = nearest.second;
+        }
+        return ! is_limited || limit < distance;
+    }
+
+private:
+    Range const& m_range;
+    nearest_finder<Range, false> m_scan;
+    rtree_type m_rtree;
+};
+
+
+// The farthest point found by one thread, and the hint of its nearest search
+template <typename Distance>
+struct range_range_state
+{
+    bool is_set = false;
+    Distance max = Distance();
+    std::size_t index1 = 0;
+    std::size_t index2 = 0;
+    std::size_t hint = 0;
+};
+
 struct range_range
 {
     template <typename Range1, typename Range2, typename Strategies>
     static inline auto apply(Range1 const& r1, Range2 const& r2,
                              Strategies const& strategies)
     {
-        typedef typename distance_result
-            <
-                typename point_type<Range1>::type,
-                typename point_type<Range2>::type,
-                Strategies
-            >::type result_type;
+        return apply(r1, r2, strategies, parallel_execution(1));
+    }
 
-        typedef typename boost::range_size<Range1>::type size_type;
+    // For each point of the first range the nearest point of the second one
+    // is found, using comparable distances. The search is stopped when
+    // a point is found not further than the current maximum, so this point
+    // cannot change it (the early break of Taha and Hanbury). The nearest
+    // point of the previous point is checked first.
+    template <typename Range1, typename Range2, typename Strategies>
+    static inline auto apply(Range1 const& r1, Range2 const& r2,
+                             Strategies const& strategies,
+                             parallel_execution const& policy)
+    {
+        typedef typename point_type<Range1>::type point_type1;
+        typedef typename point_type<Range2>::type point_type2;
 
         boost::geometry::detail::throw_on_empty_input(r1);
         boost::geometry::detail::throw_on_empty_input(r2);
 
-        size_type const n = boost::size(r1);
-        result_type dis_max = 0;
+        auto const strategy = strategies.distance(dummy_point(), dummy_point());
+        auto const cstrategy = comparable_strategy(strategies);
 
-#ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
-        namespace bgi = boost::geometry::index;
-        typedef typename point_type<Range1>::type point_t;
-        typedef bgi::rtree<point_t, bgi::linear<4> > rtree_type;
-        rtree_type rtree(boost::begin(r2), boost::end(r2));
-        point_t res;
-#endif
+        typedef typename geometry::strategy::distance::services::return_type
+            <
+                util::remove_cref_t<decltype(cstrategy)>,
+                point_type1, point_type2
+            >::type comparable_type;
 
-        for (size_type i = 0 ; i < n ; i++)
+        typedef range_range_state<comparable_type> worker_state;
+
+        std::size_t const n = boost::size(r1);
+        std::vector<worker_state> states(
+            detail::parallel::worker_count(policy, n));
+
+        nearest_finder<Range2> const finder(r2);
+
+        detail::parallel::for_each_index(policy, n,
+            [&](std::size_t i, std::size_t worker)
+            {
+                worker_state& state = states[worker];
+                comparable_type distance;
+                if (finder.apply(range::at(r1, i), state.is_set, state.max,
+                                 state.hint, distance, cstrategy))
+                {
+                    state.is_set = true;
+                    state.max = distance;
+                    state.index1 = i;
+                    state.index2 = state.hint;
+                }
+            });
+
+        worker_state const* result = nullptr;
+        for (auto const& state : states)
         {
-#ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
-            size_type found = rtree.query(bgi::nearest(range::at(r1, i), 1), &res);
-            result_type dis_min = strategy.apply(range::at(r1,i), res);
-#else
-            result_type dis_min = point_range::apply(range::at(r1, i), r2, strategies);
-#endif
-            if (dis_min > dis_max )
+            if (state.is_set && (result == nullptr || result->max < state.max))
             {
-                dis_max = dis_min;
+                result = &state;
             }
         }
-        return dis_max;
+
+        return strategy.apply(range::at(r1, result->index1),
+                              range::at(r2, result->index2));
     }
 };
 
@@ -142,6 +316,14 @@ struct range_multi_range
     template <typename Range, typename Multi_range, typename Strategies>
     static inline auto apply(Range const& rng, Multi_range const& mrng,
                              Strategies const& strategies)
+    {
+        return apply(rng, mrng, strategies, parallel_execution(1));
+    }
+
+    template <typename Range, typename Multi_range, typename Strategies>
+    static inline auto apply(Range const& rng, Multi_range const& mrng,
+                             Strategies const& strategies,
+                             parallel_execution const& policy)
     {
         typedef typename distance_result
             <
@@ -159,7 +341,8 @@ struct range_multi_range
 
         for (size_type j = 0 ; j < b ; j++)
         {
-            result_type dis_max = range_range::apply(rng, range::at(mrng, j), strategies);
+            result_type dis_max = range_range::apply(rng, range::at(mrng, j),
+                                                     strategies, policy);
             if (dis_max > haus_dis)
             {
                 haus_dis = dis_max;
@@ -176,6 +359,14 @@ struct multi_range_multi_range
     template <typename Multi_Range1, typename Multi_range2, typename Strategies>
     static inline auto apply(Multi_Range1 const& mrng1, Multi_range2 const& mrng2,
                              Strategies const& strategies)
+    {
+        return apply(mrng1, mrng2, strategies, parallel_execution(1));
+    }
+
+    template <typename Multi_Range1, typename Multi_range2, typename Strategies>
+    static inline auto apply(Multi_Range1 const& mrng1, Multi_range2 const& mrng2,
+                             Strategies const& strategies,
+                             parallel_execution const& policy)
     {
         typedef typename distance_result
             <
@@ -193,7 +384,8 @@ struct multi_range_multi_range
 
         for (size_type i = 0 ; i < n ; i++)
         {
-            result_type dis_max = range_multi_range::apply(range::at(mrng1, i), mrng2, strategies);
+            result_type dis_max = range_multi_range::apply(range::at(mrng1, i), mrng2,
+                                                           strategies, policy);
             if (dis_max > haus_dis)
             {
                 haus_dis = dis_max;
@@ -264,12 +456,13 @@ struct discrete_hausdorff_distance
 {
     template <typename Geometry1, typename Geometry2>
     static inline auto apply(Geometry1 const& geometry1, Geometry2 const& geometry2,
-                             Strategies const& strategies)
+                             Strategies const& strategies,
+                             parallel_execution const& policy)
     {
         return dispatch::discrete_hausdorff_distance
             <
                 Geometry1, Geometry2
-            >::apply(geometry1, geometry2, strategies);
+            >::apply(geometry1, geometry2, strategies, policy);
     }
 };
 
@@ -278,14 +471,15 @@ struct discrete_hausdorff_distance<Strategy, false>
 {
     template <typename Geometry1, typename Geometry2>
     static inline auto apply(Geometry1 const& geometry1, Geometry2 const& geometry2,
-                             Strategy const& strategy)
+                             Strategy const& strategy,
+                             parallel_execution const& policy)
     {
         using strategies::discrete_distance::services::strategy_converter;
         return dispatch::discrete_hausdorff_distance
             <
                 Geometry1, Geometry2
             >::apply(geometry1, geometry2,
-                     strategy_converter<Strategy>::get(strategy));
+                     strategy_converter<Strategy>::get(strategy), policy);
     }
 };
 
@@ -294,7 +488,8 @@ struct discrete_hausdorff_distance<default_strategy, false>
 {
     template <typename Geometry1, typename Geometry2>
     static inline auto apply(Geometry1 const& geometry1, Geometry2 const& geometry2,
-                             default_strategy const&)
+                             default_strategy const&,
+                             parallel_execution const& policy)
     {
         typedef typename strategies::discrete_distance::services::default_strategy
             <
@@ -304,7 +499,7 @@ struct discrete_hausdorff_distance<default_strategy, false>
         return dispatch::discrete_hausdorff_distance
             <
                 Geometry1, Geometry2
-            >::apply(geometry1, geometry2, strategies_type());
+            >::apply(geometry1, geometry2, strategies_type(), policy);
     }
 };
 
@@ -337,7 +532,14 @@ struct discrete_hausdorff_distance<default_strategy, false>
 [discrete_hausdorff_distance_strategy_output]
 }
 */
-template <typename Geometry1, typename Geometry2, typename Strategy>
+template
+<
+    typename Geometry1, typename Geometry2, typename Strategy,
+    std::enable_if_t
+        <
+            ! detail::parallel::is_execution_policy<Geometry1>::value, int
+        > = 0
+>
 inline auto discrete_hausdorff_distance(Geometry1 const& geometry1,
                                         Geometry2 const& geometry2,
                                         Strategy const& strategy)
@@ -345,7 +547,7 @@ inline auto discrete_hausdorff_distance(Geometry1 const& geometry1,
     return resolve_strategy::discrete_hausdorff_distance
         <
             Strategy
-        >::apply(geometry1, geometry2, strategy);
+        >::apply(geometry1, geometry2, strategy, parallel_execution(1));
 }
 
 /*!
@@ -373,7 +575,58 @@ inline auto discrete_hausdorff_distance(Geometry1 const& geometry1,
     return resolve_strategy::discrete_hausdorff_distance
         <
             default_strategy
-        >::apply(geometry1, geometry2, default_strategy());
+        >::apply(geometry1, geometry2, default_strategy(), parallel_execution(1));
+}
+
+/*!
+\brief Calculate discrete Hausdorff distance between two geometries
+    concurrently, using specified strategy.
+\details The points of the first geometry are distributed over the threads
+    of the execution policy, each thread searching their nearest points.
+\ingroup discrete_hausdorff_distance
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Strategy A type fulfilling a DistanceStrategy concept
+\param policy Execution policy, defining the number of threads
+\param geometry1 Input geometry
+\param geometry2 Input geometry
+\param strategy Distance strategy to be used to calculate Pt-Pt distance
+
+\qbk{distinguish,parallel with strategy}
+*/
+template <typename Geometry1, typename Geometry2, typename Strategy>
+inline auto discrete_hausdorff_distance(parallel_execution const& policy,
+                                        Geometry1 const& geometry1,
+                                        Geometry2 const& geometry2,
+                                        Strategy const& strategy)
+{
+    return resolve_strategy::discrete_hausdorff_distance
+        <
+            Strategy
+        >::apply(geometry1, geometry2, strategy, policy);
+}
+
+/*!
+\brief Calculate discrete Hausdorff distance between two geometries
+    concurrently.
+\ingroup discrete_hausdorff_distance
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\param policy Execution policy, defining the number of threads
+\param geometry1 Input geometry
+\param geometry2 Input geometry
+
+\qbk{distinguish,parallel}
+*/
+template <typename Geometry1, typename Geometry2>
+inline auto discrete_hausdorff_distance(parallel_execution const& policy,
+                                        Geometry1 const& geometry1,
+                                        Geometry2 const& geometry2)
+{
+    return resolve_strategy::discrete_hausdorff_distance
+        <
+            default_strategy
+        >::apply(geometry1, geometry2, default_strategy(), policy);
 }
 
 }} // namespace boost::geometry
@@ -0,0 +1,349 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DISTANCE_INDEX_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DISTANCE_INDEX_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/closest_points.hpp>
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
+#include <boost/geometry/algorithms/detail/closest_points/utilities.hpp>
+#include <boost/geometry/algorithms/detail/distance/iterator_selector.hpp>
+#include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+#include <boost/geometry/algorithms/dispatch/distance.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/geometry/strategies/cartesian/point_in_poly_winding.hpp>
+#include <boost/geometry/strategies/closest_points/cartesian.hpp>
+#include <boost/geometry/strategies/detail.hpp>
+#include <boost/geometry/strategies/distance/services.hpp>
+
+#include <boost/geometry/util/parallel.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace distance_index
+{
+
+
+// The closest points are only available in cartesian coordinate systems,
+// the default strategies there calculate both distances and closest points
+template
+<
+    typename Geometry,
+    typename CSTag = typename cs_tag<Geometry>::type
+>
+struct default_strategies
+{
+    typedef typename strategies::distance::services::default_strategy
+        <
+            typename point_type<Geometry>::type, Geometry
+        >::type type;
+};
+
+template <typename Geometry>
+struct default_strategies<Geometry, cartesian_tag>
+{
+    typedef strategies::closest_points::cartesian<> type;
+};
+
+
+template
+<
+    typename Geometry,
+    typename Tag = typename tag_cast
+        <
+            typename tag<Geometry>::type, areal_tag
+        >::type
+>
+struct is_areal
+    : std::is_same<Tag, areal_tag>
+{};
+
+
+// The cartesian winding strategy only counts the segments crossing
+// the vertical line through the point below it, and the segments
+// containing the point
+template <typename Strategy>
+struct is_cartesian_winding
+    : std::false_type
+{};
+
+template <typename Point, typename PointOfSegment, typename CalculationType>
+struct is_cartesian_winding
+    <
+        strategy::within::cartesian_winding<Point, PointOfSegment, CalculationType>
+    >
+    : std::true_type
+{};
+
+
+}} // namespace detail::distance_index
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Index of the segments (or points) of a geometry, calculating the
+    distances and the closest points of many points to this geometry
+\details The segments of a linear or areal geometry, or the points of a
+    multi point, are stored in a packed rtree once, instead of in every
+    call of distance or closest_points. The nearest segment is searched with
+    comparable distances, the distance is calculated for this segment only.
+    For areal geometries the distance of a point inside is zero. In
+    cartesian coordinates, the segments crossing the vertical line below
+    a point are taken from the rtree to determine whether it is inside.
+    The queries do not modify the index, so they can be called concurrently,
+    and the batch functions optionally distribute the points over threads.
+\ingroup distance
+\tparam Geometry \tparam_geometry, linear, areal or multi point
+\tparam Strategies An umbrella distance strategy. The closest points require
+    an umbrella closest points strategy, which is the default for cartesian
+    geometries.
+\note The geometry is referred to by the index, it should not be destroyed
+    or changed before the index.
+*/
+template
+<
+    typename Geometry,
+    typename Strategies = typename detail::distance_index::default_strategies
+        <
+            Geometry
+        >::type
+>
+class distance_index
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (strategies::detail::is_umbrella_strategy<Strategies>::value),
+        "The distance index requires an umbrella strategy.",
+        Strategies);
+
+    typedef detail::distance::iterator_selector<Geometry const> selector_type;
+    typedef typename std::iterator_traits
+        <
+            typename selector_type::iterator_type
+        >::value_type value_type;
+
+    typedef index::parameters
+        <
+            index::rstar<16>, Strategies
+        > parameters_type;
+    typedef index::rtree<value_type, parameters_type> rtree_type;
+
+public:
+    typedef Strategies strategies_type;
+
+    explicit distance_index(Geometry const& geometry,
+                            Strategies const& strategies = Strategies())
+        : m_geometry(geometry)
+        , m_strategies(strategies)
+        // the packing algorithm is used by this constructor
+        , m_rtree(selector_type::begin(geometry), selector_type::end(geometry),
+                  parameters_type(index::rstar<16>(), strategies))
+    {
+        concepts::check<Geometry const>();
+    }
+
+    //! Returns true if the geometry has no points
+    inline bool empty() const
+    {
+        return m_rtree.empty();
+    }
+
+    //! Returns the distance of the point to the geometry
+    template <typename Point>
+    inline auto distance(Point const& point) const
+    {
+        detail::throw_on_empty_input(m_geometry);
+
+        typedef typename distance_result
+            <
+                Point, typename point_type<Geometry>::type, Strategies
+            >::type result_type;
+
+        if (is_inside(point))
+        {
+            return result_type(0);
+        }
+
+        return result_type(dispatch::distance
+            <
+                Point, value_type, Strategies
+            >::apply(point, nearest(point), m_strategies));
+    }
+
+    //! Sets the segment from the point to the closest point of the geometry
+    template <typename Point, typename Segment>
+    inline void closest_points(Point const& point, Segment& shortest_seg) const
+    {
+        detail::throw_on_empty_input(m_geometry);
+
+        if (is_inside(point))
+        {
+            detail::closest_points::set_segment_from_points::apply(point, point,
+                                                                    shortest_seg);
+            return;
+        }
+
+        geometry::closest_points(point, nearest(point), shortest_seg, m_strategies);
+    }
+
+    //! Assigns the distances of all points to the range starting at out
+    template <typename Points, typename RandomAccessIterator>
+    inline void batch_distance(Points const& points,
+                               RandomAccessIterator out) const
+    {
+        batch_distance(parallel_execution(1), points, out);
+    }
+
+    //! Assigns the distances of all points to the range starting at out,
+    //! concurrently
+    template <typename Points, typename RandomAccessIterator>
+    inline void batch_distance(parallel_execution const& policy,
+                               Points const& points,
+                               RandomAccessIterator out) const
+    {
+        detail::throw_on_empty_input(m_geometry);
+
+        auto const first = boost::begin(points);
+        detail::parallel::for_each_index(policy, boost::size(points),
+            [&](std::size_t i, std::size_t)
+            {
+                out[i] = distance(*(first + i));
+            });
+    }
+
+    //! Assigns the shortest segments of all points to the range starting
+    //! at out
+    template <typename Points, typename RandomAccessIterator>
+    inline void batch_closest_points(Points const& points,
+                                     RandomAccessIterator out) const
+    {
+        batch_closest_points(parallel_execution(1), points, out);
+    }
+
+    //! Assigns the shortest segments of all points to the range starting
+    //! at out, concurrently
+    template <typename Points, typename RandomAccessIterator>
+    inline void batch_closest_points(parallel_execution const& policy,
+                                     Points const& points,
+                                     RandomAccessIterator out) const
+    {
+        detail::throw_on_empty_input(m_geometry);
+
+        auto const first = boost::begin(points);
+        detail::parallel::for_each_index(policy, boost::size(points),
+            [&](std::size_t i, std::size_t)
+            {
+                closest_points(*(first + i), out[i]);
+            });
+    }
+
+private:
+    template <typename Point>
+    inline bool is_inside(Point const& point) const
+    {
+        return is_inside(point, detail::distance_index::is_areal<Geometry>());
+    }
+
+    template <typename Point>
+    inline bool is_inside(Point const& point, std::true_type) const
+    {
+        auto const strategy = m_strategies.relate(point, m_geometry);
+        return is_inside(point, strategy,
+                         detail::distance_index::is_cartesian_winding
+                            <
+                                std::remove_const_t<decltype(strategy)>
+                            >());
+    }
+
+    // The segments below the point, along the vertical line through it,
+    // are taken from the rtree and passed to the winding strategy
+    template <typename Point, typename Strategy>
+    inline bool is_inside(Point const& point, Strategy const& strategy,
+                          std::true_type) const
+    {
+        typedef typename point_type<Geometry>::type geometry_point_type;
+
+        typename rtree_type::bounds_type ray = m_rtree.bounds();
+        if (geometry::get<1>(point) < geometry::get<min_corner, 1>(ray))
+        {
+            return false;
+        }
+        geometry::set<min_corner, 0>(ray, geometry::get<0>(point));
+        geometry::set<max_corner, 0>(ray, geometry::get<0>(point));
+        geometry::set<max_corner, 1>(ray, geometry::get<1>(point));
+
+        typename Strategy::state_type state;
+        for (auto it = m_rtree.qbegin(index::intersects(ray));
+             it != m_rtree.qend(); ++it)
+        {
+            geometry_point_type p0, p1;
+            detail::assign_point_from_index<0>(*it, p0);
+            detail::assign_point_from_index<1>(*it, p1);
+            if (! strategy.apply(point, p0, p1, state))
+            {
+                // The point is on the boundary
+                break;
+            }
+        }
+        return strategy.result(state) >= 0;
+    }
+
+    template <typename Point, typename Strategy>
+    inline bool is_inside(Point const& point, Strategy const& ,
+                          std::false_type) const
+    {
+        return detail::within::covered_by_point_geometry(point, m_geometry,
+                                                         m_strategies);
+    }
+
+    template <typename Point>
+    inline bool is_inside(Point const& , std::false_type) const
+    {
+        return false;
+    }
+
+    template <typename Point>
+    inline value_type nearest(Point const& point) const
+    {
+        value_type result;
+        m_rtree.query(index::nearest(point, 1), &result);
+        return result;
+    }
+
+    Geometry const& m_geometry;
+    Strategies m_strategies;
+    rtree_type m_rtree;
+};
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DISTANCE_INDEX_HPP
@@ -318,7 +318,9 @@ struct for_each_polygon
     template <typename Polygon, typename Functor>
     static inline bool apply(Polygon& poly, Functor&& f)
     {
-        if (! RangePolicy::apply(exterior_ring(poly), f))
+        // Rings of views may be returned by value
+        auto&& ext = exterior_ring(poly);
+        if (! RangePolicy::apply(ext, f))
         {
             return false;
         }
@@ -329,8 +331,9 @@ struct for_each_polygon
         auto const end = boost::end(rings);
         for (auto it = boost::begin(rings); it != end; ++it)
         {
-            // NOTE: Currently lvalue iterator required
-            if (! RangePolicy::apply(*it, f))
+            // Rings of views may be returned by value
+            auto&& ring = *it;
+            if (! RangePolicy::apply(ring, f))
             {
                 return false;
             }
@@ -352,8 +355,9 @@ struct for_each_multi
         auto const end = boost::end(multi);
         for (auto it = boost::begin(multi); it != end; ++it)
         {
-            // NOTE: Currently lvalue iterator required
-            if (! SinglePolicy::apply(*it, f))
+            // Geometries of views may be returned by value
+            auto&& single = *it;
+            if (! SinglePolicy::apply(single, f))
             {
                 return false;
             }
@@ -12,5 +12,7 @@
 
 #include <boost/geometry/algorithms/detail/is_valid/interface.hpp>
 #include <boost/geometry/algorithms/detail/is_valid/implementation.hpp>
+#include <boost/geometry/algorithms/detail/is_valid/batch.hpp>
+#include <boost/geometry/algorithms/detail/is_valid/parallel.hpp>
 
 #endif // BOOST_GEOMETRY_ALGORITHMS_IS_VALID_HPP
@@ -21,6 +21,8 @@
 #define BOOST_GEOMETRY_ALGORITHMS_LENGTH_HPP
 
 #include <iterator>
+#include <type_traits>
+#include <vector>
 
 #include <boost/core/ignore_unused.hpp>
 #include <boost/range/begin.hpp>
@@ -32,6 +34,7 @@
 #include <boost/geometry/algorithms/detail/calculate_null.hpp>
 #include <boost/geometry/algorithms/detail/dummy_geometries.hpp>
 #include <boost/geometry/algorithms/detail/multi_sum.hpp>
+#include <boost/geometry/algorithms/detail/parallel_sum.hpp>
 // #include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
 #include <boost/geometry/algorithms/detail/visit.hpp>
 
@@ -51,6 +54,8 @@
 #include <boost/geometry/strategies/length/geographic.hpp>
 #include <boost/geometry/strategies/length/spherical.hpp>
 
+#include <boost/geometry/util/parallel.hpp>
+
 #include <boost/geometry/views/closeable_view.hpp>
 
 namespace boost { namespace geometry
@@ -310,7 +315,11 @@ length(Geometry const& geometry)
 \qbk{[include reference/algorithms/length.qbk]}
 \qbk{[length_with_strategy] [length_with_strategy_output]}
  */
-template<typename Geometry, typename Strategy>
+template
+<
+    typename Geometry, typename Strategy,
+    std::enable_if_t<! detail::parallel::is_execution_policy<Geometry>::value, int> = 0
+>
 inline typename default_length_result<Geometry>::type
 length(Geometry const& geometry, Strategy const& strategy)
 {
@@ -322,6 +331,226 @@ length(Geometry const& geometry, Strategy const& strategy)
 }
 
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace length
+{
+
+// Only linestrings and multilinestrings are calculated in parallel,
+// other geometries are calculated sequentially
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct length_parallel
+{
+    template <typename Strategies>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategies const& strategies,
+          parallel_execution const& )
+    {
+        return dispatch::length<Geometry>::apply(geometry, strategies);
+    }
+};
+
+template <typename Geometry>
+struct length_parallel_ranges
+{
+    typedef typename std::conditional
+        <
+            std::is_same<typename tag<Geometry>::type, linestring_tag>::value,
+            Geometry,
+            typename boost::range_value<Geometry>::type
+        >::type range_type;
+
+    template <typename Strategies>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategies const& strategies,
+          parallel_execution const& policy)
+    {
+        std::vector<range_type const*> ranges;
+        detail::parallel_sum::collect_ranges<Geometry>::apply(geometry, ranges);
+        return detail::parallel_sum::ranges_length
+            <
+                typename default_length_result<Geometry>::type,
+                false
+            >(ranges, strategies, policy);
+    }
+};
+
+template <typename Geometry>
+struct length_parallel<Geometry, linestring_tag>
+    : length_parallel_ranges<Geometry>
+{};
+
+template <typename Geometry>
+struct length_parallel<Geometry, multi_linestring_tag>
+    : length_parallel_ranges<Geometry>
+{};
+
+}} // namespace detail::length
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace resolve_strategy
+{
+
+template
+<
+    typename Strategies,
+    bool IsUmbrella = strategies::detail::is_umbrella_strategy<Strategies>::value
+>
+struct length_parallel
+{
+    template <typename Geometry>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategies const& strategies,
+          parallel_execution const& policy)
+    {
+        return detail::length::length_parallel
+            <
+                Geometry
+            >::apply(geometry, strategies, policy);
+    }
+};
+
+template <typename Strategy>
+struct length_parallel<Strategy, false>
+{
+    template <typename Geometry>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          parallel_execution const& policy)
+    {
+        using strategies::length::services::strategy_converter;
+        return detail::length::length_parallel
+            <
+                Geometry
+            >::apply(geometry, strategy_converter<Strategy>::get(strategy), policy);
+    }
+};
+
+template <>
+struct length_parallel<default_strategy, false>
+{
+    template <typename Geometry>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, default_strategy const&,
+          parallel_execution const& policy)
+    {
+        typedef typename strategies::length::services::default_strategy
+            <
+                Geometry
+            >::type strategies_type;
+
+        return detail::length::length_parallel
+            <
+                Geometry
+            >::apply(geometry, strategies_type(), policy);
+    }
+};
+
+} // namespace resolve_strategy
+
+
+namespace resolve_dynamic
+{
+
+// Dynamic geometries and geometry collections are calculated sequentially
+template <typename Geometry, typename Tag = typename geometry::tag<Geometry>::type>
+struct length_parallel
+{
+    template <typename Strategy>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          parallel_execution const& policy)
+    {
+        return resolve_strategy::length_parallel
+            <
+                Strategy
+            >::apply(geometry, strategy, policy);
+    }
+};
+
+template <typename Geometry>
+struct length_parallel<Geometry, dynamic_geometry_tag>
+{
+    template <typename Strategy>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          parallel_execution const& )
+    {
+        return length<Geometry>::apply(geometry, strategy);
+    }
+};
+
+template <typename Geometry>
+struct length_parallel<Geometry, geometry_collection_tag>
+{
+    template <typename Strategy>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          parallel_execution const& )
+    {
+        return length<Geometry>::apply(geometry, strategy);
+    }
+};
+
+} // namespace resolve_dynamic
+
+
+/*!
+\brief \brief_calc{length}, the work is split among threads
+\ingroup length
+\details The linestrings are calculated concurrently, large ones in blocks
+    of segments. The results are summed with compensation of rounding
+    errors, in an order independent on the number of threads, so the result
+    is the same for any number of threads. It may differ slightly from the
+    result of the sequential algorithm. Other geometries are calculated
+    sequentially.
+\tparam Geometry \tparam_geometry
+\param policy the parallel execution policy
+\param geometry \param_geometry
+\return \return_calc{length}
+
+\qbk{distinguish,parallel}
+ */
+template<typename Geometry>
+inline typename default_length_result<Geometry>::type
+length(parallel_execution const& policy, Geometry const& geometry)
+{
+    concepts::check<Geometry const>();
+
+    return resolve_dynamic::length_parallel
+        <
+            Geometry
+        >::apply(geometry, default_strategy(), policy);
+}
+
+/*!
+\brief \brief_calc{length} \brief_strategy, the work is split among threads
+\ingroup length
+\details The linestrings are calculated concurrently as by length with
+    the parallel execution policy.
+\tparam Geometry \tparam_geometry
+\tparam Strategy \tparam_strategy{distance}
+\param policy the parallel execution policy
+\param geometry \param_geometry
+\param strategy \param_strategy{distance}
+\return \return_calc{length}
+
+\qbk{distinguish,parallel with strategy}
+ */
+template<typename Geometry, typename Strategy>
+inline typename default_length_result<Geometry>::type
+length(parallel_execution const& policy, Geometry const& geometry,
+       Strategy const& strategy)
+{
+    concepts::check<Geometry const>();
+
+    return resolve_dynamic::length_parallel
+        <
+            Geometry
+        >::apply(geometry, strategy, policy);
+}
+
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_ALGORITHMS_LENGTH_HPP
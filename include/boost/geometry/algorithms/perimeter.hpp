@@ -19,17 +19,22 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_PERIMETER_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_PERIMETER_HPP
 
+#include <type_traits>
+#include <vector>
+
 #include <boost/range/value_type.hpp>
 
 #include <boost/geometry/algorithms/length.hpp>
 #include <boost/geometry/algorithms/detail/calculate_null.hpp>
 #include <boost/geometry/algorithms/detail/calculate_sum.hpp>
 #include <boost/geometry/algorithms/detail/multi_sum.hpp>
+#include <boost/geometry/algorithms/detail/parallel_sum.hpp>
 // #include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
 #include <boost/geometry/algorithms/detail/visit.hpp>
 
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/ring_type.hpp>
 #include <boost/geometry/core/tags.hpp>
 #include <boost/geometry/core/visit.hpp>
 
@@ -43,6 +48,8 @@
 #include <boost/geometry/strategies/length/geographic.hpp>
 #include <boost/geometry/strategies/length/spherical.hpp>
 
+#include <boost/geometry/util/parallel.hpp>
+
 namespace boost { namespace geometry
 {
 
@@ -249,7 +256,11 @@ inline typename default_length_result<Geometry>::type perimeter(
 \qbk{distinguish,with strategy}
 \qbk{[include reference/algorithms/perimeter.qbk]}
  */
-template<typename Geometry, typename Strategy>
+template
+<
+    typename Geometry, typename Strategy,
+    std::enable_if_t<! detail::parallel::is_execution_policy<Geometry>::value, int> = 0
+>
 inline typename default_length_result<Geometry>::type perimeter(
         Geometry const& geometry, Strategy const& strategy)
 {
@@ -257,6 +268,227 @@ inline typename default_length_result<Geometry>::type perimeter(
     return resolve_dynamic::perimeter<Geometry>::apply(geometry, strategy);
 }
 
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace perimeter
+{
+
+// Only rings, polygons and multipolygons are calculated in parallel,
+// other geometries are calculated sequentially
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct perimeter_parallel
+{
+    template <typename Strategies>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategies const& strategies,
+          parallel_execution const& )
+    {
+        return dispatch::perimeter<Geometry>::apply(geometry, strategies);
+    }
+};
+
+template <typename Geometry>
+struct perimeter_parallel_ranges
+{
+    typedef typename ring_type<Geometry>::type range_type;
+
+    template <typename Strategies>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategies const& strategies,
+          parallel_execution const& policy)
+    {
+        std::vector<range_type const*> ranges;
+        detail::parallel_sum::collect_ranges<Geometry>::apply(geometry, ranges);
+        return detail::parallel_sum::ranges_length
+            <
+                typename default_length_result<Geometry>::type,
+                geometry::closure<range_type>::value == open
+            >(ranges, strategies, policy);
+    }
+};
+
+template <typename Geometry>
+struct perimeter_parallel<Geometry, ring_tag>
+    : perimeter_parallel_ranges<Geometry>
+{};
+
+template <typename Geometry>
+struct perimeter_parallel<Geometry, polygon_tag>
+    : perimeter_parallel_ranges<Geometry>
+{};
+
+template <typename Geometry>
+struct perimeter_parallel<Geometry, multi_polygon_tag>
+    : perimeter_parallel_ranges<Geometry>
+{};
+
+}} // namespace detail::perimeter
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace resolve_strategy
+{
+
+template
+<
+    typename Strategies,
+    bool IsUmbrella = strategies::detail::is_umbrella_strategy<Strategies>::value
+>
+struct perimeter_parallel
+{
+    template <typename Geometry>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategies const& strategies,
+          parallel_execution const& policy)
+    {
+        return detail::perimeter::perimeter_parallel
+            <
+                Geometry
+            >::apply(geometry, strategies, policy);
+    }
+};
+
+template <typename Strategy>
+struct perimeter_parallel<Strategy, false>
+{
+    template <typename Geometry>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          parallel_execution const& policy)
+    {
+        using strategies::length::services::strategy_converter;
+        return detail::perimeter::perimeter_parallel
+            <
+                Geometry
+            >::apply(geometry, strategy_converter<Strategy>::get(strategy), policy);
+    }
+};
+
+template <>
+struct perimeter_parallel<default_strategy, false>
+{
+    template <typename Geometry>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, default_strategy const&,
+          parallel_execution const& policy)
+    {
+        typedef typename strategies::length::services::default_strategy
+            <
+                Geometry
+            >::type strategies_type;
+
+        return detail::perimeter::perimeter_parallel
+            <
+                Geometry
+            >::apply(geometry, strategies_type(), policy);
+    }
+};
+
+} // namespace resolve_strategy
+
+
+namespace resolve_dynamic
+{
+
+// Dynamic geometries and geometry collections are calculated sequentially
+template <typename Geometry, typename Tag = typename geometry::tag<Geometry>::type>
+struct perimeter_parallel
+{
+    template <typename Strategy>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          parallel_execution const& policy)
+    {
+        return resolve_strategy::perimeter_parallel
+            <
+                Strategy
+            >::apply(geometry, strategy, policy);
+    }
+};
+
+template <typename Geometry>
+struct perimeter_parallel<Geometry, dynamic_geometry_tag>
+{
+    template <typename Strategy>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          parallel_execution const& )
+    {
+        return perimeter<Geometry>::apply(geometry, strategy);
+    }
+};
+
+template <typename Geometry>
+struct perimeter_parallel<Geometry, geometry_collection_tag>
+{
+    template <typename Strategy>
+    static inline typename default_length_result<Geometry>::type
+    apply(Geometry const& geometry, Strategy const& strategy,
+          parallel_execution const& )
+    {
+        return perimeter<Geometry>::apply(geometry, strategy);
+    }
+};
+
+} // namespace resolve_dynamic
+
+
+/*!
+\brief \brief_calc{perimeter}, the work is split among threads
+\ingroup perimeter
+\details The rings are calculated concurrently, large ones in blocks
+    of segments. The results are summed with compensation of rounding
+    errors, in an order independent on the number of threads, so the result
+    is the same for any number of threads. It may differ slightly from the
+    result of the sequential algorithm. Other geometries are calculated
+    sequentially.
+\tparam Geometry \tparam_geometry
+\param policy the parallel execution policy
+\param geometry \param_geometry
+\return \return_calc{perimeter}
+
+\qbk{distinguish,parallel}
+ */
+template<typename Geometry>
+inline typename default_length_result<Geometry>::type perimeter(
+        parallel_execution const& policy, Geometry const& geometry)
+{
+    concepts::check<Geometry const>();
+
+    return resolve_dynamic::perimeter_parallel
+        <
+            Geometry
+        >::apply(geometry, default_strategy(), policy);
+}
+
+/*!
+\brief \brief_calc{perimeter} \brief_strategy, the work is split among threads
+\ingroup perimeter
+\details The rings are calculated concurrently as by perimeter with
+    the parallel execution policy.
+\tparam Geometry \tparam_geometry
+\tparam Strategy \tparam_strategy{distance}
+\param policy the parallel execution policy
+\param geometry \param_geometry
+\param strategy \param_strategy{distance}
+\return \return_calc{perimeter}
+
+\qbk{distinguish,parallel with strategy}
+ */
+template<typename Geometry, typename Strategy>
+inline typename default_length_result<Geometry>::type perimeter(
+        parallel_execution const& policy, Geometry const& geometry,
+        Strategy const& strategy)
+{
+    concepts::check<Geometry const>();
+
+    return resolve_dynamic::perimeter_parallel
+        <
+            Geometry
+        >::apply(geometry, strategy, policy);
+}
+
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_ALGORITHMS_PERIMETER_HPP
@@ -18,14 +18,16 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_HPP
 
+#include <algorithm>
 #include <cstddef>
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
 #include <iostream>
 #endif
+#include <queue>
 #include <set>
+#include <type_traits>
 #include <vector>
 
-#include <boost/core/addressof.hpp>
 #include <boost/core/ignore_unused.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
@@ -35,8 +37,10 @@
 #include <boost/geometry/algorithms/area.hpp>
 #include <boost/geometry/algorithms/clear.hpp>
 #include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/distance/projected_point_block.hpp>
 #include <boost/geometry/algorithms/detail/dummy_geometries.hpp>
 #include <boost/geometry/algorithms/detail/equals/point_point.hpp>
+#include <boost/geometry/algorithms/detail/simplify/visvalingam_whyatt.hpp>
 #include <boost/geometry/algorithms/detail/visit.hpp>
 #include <boost/geometry/algorithms/not_implemented.hpp>
 #include <boost/geometry/algorithms/is_empty.hpp>
@@ -60,6 +64,7 @@
 #include <boost/geometry/strategies/simplify/geographic.hpp>
 #include <boost/geometry/strategies/simplify/spherical.hpp>
 
+#include <boost/geometry/util/range.hpp>
 #include <boost/geometry/util/type_traits_std.hpp>
 
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
@@ -74,29 +79,43 @@ namespace detail { namespace simplify
 {
 
 /*!
-\brief Small wrapper around a point, with an extra member "included"
-\details
-    It has a const-reference to the original point (so no copy here)
-\tparam the enclosed point type
+\brief Part of a range between two included points, with the point
+    furthest from the segment between them
 */
-template <typename Point>
-struct douglas_peucker_point
+template <typename Distance>
+struct douglas_peucker_span
 {
-    typedef Point point_type;
-
-    Point const* p;
-    bool included;
+    std::size_t first;
+    std::size_t last;
+    std::size_t candidate;
+    Distance distance;
+};
 
-    inline douglas_peucker_point(Point const& ap)
-        : p(boost::addressof(ap))
-        , included(false)
-    {}
+// Orders the spans in the priority queue, the furthest candidate first,
+// the first span if distances are the same
+struct douglas_peucker_span_less
+{
+    template <typename Span>
+    inline bool operator()(Span const& left, Span const& right) const
+    {
+        if (left.distance < right.distance || right.distance < left.distance)
+        {
+            return left.distance < right.distance;
+        }
+        return right.first < left.first;
+    }
 };
 
 /*!
 \brief Implements the simplify algorithm.
 \details The douglas_peucker policy simplifies a linestring, ring or
     vector of points using the well-known Douglas-Peucker algorithm.
+    The spans between the included points are processed iteratively,
+    the span with the furthest point first, so the simplification can
+    also be stopped when the requested number of points is reached.
+    Each span is scanned linearly, so the running time is O(n log n) if the
+    furthest points split the spans evenly, but remains quadratic in the
+    worst case, if they are each next to an end of their span.
 \tparam Point the point type
 \tparam PointDistanceStrategy point-segment distance strategy to be used
 \note This strategy uses itself a point-segment-distance strategy which
@@ -112,80 +131,72 @@ For the algorithm, see for example:
 */
 class douglas_peucker
 {
-    template <typename Iterator, typename Distance, typename PSDistanceStrategy>
-    static inline void consider(Iterator begin,
-                                Iterator end,
-                                Distance const& max_dist,
-                                int& n,
+    // Finds the point of the span furthest from the segment between
+    // its first and last point
+    template <typename Range, typename Distance, typename PSDistanceStrategy>
+    static inline void consider(Range const& range,
+                                douglas_peucker_span<Distance>& span,
                                 PSDistanceStrategy const& ps_distance_strategy)
     {
-        typedef typename std::iterator_traits<Iterator>::value_type::point_type point_type;
-        typedef decltype(ps_distance_strategy.apply(std::declval<point_type>(),
-                            std::declval<point_type>(), std::declval<point_type>())) distance_type;
-
-        std::size_t size = end - begin;
-
-        // size must be at least 3
-        // because we want to consider a candidate point in between
-        if (size <= 2)
-        {
-#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-            if (begin != end)
-            {
-                std::cout << "ignore between " << dsv(*(begin->p))
-                    << " and " << dsv(*((end - 1)->p))
-                    << " size=" << size << std::endl;
-            }
-            std::cout << "return because size=" << size << std::endl;
-#endif
-            return;
-        }
+        typedef detail::distance::use_projected_point_block
+            <
+                typename boost::range_iterator<Range const>::type,
+                PSDistanceStrategy
+            > use_block;
 
-        Iterator last = end - 1;
+        consider(range, span, ps_distance_strategy,
+                 std::integral_constant<bool, use_block::value>());
+    }
 
-#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-        std::cout << "find between " << dsv(*(begin->p))
-            << " and " << dsv(*(last->p))
-            << " size=" << size << std::endl;
-#endif
+    // Contiguous double or float coordinates with the cartesian comparable
+    // strategy are processed by the (vectorized) block kernel
+    template <typename Range, typename Distance, typename PSDistanceStrategy>
+    static inline void consider(Range const& range,
+                                douglas_peucker_span<Distance>& span,
+                                PSDistanceStrategy const& ,
+                                std::true_type /*use_block*/)
+    {
+        auto const& first = range::at(range, span.first);
+        auto const& last = range::at(range, span.last);
+
+        double distance = -1.0;
+        std::size_t const index = detail::distance::farthest_point(
+            double(geometry::get<0>(first)), double(geometry::get<1>(first)),
+            double(geometry::get<0>(last)), double(geometry::get<1>(last)),
+            detail::distance::block_coordinates(boost::begin(range) + span.first + 1),
+            span.last - span.first - 1, distance);
+
+        span.candidate = span.first + 1 + index;
+        span.distance = Distance(distance);
+    }
 
+    template <typename Range, typename Distance, typename PSDistanceStrategy>
+    static inline void consider(Range const& range,
+                                douglas_peucker_span<Distance>& span,
+                                PSDistanceStrategy const& ps_distance_strategy,
+                                std::false_type /*use_block*/)
+    {
+        auto const& first = range::at(range, span.first);
+        auto const& last = range::at(range, span.last);
 
-        // Find most far point, compare to the current segment
-        //geometry::segment<Point const> s(begin->p, last->p);
-        distance_type md(-1.0); // any value < 0
-        Iterator candidate = end;
-        for (Iterator it = begin + 1; it != last; ++it)
+        span.candidate = span.last;
+        span.distance = Distance(-1.0); // any value < 0
+        for (std::size_t i = span.first + 1; i < span.last; ++i)
         {
-            distance_type dist = ps_distance_strategy.apply(*(it->p), *(begin->p), *(last->p));
+            auto const dist = ps_distance_strategy.apply(range::at(range, i),
+                                                         first, last);
 
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-            std::cout << "consider " << dsv(*(it->p))
-                << " at " << double(dist)
-                << ((dist > max_dist) ? " maybe" : " no")
-                << std::endl;
-
+            std::cout << "consider " << dsv(range::at(range, i))
+                << " at " << double(dist) << std::endl;
 #endif
-            if (md < dist)
+
+            if (span.distance < dist)
             {
-                md = dist;
-                candidate = it;
+                span.distance = dist;
+                span.candidate = i;
             }
         }
-
-        // If a point is found, set the include flag
-        // and handle segments in between recursively
-        if (max_dist < md && candidate != end)
-        {
-#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-            std::cout << "use " << dsv(candidate->p) << std::endl;
-#endif
-
-            candidate->included = true;
-            n++;
-
-            consider(begin, candidate + 1, max_dist, n, ps_distance_strategy);
-            consider(candidate, end, max_dist, n, ps_distance_strategy);
-        }
     }
 
     template
@@ -196,6 +207,7 @@ class douglas_peucker
     static inline OutputIterator apply_(Range const& range,
                                         OutputIterator out,
                                         Distance const& max_distance,
+                                        std::size_t max_points,
                                         PSDistanceStrategy const& ps_distance_strategy)
     {
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
@@ -204,32 +216,84 @@ class douglas_peucker
 #endif
 
         typedef typename boost::range_value<Range>::type point_type;
-        typedef douglas_peucker_point<point_type> dp_point_type;
+        typedef decltype(ps_distance_strategy.apply(std::declval<point_type>(),
+                            std::declval<point_type>(), std::declval<point_type>())) distance_type;
+        typedef douglas_peucker_span<distance_type> span_type;
 
-        // Copy coordinates, a vector of references to all points
-        std::vector<dp_point_type> ref_candidates(boost::begin(range),
-                                                  boost::end(range));
+        std::size_t const size = boost::size(range);
+        if (max_points == 0)
+        {
+            max_points = size;
+        }
 
         // Include first and last point of line,
         // they are always part of the line
-        int n = 2;
-        ref_candidates.front().included = true;
-        ref_candidates.back().included = true;
+        std::vector<bool> included(size, false);
+        included.front() = true;
+        included.back() = true;
+        std::size_t n = 2;
+
+        // Include the furthest point of the span with the furthest point,
+        // if it is further away than the specified distance, and consider
+        // the spans on both sides of it, until the number of points is reached
+        std::priority_queue
+            <
+                span_type, std::vector<span_type>, douglas_peucker_span_less
+            > spans;
+
+        span_type span;
+        span.first = 0;
+        span.last = size - 1;
+        consider(range, span, ps_distance_strategy);
+        spans.push(span);
+
+        while (! spans.empty() && n < max_points)
+        {
+            span = spans.top();
+            spans.pop();
 
-        // Get points, recursively, including them if they are further away
-        // than the specified distance
-        consider(boost::begin(ref_candidates), boost::end(ref_candidates), max_distance, n,
-                 ps_distance_strategy);
+            if (! (max_distance < span.distance) || span.candidate == span.last)
+            {
+                // The spans are ordered, the other ones are not further away
+                break;
+            }
+
+#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
+            std::cout << "use " << dsv(range::at(range, span.candidate)) << std::endl;
+#endif
+
+            included[span.candidate] = true;
+            n++;
+
+            span_type left, right;
+            left.first = span.first;
+            left.last = span.candidate;
+            right.first = span.candidate;
+            right.last = span.last;
+
+            // size must be at least 3
+            // because we want to consider a candidate point in between
+            if (left.last - left.first >= 2)
+            {
+                consider(range, left, ps_distance_strategy);
+                spans.push(left);
+            }
+            if (right.last - right.first >= 2)
+            {
+                consider(range, right, ps_distance_strategy);
+                spans.push(right);
+            }
+        }
 
         // Copy included elements to the output
-        for (auto it = boost::begin(ref_candidates); it != boost::end(ref_candidates); ++it)
+        for (std::size_t i = 0; i < size; ++i)
         {
-            if (it->included)
+            if (included[i])
             {
                 // copy-coordinates does not work because OutputIterator
                 // does not model Point (??)
                 //geometry::convert(*(it->p), *out);
-                *out = *(it->p);
+                *out = range::at(range, i);
                 ++out;
             }
         }
@@ -242,6 +306,18 @@ public:
                                        OutputIterator out,
                                        Distance const& max_distance,
                                        Strategies const& strategies)
+    {
+        return apply(range, out, max_distance, 0, strategies);
+    }
+
+    // max_points: the maximum number of points of the simplified range,
+    // 0 if not limited
+    template <typename Range, typename OutputIterator, typename Distance, typename Strategies>
+    static inline OutputIterator apply(Range const& range,
+                                       OutputIterator out,
+                                       Distance const& max_distance,
+                                       std::size_t max_points,
+                                       Strategies const& strategies)
     {
         typedef typename boost::range_value<Range>::type point_type;
         typedef decltype(strategies.distance(detail::dummy_point(), detail::dummy_segment())) distance_strategy_type;
@@ -261,11 +337,43 @@ public:
                           <
                               comparable_distance_strategy_type, point_type, point_type
                           >::apply(cstrategy, max_distance),
+                      max_points,
                       cstrategy);
     }
 };
 
 
+// Douglas-Peucker stopped when the number of points is reached
+class douglas_peucker_to_count
+{
+public:
+    explicit douglas_peucker_to_count(std::size_t max_points)
+        : m_max_points(max_points)
+    {}
+
+    template <typename Range, typename OutputIterator, typename Distance, typename Strategies>
+    inline OutputIterator apply(Range const& range,
+                                OutputIterator out,
+                                Distance const& max_distance,
+                                Strategies const& strategies) const
+    {
+        return douglas_peucker::apply(range, out, max_distance, m_max_points,
+                                      strategies);
+    }
+
+    // Returns the policy keeping at least the specified number of points
+    inline douglas_peucker_to_count at_least(std::size_t min_points) const
+    {
+        return douglas_peucker_to_count(m_max_points == 0
+                                        ? 0
+                                        : (std::max)(m_max_points, min_points));
+    }
+
+private:
+    std::size_t m_max_points;
+};
+
+
 template <typename Range, typename Strategies>
 inline bool is_degenerate(Range const& range, Strategies const& strategies)
 {
@@ -417,6 +525,36 @@ private :
         return index;
     }
 
+    // A minimal triangle has a perimeter of a bit more than 3 times the
+    // simplify distance
+    template <typename Ring, typename Distance, typename Impl, typename Strategies>
+    static inline bool is_too_small(Ring const& ring, Distance const& max_distance,
+                                    Impl const&, Strategies const& strategies)
+    {
+        return geometry::perimeter(ring, strategies) < 3 * max_distance;
+    }
+
+    // The minimal area of Visvalingam-Whyatt is not related to the perimeter,
+    // all starting points are tried
+    template <typename Ring, typename Area, typename Strategies>
+    static inline bool is_too_small(Ring const&, Area const&,
+                                    visvalingam_whyatt const&, Strategies const&)
+    {
+        return false;
+    }
+
+    template <typename Impl>
+    static inline Impl const& ring_impl(Impl const& impl)
+    {
+        return impl;
+    }
+
+    // The rotated ring is closed, a triangle consists of four points
+    static inline douglas_peucker_to_count ring_impl(douglas_peucker_to_count const& impl)
+    {
+        return impl.at_least(4);
+    }
+
 public :
     template <typename Ring, typename Distance, typename Impl, typename Strategies>
     static inline void apply(Ring const& ring, Ring& out, Distance const& max_distance,
@@ -478,7 +616,8 @@ public :
             // Close the rotated copy
             rotated.push_back(range::at(ring, index));
 
-            simplify_range<0>::apply(rotated, out, max_distance, impl, strategies);
+            simplify_range<0>::apply(rotated, out, max_distance, ring_impl(impl),
+                                     strategies);
 
             // TODO: instead of area() use calculate_point_order() ?
 
@@ -498,10 +637,9 @@ public :
             geometry::clear(out);
 
             if (iteration == 0
-                && geometry::perimeter(ring, strategies) < 3 * max_distance)
+                && is_too_small(ring, max_distance, impl, strategies))
             {
-                // Check if it is useful to iterate. A minimal triangle has a
-                // perimeter of a bit more than 3 times the simplify distance
+                // Check if it is useful to iterate
                 return;
             }
 
@@ -713,28 +851,28 @@ template
 >
 struct simplify
 {
-    template <typename Geometry, typename Distance>
+    template <typename Geometry, typename Distance, typename Impl>
     static inline void apply(Geometry const& geometry,
                              Geometry& out,
                              Distance const& max_distance,
+                             Impl const& impl,
                              Strategies const& strategies)
     {
         dispatch::simplify
             <
                 Geometry
-            >::apply(geometry, out, max_distance,
-                     detail::simplify::douglas_peucker(),
-                     strategies);
+            >::apply(geometry, out, max_distance, impl, strategies);
     }
 };
 
 template <typename Strategy>
 struct simplify<Strategy, false>
 {
-    template <typename Geometry, typename Distance>
+    template <typename Geometry, typename Distance, typename Impl>
     static inline void apply(Geometry const& geometry,
                              Geometry& out,
                              Distance const& max_distance,
+                             Impl const& impl,
                              Strategy const& strategy)
     {
         using strategies::simplify::services::strategy_converter;
@@ -742,7 +880,7 @@ struct simplify<Strategy, false>
         simplify
             <
                 decltype(strategy_converter<Strategy>::get(strategy))
-            >::apply(geometry, out, max_distance,
+            >::apply(geometry, out, max_distance, impl,
                      strategy_converter<Strategy>::get(strategy));
     }
 };
@@ -750,10 +888,11 @@ struct simplify<Strategy, false>
 template <>
 struct simplify<default_strategy, false>
 {
-    template <typename Geometry, typename Distance>
+    template <typename Geometry, typename Distance, typename Impl>
     static inline void apply(Geometry const& geometry,
                              Geometry& out,
                              Distance const& max_distance,
+                             Impl const& impl,
                              default_strategy)
     {
         typedef typename strategies::simplify::services::default_strategy
@@ -764,7 +903,7 @@ struct simplify<default_strategy, false>
         simplify
             <
                 strategy_type
-            >::apply(geometry, out, max_distance, strategy_type());
+            >::apply(geometry, out, max_distance, impl, strategy_type());
     }
 };
 
@@ -830,6 +969,57 @@ struct simplify_insert<default_strategy, false>
     }
 };
 
+template
+<
+    typename Strategies,
+    bool IsUmbrella = strategies::detail::is_umbrella_strategy<Strategies>::value
+>
+struct effective_areas
+{
+    template <typename Range, typename Areas>
+    static inline void apply(Range const& range, Areas& areas,
+                             Strategies const& strategies)
+    {
+        detail::simplify::effective_areas(range, areas, strategies.area(range));
+    }
+};
+
+template <typename Strategy>
+struct effective_areas<Strategy, false>
+{
+    template <typename Range, typename Areas>
+    static inline void apply(Range const& range, Areas& areas,
+                             Strategy const& strategy)
+    {
+        using strategies::simplify::services::strategy_converter;
+
+        effective_areas
+            <
+                decltype(strategy_converter<Strategy>::get(strategy))
+            >::apply(range, areas,
+                     strategy_converter<Strategy>::get(strategy));
+    }
+};
+
+template <>
+struct effective_areas<default_strategy, false>
+{
+    template <typename Range, typename Areas>
+    static inline void apply(Range const& range, Areas& areas,
+                             default_strategy)
+    {
+        typedef typename strategies::simplify::services::default_strategy
+            <
+                Range
+            >::type strategy_type;
+
+        effective_areas
+            <
+                strategy_type
+            >::apply(range, areas, strategy_type());
+    }
+};
+
 } // namespace resolve_strategy
 
 
@@ -838,30 +1028,32 @@ namespace resolve_dynamic {
 template <typename Geometry, typename Tag = typename tag<Geometry>::type>
 struct simplify
 {
-    template <typename Distance, typename Strategy>
+    template <typename Distance, typename Impl, typename Strategy>
     static inline void apply(Geometry const& geometry,
                              Geometry& out,
                              Distance const& max_distance,
+                             Impl const& impl,
                              Strategy const& strategy)
     {
-        resolve_strategy::simplify<Strategy>::apply(geometry, out, max_distance, strategy);
+        resolve_strategy::simplify<Strategy>::apply(geometry, out, max_distance, impl, strategy);
     }
 };
 
 template <typename Geometry>
 struct simplify<Geometry, dynamic_geometry_tag>
 {
-    template <typename Distance, typename Strategy>
+    template <typename Distance, typename Impl, typename Strategy>
     static inline void apply(Geometry const& geometry,
                              Geometry& out,
                              Distance const& max_distance,
+                             Impl const& impl,
                              Strategy const& strategy)
     {
         traits::visit<Geometry>::apply([&](auto const& g)
         {
             using geom_t = util::remove_cref_t<decltype(g)>;
             geom_t o;
-            simplify<geom_t>::apply(g, o, max_distance, strategy);
+            simplify<geom_t>::apply(g, o, max_distance, impl, strategy);
             out = std::move(o);
         }, geometry);
     }
@@ -870,17 +1062,18 @@ struct simplify<Geometry, dynamic_geometry_tag>
 template <typename Geometry>
 struct simplify<Geometry, geometry_collection_tag>
 {
-    template <typename Distance, typename Strategy>
+    template <typename Distance, typename Impl, typename Strategy>
     static inline void apply(Geometry const& geometry,
                              Geometry& out,
                              Distance const& max_distance,
+                             Impl const& impl,
                              Strategy const& strategy)
     {
         detail::visit_breadth_first([&](auto const& g)
         {
             using geom_t = util::remove_cref_t<decltype(g)>;
             geom_t o;
-            simplify<geom_t>::apply(g, o, max_distance, strategy);
+            simplify<geom_t>::apply(g, o, max_distance, impl, strategy);
             traits::emplace_back<Geometry>::apply(out, std::move(o));
             return true;
         }, geometry);
@@ -915,7 +1108,9 @@ inline void simplify(Geometry const& geometry, Geometry& out,
 
     geometry::clear(out);
 
-    resolve_dynamic::simplify<Geometry>::apply(geometry, out, max_distance, strategy);
+    resolve_dynamic::simplify<Geometry>::apply(geometry, out, max_distance,
+                                               detail::simplify::douglas_peucker(),
+                                               strategy);
 }
 
 
@@ -945,6 +1140,193 @@ inline void simplify(Geometry const& geometry, Geometry& out,
 }
 
 
+/*!
+\brief Simplify a geometry to at most the specified number of points
+    of each linestring or ring, using a specified strategy
+\ingroup simplify
+\details The points furthest from the simplified geometry are included
+    first, until the number of points is reached or the remaining points
+    are not further away than max_distance. Rings keep at least the points
+    of a triangle.
+\note Like simplify with Douglas-Peucker, the worst case running time
+    is quadratic in the number of points.
+\tparam Geometry \tparam_geometry
+\tparam Distance A numerical distance measure
+\tparam Strategy A type fulfilling a SimplifyStrategy concept
+\param geometry input geometry, to be simplified
+\param out output geometry, simplified version of the input geometry
+\param max_points maximum number of points of each linestring or ring,
+    including the closing point of a ring, but at least the first and last
+    point of a linestring and the four points of a closed triangle
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+\param strategy simplify strategy to be used for simplification, might
+    include point-distance strategy
+
+\qbk{distinguish,with strategy}
+*/
+template<typename Geometry, typename Distance, typename Strategy>
+inline void simplify_to_count(Geometry const& geometry, Geometry& out,
+                              std::size_t max_points,
+                              Distance const& max_distance,
+                              Strategy const& strategy)
+{
+    concepts::check<Geometry>();
+
+    geometry::clear(out);
+
+    resolve_dynamic::simplify<Geometry>::apply(geometry, out, max_distance,
+                                               detail::simplify::douglas_peucker_to_count(max_points),
+                                               strategy);
+}
+
+/*!
+\brief Simplify a geometry to at most the specified number of points
+    of each linestring or ring
+\ingroup simplify
+\tparam Geometry \tparam_geometry
+\tparam Distance \tparam_numeric
+\param geometry input geometry, to be simplified
+\param out output geometry, simplified version of the input geometry
+\param max_points maximum number of points of each linestring or ring,
+    including the closing point of a ring, but at least the first and last
+    point of a linestring and the four points of a closed triangle
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+*/
+template<typename Geometry, typename Distance>
+inline void simplify_to_count(Geometry const& geometry, Geometry& out,
+                              std::size_t max_points,
+                              Distance const& max_distance)
+{
+    concepts::check<Geometry>();
+
+    geometry::simplify_to_count(geometry, out, max_points, max_distance,
+                                default_strategy());
+}
+
+/*!
+\brief Simplify a geometry to at most the specified number of points
+    of each linestring or ring
+\ingroup simplify
+\details The collinear points are removed if the number of points
+    is not reached.
+\tparam Geometry \tparam_geometry
+\param geometry input geometry, to be simplified
+\param out output geometry, simplified version of the input geometry
+\param max_points maximum number of points of each linestring or ring,
+    including the closing point of a ring, but at least the first and last
+    point of a linestring and the four points of a closed triangle
+*/
+template<typename Geometry>
+inline void simplify_to_count(Geometry const& geometry, Geometry& out,
+                              std::size_t max_points)
+{
+    concepts::check<Geometry>();
+
+    geometry::simplify_to_count(geometry, out, max_points, 0.0,
+                                default_strategy());
+}
+
+
+/*!
+\brief Simplify a geometry with the Visvalingam-Whyatt algorithm,
+    using a specified strategy
+\ingroup simplify
+\details The points forming the triangles with the smallest area with
+    their neighbours are removed, one by one, until all triangles are
+    larger than min_area.
+\tparam Geometry \tparam_geometry
+\tparam Area \tparam_numeric
+\tparam Strategy A type fulfilling a SimplifyStrategy concept
+\param geometry input geometry, to be simplified
+\param out output geometry, simplified version of the input geometry
+\param min_area area of the triangles of the vertices to be removed
+\param strategy simplify strategy to be used for simplification, its
+    area strategy is used to calculate the triangle areas
+
+\qbk{distinguish,with strategy}
+*/
+template<typename Geometry, typename Area, typename Strategy>
+inline void simplify_visvalingam_whyatt(Geometry const& geometry, Geometry& out,
+                                        Area const& min_area,
+                                        Strategy const& strategy)
+{
+    concepts::check<Geometry>();
+
+    geometry::clear(out);
+
+    resolve_dynamic::simplify<Geometry>::apply(geometry, out, min_area,
+                                               detail::simplify::visvalingam_whyatt(),
+                                               strategy);
+}
+
+/*!
+\brief Simplify a geometry with the Visvalingam-Whyatt algorithm
+\ingroup simplify
+\tparam Geometry \tparam_geometry
+\tparam Area \tparam_numeric
+\param geometry input geometry, to be simplified
+\param out output geometry, simplified version of the input geometry
+\param min_area area of the triangles of the vertices to be removed
+*/
+template<typename Geometry, typename Area>
+inline void simplify_visvalingam_whyatt(Geometry const& geometry, Geometry& out,
+                                        Area const& min_area)
+{
+    concepts::check<Geometry>();
+
+    geometry::simplify_visvalingam_whyatt(geometry, out, min_area,
+                                          default_strategy());
+}
+
+
+/*!
+\brief Calculates the effective areas of the points of a linestring or
+    a ring, using a specified strategy
+\ingroup simplify
+\details The effective area of a point is the area of the triangle it
+    forms with its neighbours when it is removed by the Visvalingam-Whyatt
+    algorithm. The points with an effective area larger than min_area
+    are the points kept by simplify_visvalingam_whyatt for a linestring,
+    so the areas can be calculated once and thresholded for each level of
+    detail. The first and the last point get the highest area.
+\tparam Range \tparam_geometry
+\tparam Areas A std::vector-like container of areas
+\tparam Strategy A type fulfilling a SimplifyStrategy concept
+\param range input linestring or ring
+\param areas output areas, one for each point of the range
+\param strategy simplify strategy, its area strategy is used to
+    calculate the triangle areas
+
+\qbk{distinguish,with strategy}
+*/
+template<typename Range, typename Areas, typename Strategy>
+inline void effective_areas(Range const& range, Areas& areas,
+                            Strategy const& strategy)
+{
+    concepts::check<Range const>();
+
+    resolve_strategy::effective_areas<Strategy>::apply(range, areas, strategy);
+}
+
+/*!
+\brief Calculates the effective areas of the points of a linestring or
+    a ring
+\ingroup simplify
+\tparam Range \tparam_geometry
+\tparam Areas A std::vector-like container of areas
+\param range input linestring or ring
+\param areas output areas, one for each point of the range
+*/
+template<typename Range, typename Areas>
+inline void effective_areas(Range const& range, Areas& areas)
+{
+    geometry::effective_areas(range, areas, default_strategy());
+}
+
+
+
 #ifndef DOXYGEN_NO_DETAIL
 namespace detail { namespace simplify
 {
@@ -0,0 +1,985 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_COVERAGE_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_COVERAGE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/simplify.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/ring.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/geometry/policies/compare.hpp>
+
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/detail.hpp>
+#include <boost/geometry/strategies/relate/cartesian.hpp>
+#include <boost/geometry/strategies/relate/geographic.hpp>
+#include <boost/geometry/strategies/relate/spherical.hpp>
+#include <boost/geometry/strategies/simplify/cartesian.hpp>
+#include <boost/geometry/strategies/simplify/geographic.hpp>
+#include <boost/geometry/strategies/simplify/services.hpp>
+#include <boost/geometry/strategies/simplify/spherical.hpp>
+
+#include <boost/geometry/util/parallel.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace simplify_coverage
+{
+
+
+// Part of the boundary between two junctions, or a whole ring,
+// shared by one or more rings of the coverage
+template <typename Point>
+struct coverage_arc
+{
+    // The number of times the distance is halved for an arc crossing
+    // another one, before the original arc is used
+    static std::size_t const max_level = 4;
+
+    std::vector<Point> points;
+    std::vector<Point> simplified;
+    std::size_t level;
+};
+
+// Arc used by a ring, in the direction of the ring or reversed
+struct coverage_arc_use
+{
+    std::size_t arc;
+    bool reversed;
+};
+
+// Orders the arcs lexicographically, to find the shared ones
+template <typename Point>
+class coverage_arc_less
+{
+public:
+    explicit coverage_arc_less(std::vector<coverage_arc<Point> > const& arcs)
+        : m_arcs(&arcs)
+    {}
+
+    inline bool operator()(std::size_t left, std::size_t right) const
+    {
+        std::vector<Point> const& l = (*m_arcs)[left].points;
+        std::vector<Point> const& r = (*m_arcs)[right].points;
+        return std::lexicographical_compare(l.begin(), l.end(),
+                                            r.begin(), r.end(),
+                                            geometry::less<Point>());
+    }
+
+private:
+    std::vector<coverage_arc<Point> > const* m_arcs;
+};
+
+
+/*!
+\brief Splits the rings of a coverage into arcs, shared by adjacent rings
+\details The vertices where the neighbours of a point differ between
+    the rings containing it are junctions. The rings are split at the
+    junctions and the arcs which are equal, in either direction, are
+    stored once. A ring without junctions is an arc, starting at its
+    smallest point.
+*/
+template <typename Point>
+class coverage
+{
+    typedef geometry::less<Point> less_type;
+
+    struct vertex
+    {
+        std::size_t ring;
+        std::size_t index;
+    };
+
+public:
+    typedef coverage_arc<Point> arc_type;
+
+    // Adds a ring, returns its index
+    template <typename Ring>
+    inline std::size_t add_ring(Ring const& ring)
+    {
+        m_rings.push_back(std::vector<Point>(boost::begin(ring), boost::end(ring)));
+        std::vector<Point>& points = m_rings.back();
+        if (geometry::closure<Ring>::value == geometry::closed && ! points.empty())
+        {
+            points.pop_back();
+        }
+        return m_rings.size() - 1;
+    }
+
+    inline void build()
+    {
+        std::vector<bool> const junctions = find_junctions();
+
+        coverage_arc_less<Point> arc_less(m_arcs);
+        std::set<std::size_t, coverage_arc_less<Point> > unique_arcs(arc_less);
+
+        m_ring_arcs.resize(m_rings.size());
+        std::size_t offset = 0;
+        for (std::size_t r = 0; r < m_rings.size(); r++)
+        {
+            std::vector<Point> const& ring = m_rings[r];
+            std::size_t const count = ring.size();
+            if (count == 0)
+            {
+                continue;
+            }
+
+            std::size_t first = count;
+            for (std::size_t i = 0; i < count && first == count; i++)
+            {
+                if (junctions[offset + i])
+                {
+                    first = i;
+                }
+            }
+
+            if (first == count)
+            {
+                add_closed_arc(ring, r, unique_arcs);
+            }
+            else
+            {
+                // Arcs from junction to junction, the last one ends
+                // at the first junction
+                std::size_t begin = first;
+                for (std::size_t i = 1; i <= count; i++)
+                {
+                    std::size_t const index = (first + i) % count;
+                    if (junctions[offset + index])
+                    {
+                        std::vector<Point> points;
+                        for (std::size_t j = begin; ; j = (j + 1) % count)
+                        {
+                            points.push_back(ring[j]);
+                            if (points.size() > 1 && j == index)
+                            {
+                                break;
+                            }
+                        }
+                        add_arc(points, r, unique_arcs);
+                        begin = index;
+                    }
+                }
+            }
+
+            offset += count;
+        }
+    }
+
+    inline std::vector<arc_type>& arcs()
+    {
+        return m_arcs;
+    }
+
+    inline std::vector<arc_type> const& arcs() const
+    {
+        return m_arcs;
+    }
+
+    inline std::size_t ring_count() const
+    {
+        return m_rings.size();
+    }
+
+    // The points of the input ring, without the closing point
+    inline std::vector<Point> const& ring(std::size_t r) const
+    {
+        return m_rings[r];
+    }
+
+    inline std::vector<coverage_arc_use> const& ring_arcs(std::size_t r) const
+    {
+        return m_ring_arcs[r];
+    }
+
+    // Appends the points of the ring, with the simplified arcs
+    template <typename Ring>
+    inline void assemble(std::size_t r, Ring& ring) const
+    {
+        bool const closed = geometry::closure<Ring>::value == geometry::closed;
+
+        std::vector<coverage_arc_use> const& uses = m_ring_arcs[r];
+        if (uses.empty())
+        {
+            // Empty ring
+            return;
+        }
+
+        std::size_t count = 0;
+        for (coverage_arc_use const& use : uses)
+        {
+            std::vector<Point> const& points = m_arcs[use.arc].simplified;
+            std::size_t const size = points.size();
+            // The first point is the last point of the previous arc
+            for (std::size_t i = count == 0 ? 0 : 1; i < size; i++)
+            {
+                range::push_back(ring, points[use.reversed ? size - 1 - i : i]);
+                count++;
+            }
+        }
+
+        if (! closed && count > 0)
+        {
+            range::resize(ring, count - 1);
+        }
+    }
+
+private:
+    // Marks the vertices having different neighbours in the rings
+    // containing them
+    inline std::vector<bool> find_junctions() const
+    {
+        less_type less;
+
+        std::vector<vertex> vertices;
+        std::vector<std::size_t> offsets;
+        for (std::size_t r = 0; r < m_rings.size(); r++)
+        {
+            offsets.push_back(vertices.size());
+            for (std::size_t i = 0; i < m_rings[r].size(); i++)
+            {
+                vertex const v = { r, i };
+                vertices.push_back(v);
+            }
+        }
+
+        std::sort(vertices.begin(), vertices.end(),
+                  [&](vertex const& left, vertex const& right)
+                  {
+                      return less(point(left), point(right))
+                          || (! less(point(right), point(left))
+                              && (left.ring < right.ring
+                                  || (left.ring == right.ring
+                                      && left.index < right.index)));
+                  });
+
+        std::vector<bool> result(vertices.size(), false);
+
+        for (std::size_t first = 0; first < vertices.size(); )
+        {
+            std::size_t last = first + 1;
+            while (last < vertices.size()
+                   && ! less(point(vertices[first]), point(vertices[last])))
+            {
+                last++;
+            }
+
+            bool junction = false;
+            if (last - first > 1)
+            {
+                std::pair<Point, Point> const neighbours = sorted_neighbours(vertices[first]);
+                for (std::size_t i = first + 1; i < last && ! junction; i++)
+                {
+                    std::pair<Point, Point> const other = sorted_neighbours(vertices[i]);
+                    junction = less(neighbours.first, other.first)
+                            || less(other.first, neighbours.first)
+                            || less(neighbours.second, other.second)
+                            || less(other.second, neighbours.second);
+                }
+            }
+
+            if (junction)
+            {
+                for (std::size_t i = first; i < last; i++)
+                {
+                    result[offsets[vertices[i].ring] + vertices[i].index] = true;
+                }
+            }
+
+            first = last;
+        }
+
+        return result;
+    }
+
+    inline Point const& point(vertex const& v) const
+    {
+        return m_rings[v.ring][v.index];
+    }
+
+    inline std::pair<Point, Point> sorted_neighbours(vertex const& v) const
+    {
+        std::vector<Point> const& ring = m_rings[v.ring];
+        std::size_t const count = ring.size();
+        Point const& previous = ring[(v.index + count - 1) % count];
+        Point const& next = ring[(v.index + 1) % count];
+        return less_type()(next, previous)
+            ? std::make_pair(next, previous)
+            : std::make_pair(previous, next);
+    }
+
+    template <typename UniqueArcs>
+    inline void add_closed_arc(std::vector<Point> const& ring, std::size_t r,
+                               UniqueArcs& unique_arcs)
+    {
+        std::size_t const count = ring.size();
+        std::size_t const start = std::min_element(ring.begin(), ring.end(),
+                                                   less_type()) - ring.begin();
+
+        std::vector<Point> points;
+        for (std::size_t i = 0; i <= count; i++)
+        {
+            points.push_back(ring[(start + i) % count]);
+        }
+        add_arc(points, r, unique_arcs);
+    }
+
+    template <typename UniqueArcs>
+    inline void add_arc(std::vector<Point>& points, std::size_t r,
+                        UniqueArcs& unique_arcs)
+    {
+        std::vector<Point> reversed(points.rbegin(), points.rend());
+        coverage_arc_use use;
+        use.reversed = std::lexicographical_compare(reversed.begin(), reversed.end(),
+                                                    points.begin(), points.end(),
+                                                    less_type());
+
+        arc_type arc;
+        arc.points.swap(use.reversed ? reversed : points);
+        arc.level = 0;
+        m_arcs.push_back(std::move(arc));
+
+        auto const inserted = unique_arcs.insert(m_arcs.size() - 1);
+        if (! inserted.second)
+        {
+            m_arcs.pop_back();
+        }
+        use.arc = *inserted.first;
+        m_ring_arcs[r].push_back(use);
+    }
+
+    std::vector<std::vector<Point> > m_rings;
+    std::vector<std::vector<coverage_arc_use> > m_ring_arcs;
+    std::vector<arc_type> m_arcs;
+};
+
+
+template <typename Point, typename Distance, typename Strategies>
+inline void simplify_arc(coverage_arc<Point>& arc, Distance const& max_distance,
+                         Strategies const& strategies)
+{
+    typedef detail::simplify::douglas_peucker douglas_peucker;
+    geometry::less<Point> const less;
+
+    arc.simplified.clear();
+
+    if (arc.level >= coverage_arc<Point>::max_level || arc.points.size() <= 2)
+    {
+        arc.simplified = arc.points;
+        return;
+    }
+
+    Distance distance = max_distance;
+    for (std::size_t i = 0; i < arc.level; i++)
+    {
+        distance /= 2;
+    }
+
+    douglas_peucker::apply(arc.points, std::back_inserter(arc.simplified),
+                           distance, strategies);
+
+    // A ring consisting of one arc keeps at least three points
+    if (arc.simplified.size() < 4
+        && arc.points.size() >= 4
+        && ! less(arc.points.front(), arc.points.back())
+        && ! less(arc.points.back(), arc.points.front()))
+    {
+        arc.simplified.clear();
+        douglas_peucker::apply(arc.points, std::back_inserter(arc.simplified),
+                               Distance(0), 4, strategies);
+    }
+}
+
+
+// The relate strategies in the coordinate system, and with the model,
+// of the simplify strategies
+template
+<
+    typename Strategies,
+    typename CSTag = typename Strategies::cs_tag
+>
+struct relate_strategies
+{};
+
+template <typename Strategies>
+struct relate_strategies<Strategies, cartesian_tag>
+{
+    static inline strategies::relate::cartesian<> get(Strategies const& )
+    {
+        return strategies::relate::cartesian<>();
+    }
+};
+
+template <typename CalculationType>
+struct relate_strategies
+    <
+        strategies::simplify::cartesian<CalculationType>, cartesian_tag
+    >
+{
+    static inline strategies::relate::cartesian<CalculationType>
+        get(strategies::simplify::cartesian<CalculationType> const& )
+    {
+        return strategies::relate::cartesian<CalculationType>();
+    }
+};
+
+template <typename Strategies>
+struct relate_strategies<Strategies, spherical_tag>
+{
+    // The relations of points and segments on a sphere do not depend
+    // on its radius
+    static inline strategies::relate::spherical<> get(Strategies const& )
+    {
+        return strategies::relate::spherical<>();
+    }
+};
+
+template <typename RadiusTypeOrSphere, typename CalculationType>
+struct relate_strategies
+    <
+        strategies::simplify::spherical<RadiusTypeOrSphere, CalculationType>,
+        spherical_tag
+    >
+{
+    static inline strategies::relate::spherical<CalculationType>
+        get(strategies::simplify::spherical<RadiusTypeOrSphere, CalculationType> const& )
+    {
+        return strategies::relate::spherical<CalculationType>();
+    }
+};
+
+template <typename Strategies>
+struct relate_strategies<Strategies, geographic_tag>
+{
+    typedef decltype(std::declval<Strategies>().model()) spheroid_type;
+
+    static inline strategies::relate::geographic<strategy::andoyer, spheroid_type>
+        get(Strategies const& strategies)
+    {
+        return strategies::relate::geographic
+            <
+                strategy::andoyer, spheroid_type
+            >(strategies.model());
+    }
+};
+
+template <typename FormulaPolicy, typename Spheroid, typename CalculationType>
+struct relate_strategies
+    <
+        strategies::simplify::geographic<FormulaPolicy, Spheroid, CalculationType>,
+        geographic_tag
+    >
+{
+    static inline strategies::relate::geographic<FormulaPolicy, Spheroid, CalculationType>
+        get(strategies::simplify::geographic<FormulaPolicy, Spheroid, CalculationType> const& strategies)
+    {
+        return strategies::relate::geographic
+            <
+                FormulaPolicy, Spheroid, CalculationType
+            >(strategies.model());
+    }
+};
+
+
+// Returns the indexes of the arcs crossing other arcs, or themselves.
+// Segments may only touch at their common endpoints.
+template <typename Point, typename Strategies>
+inline std::vector<std::size_t> find_crossing_arcs(
+        std::vector<coverage_arc<Point> > const& arcs,
+        Strategies const& strategies,
+        parallel_execution const& policy)
+{
+    typedef model::box<Point> box_type;
+    typedef model::referring_segment<Point const> segment_type;
+    typedef std::pair<std::size_t, std::size_t> segment_id;
+    typedef std::pair<box_type, segment_id> value_type;
+
+    std::vector<value_type> values;
+    for (std::size_t a = 0; a < arcs.size(); a++)
+    {
+        std::vector<Point> const& points = arcs[a].simplified;
+        for (std::size_t i = 0; i + 1 < points.size(); i++)
+        {
+            value_type value;
+            geometry::envelope(segment_type(points[i], points[i + 1]), value.first,
+                               strategies);
+            value.second = segment_id(a, i);
+            values.push_back(value);
+        }
+    }
+
+    typedef index::parameters<index::rstar<16>, Strategies> parameters_type;
+    index::rtree<value_type, parameters_type> const rtree(values,
+        parameters_type(index::rstar<16>(), strategies));
+
+    auto const get_segment = [&](segment_id const& id)
+    {
+        std::vector<Point> const& points = arcs[id.first].simplified;
+        return segment_type(points[id.second], points[id.second + 1]);
+    };
+
+    auto const equal = [](Point const& left, Point const& right)
+    {
+        return ! geometry::less<Point>()(left, right)
+            && ! geometry::less<Point>()(right, left);
+    };
+
+    std::size_t const workers = detail::parallel::worker_count(policy, values.size());
+    std::vector<std::vector<std::size_t> > crossing(workers);
+
+    detail::parallel::for_each_index(policy, values.size(),
+        [&](std::size_t v, std::size_t worker)
+        {
+            segment_type const segment = get_segment(values[v].second);
+
+            std::vector<value_type> found;
+            rtree.query(index::intersects(values[v].first),
+                        std::back_inserter(found));
+
+            for (value_type const& other : found)
+            {
+                if (! (values[v].second < other.second))
+                {
+                    continue;
+                }
+
+                segment_type const other_segment = get_segment(other.second);
+
+                std::vector<Point> points;
+                geometry::intersection(segment, other_segment, points, strategies);
+
+                bool const common_endpoint
+                    = equal(segment.first, other_segment.first)
+                   || equal(segment.first, other_segment.second)
+                   || equal(segment.second, other_segment.first)
+                   || equal(segment.second, other_segment.second);
+
+                if (points.size() > 1 || (! points.empty() && ! common_endpoint))
+                {
+                    crossing[worker].push_back(values[v].second.first);
+                    crossing[worker].push_back(other.second.first);
+                }
+            }
+        });
+
+    std::vector<std::size_t> result;
+    for (std::vector<std::size_t> const& c : crossing)
+    {
+        result.insert(result.end(), c.begin(), c.end());
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+
+// Returns the indexes of the arcs of the rings which are, after
+// simplification, on another side of a neighbouring ring. Arcs not crossing
+// each other can still pass over a whole ring, e.g. a hole close to a removed
+// spike of the exterior ring. The side is checked with a vertex, which is
+// not moved by simplification, not on the boundary of the other ring.
+template <typename Point, typename Strategies>
+inline std::vector<std::size_t> find_misplaced_arcs(
+        coverage<Point> const& cov,
+        Strategies const& strategies,
+        parallel_execution const& policy)
+{
+    typedef model::ring<Point, true, false> ring_type;
+    typedef model::box<Point> box_type;
+    typedef std::pair<box_type, std::size_t> value_type;
+
+    std::size_t const count = cov.ring_count();
+    std::vector<ring_type> originals(count);
+    std::vector<ring_type> simplified(count);
+    std::vector<value_type> values;
+    for (std::size_t r = 0; r < count; r++)
+    {
+        std::vector<Point> const& points = cov.ring(r);
+        if (points.empty())
+        {
+            continue;
+        }
+        originals[r].assign(points.begin(), points.end());
+        cov.assemble(r, simplified[r]);
+
+        // The simplified ring is within the envelope of the input ring
+        value_type value;
+        geometry::envelope(originals[r], value.first, strategies);
+        value.second = r;
+        values.push_back(value);
+    }
+
+    typedef index::parameters<index::rstar<16>, Strategies> parameters_type;
+    index::rtree<value_type, parameters_type> const rtree(values,
+        parameters_type(index::rstar<16>(), strategies));
+
+    // Returns false if a vertex of the simplified ring is inside the other
+    // ring and outside the simplified other ring, or vice versa
+    auto const same_side = [&](std::size_t r, std::size_t other)
+    {
+        for (Point const& point : simplified[r])
+        {
+            int const before = detail::within::point_in_geometry(point,
+                                    originals[other], strategies);
+            int const after = detail::within::point_in_geometry(point,
+                                    simplified[other], strategies);
+            if (before != 0 && after != 0)
+            {
+                return (before > 0) == (after > 0);
+            }
+        }
+        return true;
+    };
+
+    std::size_t const workers = detail::parallel::worker_count(policy, values.size());
+    std::vector<std::vector<std::size_t> > misplaced(workers);
+
+    detail::parallel::for_each_index(policy, values.size(),
+        [&](std::size_t v, std::size_t worker)
+        {
+            std::size_t const r = values[v].second;
+
+            std::vector<value_type> found;
+            rtree.query(index::intersects(values[v].first),
+                        std::back_inserter(found));
+
+            for (value_type const& other : found)
+            {
+                if (other.second == r || same_side(r, other.second))
+                {
+                    continue;
+                }
+
+                for (std::size_t ring : { r, other.second })
+                {
+                    for (coverage_arc_use const& use : cov.ring_arcs(ring))
+                    {
+                        misplaced[worker].push_back(use.arc);
+                    }
+                }
+            }
+        });
+
+    std::vector<std::size_t> result;
+    for (std::vector<std::size_t> const& m : misplaced)
+    {
+        result.insert(result.end(), m.begin(), m.end());
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+
+template
+<
+    typename Polygons, typename PolygonsOut,
+    typename Distance, typename Strategies
+>
+inline void simplify_coverage(Polygons const& polygons,
+                              PolygonsOut& out,
+                              Distance const& max_distance,
+                              Strategies const& strategies,
+                              parallel_execution const& policy)
+{
+    typedef typename boost::range_value<Polygons>::type polygon_type;
+    typedef typename geometry::point_type<polygon_type>::type point_type;
+    typedef typename boost::range_value<PolygonsOut>::type polygon_out_type;
+    typedef typename geometry::ring_type<polygon_out_type>::type ring_out_type;
+
+    coverage<point_type> cov;
+
+    for (polygon_type const& polygon : polygons)
+    {
+        cov.add_ring(geometry::exterior_ring(polygon));
+        for (auto const& interior : geometry::interior_rings(polygon))
+        {
+            cov.add_ring(interior);
+        }
+    }
+
+    cov.build();
+
+    // Each arc is simplified once, the arcs crossing other arcs are
+    // simplified again with a smaller distance
+    auto& arcs = cov.arcs();
+    std::vector<std::size_t> todo(arcs.size());
+    for (std::size_t i = 0; i < todo.size(); i++)
+    {
+        todo[i] = i;
+    }
+
+    auto const relate = relate_strategies<Strategies>::get(strategies);
+
+    while (! todo.empty())
+    {
+        detail::parallel::for_each_index(policy, todo.size(),
+            [&](std::size_t i, std::size_t )
+            {
+                simplify_arc(arcs[todo[i]], max_distance, strategies);
+            });
+
+        // The sides of the rings are only defined if no arcs cross
+        std::vector<std::size_t> crossing = find_crossing_arcs(arcs, relate, policy);
+        if (crossing.empty())
+        {
+            crossing = find_misplaced_arcs(cov, relate, policy);
+        }
+
+        todo.clear();
+        for (std::size_t a : crossing)
+        {
+            // The arcs of the input cross if they cannot be simplified
+            if (arcs[a].level < coverage_arc<point_type>::max_level)
+            {
+                arcs[a].level++;
+                todo.push_back(a);
+            }
+        }
+    }
+
+    std::size_t r = 0;
+    for (polygon_type const& polygon : polygons)
+    {
+        polygon_out_type polygon_out;
+        cov.assemble(r++, geometry::exterior_ring(polygon_out));
+        for (std::size_t i = 0; i < boost::size(geometry::interior_rings(polygon)); i++)
+        {
+            ring_out_type ring;
+            cov.assemble(r++, ring);
+            range::push_back(geometry::interior_rings(polygon_out), std::move(ring));
+        }
+        range::push_back(out, std::move(polygon_out));
+    }
+}
+
+
+}} // namespace detail::simplify_coverage
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace resolve_strategy
+{
+
+template
+<
+    typename Strategies,
+    bool IsUmbrella = strategies::detail::is_umbrella_strategy<Strategies>::value
+>
+struct simplify_coverage
+{
+    template <typename Polygons, typename PolygonsOut, typename Distance>
+    static inline void apply(Polygons const& polygons,
+                             PolygonsOut& out,
+                             Distance const& max_distance,
+                             Strategies const& strategies,
+                             parallel_execution const& policy)
+    {
+        detail::simplify_coverage::simplify_coverage(polygons, out,
+                                                     max_distance,
+                                                     strategies, policy);
+    }
+};
+
+template <typename Strategy>
+struct simplify_coverage<Strategy, false>
+{
+    template <typename Polygons, typename PolygonsOut, typename Distance>
+    static inline void apply(Polygons const& polygons,
+                             PolygonsOut& out,
+                             Distance const& max_distance,
+                             Strategy const& strategy,
+                             parallel_execution const& policy)
+    {
+        using strategies::simplify::services::strategy_converter;
+
+        detail::simplify_coverage::simplify_coverage(polygons, out,
+            max_distance, strategy_converter<Strategy>::get(strategy), policy);
+    }
+};
+
+template <>
+struct simplify_coverage<default_strategy, false>
+{
+    template <typename Polygons, typename PolygonsOut, typename Distance>
+    static inline void apply(Polygons const& polygons,
+                             PolygonsOut& out,
+                             Distance const& max_distance,
+                             default_strategy,
+                             parallel_execution const& policy)
+    {
+        typedef typename strategies::simplify::services::default_strategy
+            <
+                typename boost::range_value<Polygons>::type
+            >::type strategy_type;
+
+        detail::simplify_coverage::simplify_coverage(polygons, out,
+            max_distance, strategy_type(), policy);
+    }
+};
+
+} // namespace resolve_strategy
+
+
+/*!
+\brief Simplify the polygons of a coverage, keeping their borders shared
+\ingroup simplify
+\details The polygons of a coverage do not overlap and their common
+    borders consist of the same points. The borders shared by the
+    polygons, and the remaining parts of their rings, are simplified
+    once, concurrently, with Douglas-Peucker. The simplified polygons
+    are assembled from the simplified borders, so they remain adjacent.
+    The borders crossing other borders after simplification, or moving
+    a ring to the other side of a neighbouring ring, are simplified again
+    with smaller distances, or kept as they are.
+\tparam Polygons \tparam_range{Polygons}, e.g. a multi polygon
+\tparam PolygonsOut \tparam_range{PolygonsOut}
+\tparam Distance A numerical distance measure
+\tparam Strategy A type fulfilling a SimplifyStrategy concept
+\param policy the parallel execution policy
+\param polygons the polygons of the coverage
+\param out range to which the simplified polygons are appended,
+    in the order of the input polygons
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+\param strategy simplify strategy to be used for simplification
+
+\qbk{distinguish,parallel with strategy}
+*/
+template
+<
+    typename Polygons, typename PolygonsOut,
+    typename Distance, typename Strategy
+>
+inline void simplify_coverage(parallel_execution const& policy,
+                              Polygons const& polygons,
+                              PolygonsOut& out,
+                              Distance const& max_distance,
+                              Strategy const& strategy)
+{
+    concepts::check<typename boost::range_value<Polygons>::type const>();
+    concepts::check<typename boost::range_value<PolygonsOut>::type>();
+
+    resolve_strategy::simplify_coverage
+        <
+            Strategy
+        >::apply(polygons, out, max_distance, strategy, policy);
+}
+
+/*!
+\brief Simplify the polygons of a coverage, keeping their borders shared
+\ingroup simplify
+\tparam Polygons \tparam_range{Polygons}, e.g. a multi polygon
+\tparam PolygonsOut \tparam_range{PolygonsOut}
+\tparam Distance A numerical distance measure
+\param policy the parallel execution policy
+\param polygons the polygons of the coverage
+\param out range to which the simplified polygons are appended,
+    in the order of the input polygons
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+
+\qbk{distinguish,parallel}
+*/
+template <typename Polygons, typename PolygonsOut, typename Distance>
+inline void simplify_coverage(parallel_execution const& policy,
+                              Polygons const& polygons,
+                              PolygonsOut& out,
+                              Distance const& max_distance)
+{
+    geometry::simplify_coverage(policy, polygons, out, max_distance,
+                                default_strategy());
+}
+
+/*!
+\brief Simplify the polygons of a coverage, keeping their borders shared
+\ingroup simplify
+\tparam Polygons \tparam_range{Polygons}, e.g. a multi polygon
+\tparam PolygonsOut \tparam_range{PolygonsOut}
+\tparam Distance A numerical distance measure
+\tparam Strategy A type fulfilling a SimplifyStrategy concept
+\param polygons the polygons of the coverage
+\param out range to which the simplified polygons are appended,
+    in the order of the input polygons
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+\param strategy simplify strategy to be used for simplification
+
+\qbk{distinguish,with strategy}
+*/
+template
+<
+    typename Polygons, typename PolygonsOut,
+    typename Distance, typename Strategy
+>
+inline void simplify_coverage(Polygons const& polygons,
+                              PolygonsOut& out,
+                              Distance const& max_distance,
+                              Strategy const& strategy)
+{
+    geometry::simplify_coverage(parallel_execution(1), polygons, out,
+                                max_distance, strategy);
+}
+
+/*!
+\brief Simplify the polygons of a coverage, keeping their borders shared
+\ingroup simplify
+\tparam Polygons \tparam_range{Polygons}, e.g. a multi polygon
+\tparam PolygonsOut \tparam_range{PolygonsOut}
+\tparam Distance A numerical distance measure
+\param polygons the polygons of the coverage
+\param out range to which the simplified polygons are appended,
+    in the order of the input polygons
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+*/
+template <typename Polygons, typename PolygonsOut, typename Distance>
+inline void simplify_coverage(Polygons const& polygons,
+                              PolygonsOut& out,
+                              Distance const& max_distance)
+{
+    geometry::simplify_coverage(parallel_execution(1), polygons, out,
+                                max_distance, default_strategy());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_COVERAGE_HPP
@@ -0,0 +1,477 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GIS_IO_LINE_READER_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GIS_IO_LINE_READER_HPP
+
+
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <istream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/core/ignore_unused.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/io/io.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/util/parallel.hpp>
+
+#include <boost/geometry/extensions/gis/io/wkb/read_wkb.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/utility.hpp>
+#include <boost/geometry/extensions/multi/gis/io/wkb/read_wkb.hpp>
+
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_USE_THREADS
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace line_reader
+{
+
+
+// Calls function(first, last) for the lines of the characters, without
+// the line ends. Empty lines are skipped.
+template <typename Function>
+inline void for_each_line(char const* first, char const* last,
+                          Function const& function)
+{
+    while (first != last)
+    {
+        char const* end = static_cast<char const*>(
+            std::memchr(first, '\n', std::size_t(last - first)));
+        if (end == nullptr)
+        {
+            end = last;
+        }
+
+        char const* line_end = end;
+        if (line_end != first && *(line_end - 1) == '\r')
+        {
+            --line_end;
+        }
+        if (line_end != first)
+        {
+            function(first, line_end);
+        }
+
+        first = end == last ? last : end + 1;
+    }
+}
+
+
+template <typename Format, typename Geometry>
+struct line_parser
+{
+    BOOST_GEOMETRY_STATIC_ASSERT_FALSE(
+        "Not implemented for this Format.",
+        Format);
+};
+
+template <typename Geometry>
+struct line_parser<format_wkt, Geometry>
+{
+    inline void apply(char const* first, char const* last, Geometry& geometry)
+    {
+        geometry::read_wkt(first, last, geometry);
+    }
+};
+
+// Lines of hexadecimal WKB, decoded into a buffer reused for all lines
+template <typename Geometry>
+struct line_parser<format_wkb, Geometry>
+{
+    inline void apply(char const* first, char const* last, Geometry& geometry)
+    {
+        m_bytes.clear();
+        if (! geometry::hex2wkb(first, last, std::back_inserter(m_bytes))
+            || ! geometry::read_wkb(m_bytes.begin(), m_bytes.end(), geometry))
+        {
+            BOOST_THROW_EXCEPTION(read_wkb_exception());
+        }
+    }
+
+private:
+    std::vector<boost::uint8_t> m_bytes;
+};
+
+
+// Parses the lines of a chunk, appending the geometries
+template <typename Parser, typename Geometry>
+inline void parse_chunk(std::string const& chunk, Parser& parser,
+                        std::vector<Geometry>& geometries)
+{
+    for_each_line(chunk.data(), chunk.data() + chunk.size(),
+        [&](char const* first, char const* last)
+        {
+            geometries.emplace_back();
+            parser.apply(first, last, geometries.back());
+        });
+}
+
+
+// Reads chunks of complete lines from a stream. The characters following
+// the last line end are kept for the next chunk.
+class chunk_source
+{
+public:
+    chunk_source(std::istream& is, std::size_t chunk_size)
+        : m_is(is)
+        , m_chunk_size(chunk_size > 0 ? chunk_size : 1)
+    {}
+
+    // Replaces the contents of chunk, returns false at the end of the stream
+    inline bool next(std::string& chunk)
+    {
+        chunk.clear();
+        chunk.swap(m_rest);
+
+        // A line longer than the chunk size is read completely
+        while (m_is.good())
+        {
+            std::size_t const size = chunk.size();
+            chunk.resize(size + m_chunk_size);
+            m_is.read(&chunk[size], std::streamsize(m_chunk_size));
+            chunk.resize(size + std::size_t(m_is.gcount()));
+
+            for (std::size_t i = chunk.size(); i > size; --i)
+            {
+                if (chunk[i - 1] == '\n')
+                {
+                    m_rest.assign(chunk, i, std::string::npos);
+                    chunk.resize(i);
+                    return true;
+                }
+            }
+        }
+
+        return ! chunk.empty();
+    }
+
+private:
+    std::istream& m_is;
+    std::size_t m_chunk_size;
+    std::string m_rest;
+};
+
+
+}} // namespace detail::line_reader
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Reads geometries from a stream of lines, one geometry per line
+\details The stream is read in chunks of complete lines. The chunks are
+    parsed, either in the calling thread or concurrently by a number of
+    threads, and handed out as batches of geometries by next(). The number
+    of chunks read and not yet handed out is limited to twice the number
+    of threads, so the memory used does not depend on the size of the stream.
+    Empty lines are skipped, Windows line ends are accepted.
+\tparam Geometry \tparam_geometry
+\tparam Format format_wkt for lines of \ref WKT, format_wkb for lines of
+    hexadecimal WKB
+\note The first exception thrown by the parsers (e.g. read_wkt_exception or
+    read_wkb_exception) is rethrown by next(), in the place of the batch of
+    its chunk. The reader is then stopped and next() returns false.
+*/
+template <typename Geometry, typename Format = format_wkt>
+class line_reader
+{
+    typedef detail::line_reader::line_parser<Format, Geometry> parser_type;
+
+public:
+    //! The default size of the chunks, in characters
+    static const std::size_t default_chunk_size = 1 << 20;
+
+    //! Reads and parses the chunks in the calling thread
+    explicit line_reader(std::istream& is,
+                         std::size_t chunk_size = default_chunk_size)
+        : m_source(is, chunk_size)
+        , m_stopped(false)
+    {
+        geometry::concepts::check<Geometry>();
+    }
+
+    /*!
+    \brief Reads and parses the chunks concurrently
+    \param policy the number of threads
+    \param is the input stream
+    \param chunk_size the size of the chunks, in characters
+    \param ordered if true the batches are handed out in the order of the
+        lines, otherwise in the order in which they are parsed
+    */
+    line_reader(parallel_execution const& policy, std::istream& is,
+                std::size_t chunk_size = default_chunk_size,
+                bool ordered = true)
+        : m_source(is, chunk_size)
+        , m_stopped(false)
+    {
+        geometry::concepts::check<Geometry>();
+
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_USE_THREADS
+        std::size_t const workers = detail::parallel::worker_count(policy,
+                                                                   std::size_t(-1));
+        if (workers > 1)
+        {
+            m_ordered = ordered;
+            m_capacity = 2 * workers;
+            m_reserved = 0;
+            m_read = 0;
+            m_handed_out = 0;
+            m_end = false;
+            m_running = workers;
+
+            try
+            {
+                m_threads.reserve(workers);
+                for (std::size_t i = 0; i < workers; ++i)
+                {
+                    m_threads.emplace_back([this]() { work(); });
+                }
+            }
+            catch (...)
+            {
+                // The threads which were created do the work, or the
+                // calling thread if there are none
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_running -= workers - m_threads.size();
+            }
+        }
+#else
+        boost::ignore_unused(policy, ordered);
+#endif
+    }
+
+    line_reader(line_reader const&) = delete;
+    line_reader& operator=(line_reader const&) = delete;
+
+    ~line_reader()
+    {
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_USE_THREADS
+        if (! m_threads.empty())
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopped = true;
+            }
+            m_consumed.notify_all();
+            for (std::thread& thread : m_threads)
+            {
+                thread.join();
+            }
+        }
+#endif
+    }
+
+    /*!
+    \brief Replaces the contents of batch by the geometries of the next chunk
+    \return false if all lines were read, batch is then empty
+    */
+    inline bool next(std::vector<Geometry>& batch)
+    {
+        batch.clear();
+
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_USE_THREADS
+        if (! m_threads.empty())
+        {
+            return next_parsed(batch);
+        }
+#endif
+
+        if (m_stopped)
+        {
+            return false;
+        }
+
+        try
+        {
+            // Chunks without lines (e.g. only line ends) are skipped
+            while (batch.empty() && m_source.next(m_chunk))
+            {
+                detail::line_reader::parse_chunk(m_chunk, m_parser, batch);
+            }
+        }
+        catch (...)
+        {
+            m_stopped = true;
+            batch.clear();
+            throw;
+        }
+
+        return ! batch.empty();
+    }
+
+private:
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_USE_THREADS
+    struct parsed_chunk
+    {
+        std::vector<Geometry> geometries;
+        std::exception_ptr exception;
+    };
+
+    inline bool next_parsed(std::vector<Geometry>& batch)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true)
+        {
+            m_produced.wait(lock, [this]()
+            {
+                return m_stopped
+                    || (m_running == 0 && m_parsed.empty())
+                    || (! m_parsed.empty()
+                        && (! m_ordered || m_parsed.begin()->first == m_handed_out));
+            });
+
+            if (m_stopped || m_parsed.empty())
+            {
+                return false;
+            }
+
+            parsed_chunk chunk = std::move(m_parsed.begin()->second);
+            m_parsed.erase(m_parsed.begin());
+            ++m_handed_out;
+
+            if (chunk.exception)
+            {
+                m_stopped = true;
+                lock.unlock();
+                m_consumed.notify_all();
+                std::rethrow_exception(chunk.exception);
+            }
+
+            m_consumed.notify_one();
+
+            if (! chunk.geometries.empty())
+            {
+                batch = std::move(chunk.geometries);
+                return true;
+            }
+        }
+    }
+
+    // Reserves a place for a chunk, reads it, parses it and stores it,
+    // until the end of the stream or until the reader is stopped
+    inline void work()
+    {
+        parser_type parser;
+        std::string text;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_consumed.wait(lock, [this]()
+                {
+                    return m_stopped || m_end
+                        || m_reserved - m_handed_out < m_capacity;
+                });
+                if (m_stopped || m_end)
+                {
+                    break;
+                }
+                ++m_reserved;
+            }
+
+            // The chunks are numbered in the order in which they are read
+            parsed_chunk chunk;
+            std::size_t sequence = 0;
+            bool read = false;
+            {
+                std::lock_guard<std::mutex> lock(m_source_mutex);
+                try
+                {
+                    read = m_source.next(text);
+                }
+                catch (...)
+                {
+                    chunk.exception = std::current_exception();
+                    read = true;
+                }
+                if (read)
+                {
+                    sequence = m_read++;
+                }
+            }
+
+            if (read && ! chunk.exception)
+            {
+                try
+                {
+                    detail::line_reader::parse_chunk(text, parser, chunk.geometries);
+                }
+                catch (...)
+                {
+                    chunk.exception = std::current_exception();
+                    chunk.geometries.clear();
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (read)
+                {
+                    m_parsed.insert(std::make_pair(sequence, std::move(chunk)));
+                }
+                else
+                {
+                    --m_reserved;
+                    m_end = true;
+                }
+            }
+            m_produced.notify_all();
+            m_consumed.notify_all();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_running;
+        }
+        m_produced.notify_all();
+    }
+#endif
+
+    detail::line_reader::chunk_source m_source;
+    bool m_stopped;
+
+    // Used by the calling thread
+    std::string m_chunk;
+    parser_type m_parser;
+
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_USE_THREADS
+    bool m_ordered;
+    std::size_t m_capacity;
+    std::size_t m_reserved;
+    std::size_t m_read;
+    std::size_t m_handed_out;
+    bool m_end;
+    std::size_t m_running;
+    std::map<std::size_t, parsed_chunk> m_parsed;
+    std::mutex m_mutex;
+    std::mutex m_source_mutex;
+    std::condition_variable m_produced;
+    std::condition_variable m_consumed;
+    std::vector<std::thread> m_threads;
+#endif
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GIS_IO_LINE_READER_HPP
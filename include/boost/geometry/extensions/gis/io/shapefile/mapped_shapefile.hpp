@@ -0,0 +1,361 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_MAPPED_SHAPEFILE_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_MAPPED_SHAPEFILE_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <ios>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/empty.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/extensions/gis/io/shapefile/read.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/util/parallel.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace detail { namespace shapefile
+{
+
+// Input stream over bytes in memory, providing the functions used by
+// the record reading policies
+class memory_stream
+{
+public:
+    typedef std::ios_base::seekdir seekdir;
+
+    static const seekdir beg = std::ios_base::beg;
+    static const seekdir cur = std::ios_base::cur;
+
+    memory_stream(char const* first, char const* last)
+        : m_first(first)
+        , m_size(std::size_t(last - first))
+        , m_position(0)
+        , m_good(true)
+    {}
+
+    inline memory_stream& read(char* bytes, std::streamsize count)
+    {
+        std::size_t const size = std::size_t(count);
+        if (! m_good || m_position > m_size || m_size - m_position < size)
+        {
+            m_good = false;
+            return *this;
+        }
+        std::memcpy(bytes, m_first + m_position, size);
+        m_position += size;
+        return *this;
+    }
+
+    inline memory_stream& seekg(std::streamoff offset)
+    {
+        return seekg(offset, beg);
+    }
+
+    // Moving past the end is detected by the next read, as in std::istream
+    inline memory_stream& seekg(std::streamoff offset, seekdir dir)
+    {
+        std::streamoff const position = (dir == beg ? 0 : std::streamoff(m_position))
+                                      + offset;
+        if (position < 0)
+        {
+            m_good = false;
+        }
+        else
+        {
+            m_position = std::size_t(position);
+        }
+        return *this;
+    }
+
+    inline bool good() const
+    {
+        return m_good;
+    }
+
+    inline void clear()
+    {
+        m_good = true;
+    }
+
+private:
+    char const* m_first;
+    std::size_t m_size;
+    std::size_t m_position;
+    bool m_good;
+};
+
+
+// Moves the geometries read from a block of records to the output
+template
+<
+    typename Geometry,
+    typename Tag = typename geometry::tag<Geometry>::type
+>
+struct move_records
+{
+    template <typename Range>
+    static inline void apply(Range & rng, Range & records, boost::int32_t)
+    {
+        for (auto it = boost::begin(records); it != boost::end(records); ++it)
+        {
+            range::push_back(rng, std::move(*it));
+        }
+    }
+};
+
+// The points of a point file are added to the last multi point, as
+// add_record_to_last_element does
+template <typename Geometry>
+struct move_records<Geometry, multi_point_tag>
+{
+    template <typename Range>
+    static inline void apply(Range & rng, Range & records, boost::int32_t type)
+    {
+        if (! is_point_type(type) || boost::empty(records))
+        {
+            move_records<Geometry, void>::apply(rng, records, type);
+            return;
+        }
+
+        if (boost::empty(rng))
+        {
+            range::push_back(rng, std::move(range::front(records)));
+            return;
+        }
+
+        Geometry & multi_point = range::back(rng);
+        for (auto const& point : range::front(records))
+        {
+            range::push_back(multi_point, point);
+        }
+    }
+};
+
+}} // namespace detail::shapefile
+
+
+/*!
+\brief Records of a shapefile mapped in memory
+\details The .shp file is mapped in memory and the offsets of its records
+    are taken from the .shx index file, so the records can be read
+    independently, in any order and concurrently.
+*/
+class mapped_shapefile
+{
+public:
+    //! Maps the .shp and .shx files, throws read_shapefile_exception if
+    //! the headers are invalid
+    mapped_shapefile(std::string const& shp_path, std::string const& shx_path)
+        : m_shp_region(map(shp_path))
+        , m_shx_region(map(shx_path))
+    {
+        init(static_cast<char const*>(m_shp_region.get_address()),
+             m_shp_region.get_size(),
+             static_cast<char const*>(m_shx_region.get_address()),
+             m_shx_region.get_size());
+    }
+
+    //! Uses the contents of .shp and .shx files in memory, which have to
+    //! outlive this object
+    mapped_shapefile(char const* shp, std::size_t shp_size,
+                     char const* shx, std::size_t shx_size)
+    {
+        init(shp, shp_size, shx, shx_size);
+    }
+
+    //! Returns the number of records
+    inline std::size_t size() const
+    {
+        return m_size;
+    }
+
+    //! Returns the shape type of the file
+    inline boost::int32_t type() const
+    {
+        return m_type;
+    }
+
+    /*!
+    \brief Reads the geometries of a record and adds them to a range, as
+        read_shapefile does for all records
+    \details Throws read_shapefile_exception if the index is not less
+        than size() or the record is invalid
+    */
+    template <typename RangeOfGeometries, typename Strategy>
+    inline void read(std::size_t index, RangeOfGeometries & range_of_geometries,
+                     Strategy const& strategy) const
+    {
+        typedef typename boost::range_value<RangeOfGeometries>::type geometry_type;
+
+        detail::shapefile::memory_stream is = record(index);
+        dispatch::read_shapefile<geometry_type>::apply_record(is,
+            range_of_geometries, m_type, strategy);
+    }
+
+    template <typename RangeOfGeometries>
+    inline void read(std::size_t index, RangeOfGeometries & range_of_geometries) const
+    {
+        typedef typename boost::range_value<RangeOfGeometries>::type geometry_type;
+        typedef typename strategies::io::services::default_strategy
+            <
+                geometry_type
+            >::type strategy_type;
+
+        read(index, range_of_geometries, strategy_type());
+    }
+
+private:
+    static inline boost::interprocess::mapped_region map(std::string const& path)
+    {
+        namespace bip = boost::interprocess;
+        bip::file_mapping const mapping(path.c_str(), bip::read_only);
+        return bip::mapped_region(mapping, bip::read_only);
+    }
+
+    static inline boost::int32_t load_big(char const* bytes)
+    {
+        boost::int32_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return boost::endian::big_to_native(value);
+    }
+
+    inline void init(char const* shp, std::size_t shp_size,
+                     char const* shx, std::size_t shx_size)
+    {
+        static const std::size_t header_size = 100;
+        static const std::size_t index_record_size = 8;
+
+        detail::shapefile::double_endianness_check();
+
+        detail::shapefile::memory_stream is(shp, shp + shp_size);
+        m_type = detail::shapefile::reset_and_read_header(is);
+
+        if (shx_size < header_size)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid index header"));
+        }
+
+        m_shp = shp;
+        m_shp_size = shp_size;
+        m_index = shx + header_size;
+        m_size = (shx_size - header_size) / index_record_size;
+    }
+
+    // Returns the stream of the contents of a record, after its header
+    inline detail::shapefile::memory_stream record(std::size_t index) const
+    {
+        static const std::size_t record_header_size = 8;
+
+        if (index >= m_size)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid record index"));
+        }
+
+        // The offset and the length are numbers of 16-bit words
+        char const* const entry = m_index + index * 8;
+        boost::int32_t const offset = load_big(entry);
+        boost::int32_t const length = load_big(entry + 4);
+        std::size_t const first = std::size_t(offset) * 2 + record_header_size;
+        if (offset < 0 || length < 0 || first > m_shp_size
+            || std::size_t(length) * 2 > m_shp_size - first)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid record offset"));
+        }
+        return detail::shapefile::memory_stream(m_shp + first,
+                                                m_shp + first + std::size_t(length) * 2);
+    }
+
+    boost::interprocess::mapped_region m_shp_region;
+    boost::interprocess::mapped_region m_shx_region;
+    char const* m_shp;
+    std::size_t m_shp_size;
+    char const* m_index;
+    std::size_t m_size;
+    boost::int32_t m_type;
+};
+
+
+/*!
+\brief Reads the records of a mapped shapefile concurrently
+\details The geometries are added to the range in the order of the records,
+    as reading the records one by one with mapped_shapefile::read does.
+\note If an exception is thrown the output range is not modified
+*/
+template <typename RangeOfGeometries, typename Strategy>
+inline void read_shapefile(parallel_execution const& policy,
+                           mapped_shapefile const& shapefile,
+                           RangeOfGeometries & range_of_geometries,
+                           Strategy const& strategy)
+{
+    typedef typename boost::range_value<RangeOfGeometries>::type geometry_type;
+
+    geometry::concepts::check<geometry_type>();
+
+    // Records are decoded in blocks, each into its own range
+    static const std::size_t records_per_block = 64;
+    std::size_t const count = shapefile.size();
+    std::size_t const block_count = (count + records_per_block - 1) / records_per_block;
+
+    std::vector<RangeOfGeometries> blocks(block_count);
+    detail::parallel::for_each_index(policy, block_count,
+        [&](std::size_t block, std::size_t)
+        {
+            std::size_t const first = block * records_per_block;
+            std::size_t const last = (std::min)(first + records_per_block, count);
+            for (std::size_t i = first; i < last; ++i)
+            {
+                shapefile.read(i, blocks[block], strategy);
+            }
+        });
+
+    for (std::size_t i = 0; i < block_count; ++i)
+    {
+        detail::shapefile::move_records<geometry_type>::apply(range_of_geometries,
+            blocks[i], shapefile.type());
+    }
+}
+
+template <typename RangeOfGeometries>
+inline void read_shapefile(parallel_execution const& policy,
+                           mapped_shapefile const& shapefile,
+                           RangeOfGeometries & range_of_geometries)
+{
+    typedef typename boost::range_value<RangeOfGeometries>::type geometry_type;
+    typedef typename strategies::io::services::default_strategy
+        <
+            geometry_type
+        >::type strategy_type;
+
+    read_shapefile(policy, shapefile, range_of_geometries, strategy_type());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_MAPPED_SHAPEFILE_HPP
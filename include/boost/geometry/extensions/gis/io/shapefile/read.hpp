@@ -522,10 +522,7 @@ struct read_polygon_policy
         static const bool is_ccw = geometry::point_order<poly_type>::value == geometry::counterclockwise;
         static const bool is_open = geometry::closure<poly_type>::value == geometry::open;
 
-        typename Strategy::point_order_strategy_type
-            order_strategy = strategy.get_point_order_strategy();
-        typename Strategy::template point_in_geometry_strategy<ring_type, ring_type>::type
-            within_strategy = strategy.template get_point_in_geometry_strategy<ring_type, ring_type>();
+        auto const order_strategy = strategy.point_order();
 
         boost::int32_t t;
         //double min_x, min_y, max_x, max_y;
@@ -653,7 +650,7 @@ struct read_polygon_policy
                     {
                         if (is_inner_ring(inner_rings[j],
                                           geometry::exterior_ring(poly),
-                                          within_strategy))
+                                          strategy))
                         {
                             range::push_back(geometry::interior_rings(poly), std::move(inner_rings[j]));
                             ++assigned_count;
@@ -763,6 +760,66 @@ inline void add_records_as_new_elements(IStream & is, Range & rng, boost::int32_
     }
 }
 
+// Reads one record, the stream is positioned after the record header
+template <typename Policy, typename IStream, typename Range, typename Strategy>
+inline void add_record(IStream & is, Range & rng, boost::int32_t type,
+                       Strategy const& strategy)
+{
+    Policy::apply(is, rng, type, strategy);
+}
+
+template <typename Policy, typename IStream, typename Range, typename Strategy>
+inline void add_record_to_last_element(IStream & is, Range & rng, boost::int32_t type,
+                                       Strategy const& strategy)
+{
+    typedef typename boost::range_value<Range>::type val_type;
+
+    if (boost::empty(rng))
+    {
+        range::push_back(rng, val_type());
+    }
+
+    Policy::apply(is, range::back(rng), type, strategy);
+}
+
+template <typename Policy, typename IStream, typename Range, typename Strategy>
+inline void add_record_as_new_element(IStream & is, Range & rng, boost::int32_t type,
+                                      Strategy const& strategy)
+{
+    typedef typename boost::range_value<Range>::type val_type;
+
+    range::push_back(rng, val_type());
+    Policy::apply(is, range::back(rng), type, strategy);
+}
+
+inline bool is_point_type(boost::int32_t type)
+{
+    return type == shape_type::point
+        || type == shape_type::point_m
+        || type == shape_type::point_z;
+}
+
+inline bool is_multipoint_type(boost::int32_t type)
+{
+    return type == shape_type::multipoint
+        || type == shape_type::multipoint_m
+        || type == shape_type::multipoint_z;
+}
+
+inline bool is_polyline_type(boost::int32_t type)
+{
+    return type == shape_type::polyline
+        || type == shape_type::polyline_m
+        || type == shape_type::polyline_z;
+}
+
+inline bool is_polygon_type(boost::int32_t type)
+{
+    return type == shape_type::polygon
+        || type == shape_type::polygon_m
+        || type == shape_type::polygon_z;
+}
+
 }} // namespace detail::shapefile
 
 namespace dispatch
@@ -800,6 +857,22 @@ struct read_shapefile<Geometry, point_tag>
             shp::add_records<shp::read_multipoint_policy>(is, points, type, strategy);
         }
     }
+
+    template <typename IStream, typename Points, typename Strategy>
+    static inline void apply_record(IStream &is, Points & points, boost::int32_t type,
+                                    Strategy const& strategy)
+    {
+        namespace shp = detail::shapefile;
+
+        if (shp::is_point_type(type))
+        {
+            shp::add_record<shp::read_point_policy>(is, points, type, strategy);
+        }
+        else if (shp::is_multipoint_type(type))
+        {
+            shp::add_record<shp::read_multipoint_policy>(is, points, type, strategy);
+        }
+    }
 };
 
 template <typename Geometry>
@@ -825,6 +898,23 @@ struct read_shapefile<Geometry, multi_point_tag>
             shp::add_records_as_new_elements<shp::read_multipoint_policy>(is, multi_points, type, strategy);
         }
     }
+
+    // All points of a point file are added to one multi point
+    template <typename IStream, typename MultiPoints, typename Strategy>
+    static inline void apply_record(IStream &is, MultiPoints & multi_points, boost::int32_t type,
+                                    Strategy const& strategy)
+    {
+        namespace shp = detail::shapefile;
+
+        if (shp::is_point_type(type))
+        {
+            shp::add_record_to_last_element<shp::read_point_policy>(is, multi_points, type, strategy);
+        }
+        else if (shp::is_multipoint_type(type))
+        {
+            shp::add_record_as_new_element<shp::read_multipoint_policy>(is, multi_points, type, strategy);
+        }
+    }
 };
 
 template <typename Geometry>
@@ -844,6 +934,18 @@ struct read_shapefile<Geometry, linestring_tag>
             shp::add_records<shp::read_polyline_policy>(is, linestrings, type, strategy);
         }
     }
+
+    template <typename IStream, typename Linestrings, typename Strategy>
+    static inline void apply_record(IStream &is, Linestrings & linestrings, boost::int32_t type,
+                                    Strategy const& strategy)
+    {
+        namespace shp = detail::shapefile;
+
+        if (shp::is_polyline_type(type))
+        {
+            shp::add_record<shp::read_polyline_policy>(is, linestrings, type, strategy);
+        }
+    }
 };
 
 template <typename Geometry>
@@ -863,6 +965,18 @@ struct read_shapefile<Geometry, multi_linestring_tag>
             shp::add_records_as_new_elements<shp::read_polyline_policy>(is, multi_linestrings, type, strategy);
         }
     }
+
+    template <typename IStream, typename MultiLinestrings, typename Strategy>
+    static inline void apply_record(IStream &is, MultiLinestrings & multi_linestrings, boost::int32_t type,
+                                    Strategy const& strategy)
+    {
+        namespace shp = detail::shapefile;
+
+        if (shp::is_polyline_type(type))
+        {
+            shp::add_record_as_new_element<shp::read_polyline_policy>(is, multi_linestrings, type, strategy);
+        }
+    }
 };
 
 template <typename Geometry>
@@ -882,6 +996,18 @@ struct read_shapefile<Geometry, polygon_tag>
             shp::add_records<shp::read_polygon_policy>(is, polygons, type, strategy);
         }
     }
+
+    template <typename IStream, typename Polygons, typename Strategy>
+    static inline void apply_record(IStream &is, Polygons & polygons, boost::int32_t type,
+                                    Strategy const& strategy)
+    {
+        namespace shp = detail::shapefile;
+
+        if (shp::is_polygon_type(type))
+        {
+            shp::add_record<shp::read_polygon_policy>(is, polygons, type, strategy);
+        }
+    }
 };
 
 template <typename Geometry>
@@ -901,6 +1027,18 @@ struct read_shapefile<Geometry, multi_polygon_tag>
             shp::add_records_as_new_elements<shp::read_polygon_policy>(is, multi_polygons, type, strategy);
         }
     }
+
+    template <typename IStream, typename MultiPolygons, typename Strategy>
+    static inline void apply_record(IStream &is, MultiPolygons & multi_polygons, boost::int32_t type,
+                                    Strategy const& strategy)
+    {
+        namespace shp = detail::shapefile;
+
+        if (shp::is_polygon_type(type))
+        {
+            shp::add_record_as_new_element<shp::read_polygon_policy>(is, multi_polygons, type, strategy);
+        }
+    }
 };
 
 
@@ -0,0 +1,176 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_TWKB_DETAIL_CODEC_HPP
+#define BOOST_GEOMETRY_IO_TWKB_DETAIL_CODEC_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+
+#include <boost/cstdint.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exception.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace twkb
+{
+
+
+enum geometry_type
+{
+    point_type = 1,
+    linestring_type = 2,
+    polygon_type = 3,
+    multi_point_type = 4,
+    multi_linestring_type = 5,
+    multi_polygon_type = 6,
+    geometry_collection_type = 7
+};
+
+enum metadata_flags
+{
+    bbox_flag = 0x01,
+    size_flag = 0x02,
+    idlist_flag = 0x04,
+    extended_precision_flag = 0x08,
+    empty_flag = 0x10
+};
+
+enum extended_precision_flags
+{
+    z_flag = 0x01,
+    m_flag = 0x02
+};
+
+// The number of values of the coordinates of a point, x, y, z and m
+static const std::size_t max_dimension = 4;
+
+
+inline boost::uint64_t zigzag_encode(boost::int64_t value)
+{
+    return (boost::uint64_t(value) << 1) ^ boost::uint64_t(value >> 63);
+}
+
+inline boost::int64_t zigzag_decode(boost::uint64_t value)
+{
+    return boost::int64_t(value >> 1) ^ -boost::int64_t(value & 1);
+}
+
+// Adds the difference to the value, returns false if the sum does not fit
+inline bool add_difference(boost::int64_t& value, boost::int64_t difference)
+{
+    boost::uint64_t const sum = boost::uint64_t(value) + boost::uint64_t(difference);
+    // The sum overflows if it has another sign than both operands
+    if (((boost::uint64_t(value) ^ sum) & (boost::uint64_t(difference) ^ sum)) >> 63)
+    {
+        return false;
+    }
+    value = boost::int64_t(sum);
+    return true;
+}
+
+
+// Converts coordinates to and from integers with a number of decimal
+// digits, negative precisions round to tens, hundreds, etc. The integers
+// are less than 2^62 in magnitude, so their differences fit in 64 bits.
+class scale
+{
+public:
+    explicit scale(int precision = 0)
+        : m_factor(1)
+        , m_negative(precision < 0)
+    {
+        for (int i = 0; i < (m_negative ? -precision : precision); ++i)
+        {
+            m_factor *= 10;
+        }
+    }
+
+    template <typename T>
+    inline boost::int64_t quantize(T const& value) const
+    {
+        double const v = static_cast<double>(value);
+        double const scaled = m_negative ? v / m_factor : v * m_factor;
+        if (! (std::fabs(scaled) < 4611686018427387904.0)) // 2^62, or not finite
+        {
+            BOOST_THROW_EXCEPTION(invalid_input_exception());
+        }
+        return boost::int64_t(std::llround(scaled));
+    }
+
+    template <typename T>
+    inline T value(boost::int64_t q) const
+    {
+        double const v = static_cast<double>(q);
+        return static_cast<T>(m_negative ? v * m_factor : v / m_factor);
+    }
+
+private:
+    double m_factor;
+    bool m_negative;
+};
+
+
+// The dimensions of a point stored in TWKB, x, y and z
+template <typename Point>
+struct point_dimension
+{
+    static const std::size_t value = geometry::dimension<Point>::value < 3
+                                   ? geometry::dimension<Point>::value : 3;
+};
+
+template
+<
+    typename Point,
+    std::size_t Dimension = 0,
+    std::size_t DimensionCount = point_dimension<Point>::value
+>
+struct coordinates
+{
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    static inline void quantize(Point const& point, scale const* scales,
+                                boost::int64_t* values)
+    {
+        values[Dimension] = scales[Dimension].quantize(geometry::get<Dimension>(point));
+        coordinates<Point, Dimension + 1, DimensionCount>::quantize(point, scales, values);
+    }
+
+    static inline void assign(Point& point, scale const* scales,
+                              boost::int64_t const* values)
+    {
+        geometry::set<Dimension>(point,
+            scales[Dimension].template value<coordinate_type>(values[Dimension]));
+        coordinates<Point, Dimension + 1, DimensionCount>::assign(point, scales, values);
+    }
+};
+
+template <typename Point, std::size_t DimensionCount>
+struct coordinates<Point, DimensionCount, DimensionCount>
+{
+    static inline void quantize(Point const&, scale const*, boost::int64_t*)
+    {}
+
+    static inline void assign(Point&, scale const*, boost::int64_t const*)
+    {}
+};
+
+
+}} // namespace detail::twkb
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_TWKB_DETAIL_CODEC_HPP
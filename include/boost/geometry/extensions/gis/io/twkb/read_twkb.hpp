@@ -0,0 +1,739 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_TWKB_READ_TWKB_HPP
+#define BOOST_GEOMETRY_IO_TWKB_READ_TWKB_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/static_assert.hpp>
+
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/geometry_types.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/mutable_range.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/sequence.hpp>
+#include <boost/geometry/util/type_traits.hpp>
+
+#include <boost/geometry/extensions/gis/io/twkb/detail/codec.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace twkb
+{
+
+
+struct header
+{
+    int type;
+    bool empty;
+};
+
+
+// Reads the headers, the counts and the points of the geometries. The
+// points are the sums of the differences read since the last header.
+template <typename Iterator>
+class decoder
+{
+public:
+    decoder(Iterator begin, Iterator end)
+        : m_it(begin)
+        , m_end(end)
+        , m_dimension(2)
+        , m_has_z(false)
+        , m_has_ids(false)
+    {}
+
+    inline bool get_byte(boost::uint8_t& value)
+    {
+        if (m_it == m_end)
+        {
+            return false;
+        }
+        value = static_cast<boost::uint8_t>(*m_it++);
+        return true;
+    }
+
+    inline bool get_unsigned(boost::uint64_t& value)
+    {
+        value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7)
+        {
+            if (m_it == m_end)
+            {
+                return false;
+            }
+            boost::uint64_t const byte = static_cast<boost::uint8_t>(*m_it++);
+            value |= (byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Each counted element takes at least a byte, larger counts are invalid
+    // and would otherwise allocate memory before running out of input
+    inline bool get_count(std::size_t& count)
+    {
+        boost::uint64_t value = 0;
+        if (! get_unsigned(value) || value > remaining())
+        {
+            return false;
+        }
+        count = static_cast<std::size_t>(value);
+        return true;
+    }
+
+    inline bool get_header(header& h)
+    {
+        boost::uint8_t type = 0, metadata = 0, extended = 0;
+        if (! get_byte(type) || ! get_byte(metadata))
+        {
+            return false;
+        }
+        if ((metadata & extended_precision_flag) != 0 && ! get_byte(extended))
+        {
+            return false;
+        }
+
+        h.type = type & 0x0f;
+        h.empty = (metadata & empty_flag) != 0;
+
+        m_has_z = (extended & z_flag) != 0;
+        m_has_ids = (metadata & idlist_flag) != 0;
+        m_dimension = 2 + (m_has_z ? 1 : 0) + ((extended & m_flag) != 0 ? 1 : 0);
+        m_scales[0] = m_scales[1] = scale(int(zigzag_decode(type >> 4)));
+        m_scales[2] = scale((extended >> 2) & 0x07);
+        std::fill(m_last, m_last + max_dimension, boost::int64_t(0));
+
+        boost::uint64_t value = 0;
+        if ((metadata & size_flag) != 0
+            && (! get_unsigned(value) || value > remaining()))
+        {
+            return false;
+        }
+        if ((metadata & bbox_flag) != 0 && ! h.empty)
+        {
+            for (std::size_t i = 0; i < 2 * m_dimension; ++i)
+            {
+                if (! get_unsigned(value))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Skips the identifiers of the elements of a multi geometry
+    inline bool skip_ids(std::size_t count)
+    {
+        boost::uint64_t value = 0;
+        for (std::size_t i = 0; m_has_ids && i < count; ++i)
+        {
+            if (! get_unsigned(value))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Reads x, y and z, z is zero if not present and m is discarded
+    inline bool get_values(boost::int64_t* values)
+    {
+        boost::uint64_t value = 0;
+        for (std::size_t i = 0; i < m_dimension; ++i)
+        {
+            if (! get_unsigned(value)
+                || ! add_difference(m_last[i], zigzag_decode(value)))
+            {
+                return false;
+            }
+            values[i] = m_last[i];
+        }
+        if (! m_has_z)
+        {
+            values[2] = 0;
+        }
+        return true;
+    }
+
+    template <typename Point>
+    inline bool get_point(Point& point)
+    {
+        boost::int64_t values[max_dimension];
+        if (! get_values(values))
+        {
+            return false;
+        }
+        coordinates<Point>::assign(point, m_scales, values);
+        return true;
+    }
+
+    inline scale const* scales() const
+    {
+        return m_scales;
+    }
+
+private:
+    inline boost::uint64_t remaining() const
+    {
+        return static_cast<boost::uint64_t>(std::distance(m_it, m_end));
+    }
+
+    Iterator m_it;
+    Iterator m_end;
+    std::size_t m_dimension;
+    bool m_has_z;
+    bool m_has_ids;
+    scale m_scales[max_dimension - 1];
+    boost::int64_t m_last[max_dimension];
+};
+
+
+// Points are read in place after resizing the range, the closing point
+// of the rings is dropped for open rings
+template <bool Ring, typename Decoder, typename Range>
+inline bool get_points(Decoder& decoder, Range& range)
+{
+    std::size_t count = 0;
+    if (! decoder.get_count(count))
+    {
+        return false;
+    }
+
+    bool const drop = Ring
+                   && geometry::closure<Range>::value == open
+                   && count > 0;
+    range::resize(range, drop ? count - 1 : count);
+    auto const end = boost::end(range);
+    for (auto it = boost::begin(range); it != end; ++it)
+    {
+        if (! decoder.get_point(*it))
+        {
+            return false;
+        }
+    }
+
+    typename geometry::point_type<Range>::type closing;
+    return ! drop || decoder.get_point(closing);
+}
+
+template <typename Decoder, typename Polygon>
+inline bool get_rings(Decoder& decoder, Polygon& polygon)
+{
+    std::size_t count = 0;
+    if (! decoder.get_count(count))
+    {
+        return false;
+    }
+    if (count == 0)
+    {
+        range::clear(exterior_ring(polygon));
+        range::clear(interior_rings(polygon));
+        return true;
+    }
+
+    if (! get_points<true>(decoder, exterior_ring(polygon)))
+    {
+        return false;
+    }
+    auto&& rings = interior_rings(polygon);
+    range::resize(rings, count - 1);
+    for (auto it = boost::begin(rings); it != boost::end(rings); ++it)
+    {
+        if (! get_points<true>(decoder, *it))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Decoder, typename Multi, typename Policy>
+inline bool get_elements(Decoder& decoder, Multi& multi, Policy const& policy)
+{
+    std::size_t count = 0;
+    if (! decoder.get_count(count) || ! decoder.skip_ids(count))
+    {
+        return false;
+    }
+    range::resize(multi, count);
+    for (auto it = boost::begin(multi); it != boost::end(multi); ++it)
+    {
+        if (! policy(decoder, *it))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+struct dynamic_move_assign
+{
+    template <typename DynamicGeometry, typename Geometry>
+    static void apply(DynamicGeometry& dynamic_geometry, Geometry& geometry)
+    {
+        dynamic_geometry = std::move(geometry);
+    }
+};
+
+struct dynamic_move_emplace_back
+{
+    template <typename GeometryCollection, typename Geometry>
+    static void apply(GeometryCollection& geometry_collection, Geometry& geometry)
+    {
+        traits::emplace_back<GeometryCollection>::apply(geometry_collection, std::move(geometry));
+    }
+};
+
+// Reads a geometry of the type of the header, one of the types of a
+// dynamic geometry or of a geometry collection
+template
+<
+    typename Geometry,
+    template <typename, typename> class ReadTwkb,
+    typename AppendPolicy
+>
+struct dynamic_read_caller
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, header const& h, Geometry& geometry)
+    {
+        switch (h.type)
+        {
+            case point_type :
+                return read<util::is_point>(decoder, h, geometry);
+            case linestring_type :
+                return read<util::is_linestring>(decoder, h, geometry);
+            case polygon_type :
+                return read<util::is_polygon>(decoder, h, geometry)
+                    || read<util::is_ring>(decoder, h, geometry);
+            case multi_point_type :
+                return read<util::is_multi_point>(decoder, h, geometry);
+            case multi_linestring_type :
+                return read<util::is_multi_linestring>(decoder, h, geometry);
+            case multi_polygon_type :
+                return read<util::is_multi_polygon>(decoder, h, geometry);
+            case geometry_collection_type :
+                return read<util::is_geometry_collection>(decoder, h, geometry);
+        }
+        return false;
+    }
+
+private:
+    template
+    <
+        template <typename> class UnaryPred,
+        typename Decoder,
+        typename Geom = typename util::sequence_find_if
+            <
+                typename traits::geometry_types<Geometry>::type, UnaryPred
+            >::type,
+        std::enable_if_t<! std::is_void<Geom>::value, int> = 0
+    >
+    static inline bool read(Decoder& decoder, header const& h, Geometry& geometry)
+    {
+        Geom g;
+        if (! ReadTwkb<Geom, typename tag<Geom>::type>::apply(decoder, h, g))
+        {
+            return false;
+        }
+        AppendPolicy::apply(geometry, g);
+        return true;
+    }
+
+    template
+    <
+        template <typename> class UnaryPred,
+        typename Decoder,
+        typename Geom = typename util::sequence_find_if
+            <
+                typename traits::geometry_types<Geometry>::type, UnaryPred
+            >::type,
+        std::enable_if_t<std::is_void<Geom>::value, int> = 0
+    >
+    static inline bool read(Decoder&, header const&, Geometry&)
+    {
+        return false;
+    }
+};
+
+
+}} // namespace detail::twkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct read_twkb : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct read_twkb<Point, point_tag>
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, detail::twkb::header const& h,
+                             Point& point)
+    {
+        return h.type == detail::twkb::point_type
+            && ! h.empty
+            && decoder.get_point(point);
+    }
+};
+
+template <typename Linestring>
+struct read_twkb<Linestring, linestring_tag>
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, detail::twkb::header const& h,
+                             Linestring& linestring)
+    {
+        if (h.type != detail::twkb::linestring_type)
+        {
+            return false;
+        }
+        if (h.empty)
+        {
+            range::clear(linestring);
+            return true;
+        }
+        return detail::twkb::get_points<false>(decoder, linestring);
+    }
+};
+
+template <typename Segment>
+struct read_twkb<Segment, segment_tag>
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, detail::twkb::header const& h,
+                             Segment& segment)
+    {
+        typename geometry::point_type<Segment>::type p0, p1;
+        std::size_t count = 0;
+        if (h.type != detail::twkb::linestring_type
+            || h.empty
+            || ! decoder.get_count(count)
+            || count != 2
+            || ! decoder.get_point(p0)
+            || ! decoder.get_point(p1))
+        {
+            return false;
+        }
+        geometry::detail::assign_point_to_index<0>(p0, segment);
+        geometry::detail::assign_point_to_index<1>(p1, segment);
+        return true;
+    }
+};
+
+template <typename Ring>
+struct read_twkb<Ring, ring_tag>
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, detail::twkb::header const& h,
+                             Ring& ring)
+    {
+        std::size_t count = 0;
+        if (h.type != detail::twkb::polygon_type)
+        {
+            return false;
+        }
+        if (h.empty)
+        {
+            range::clear(ring);
+            return true;
+        }
+        return decoder.get_count(count)
+            && count == 1
+            && detail::twkb::get_points<true>(decoder, ring);
+    }
+};
+
+// The box of the points of a polygon
+template <typename Box>
+struct read_twkb<Box, box_tag>
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, detail::twkb::header const& h,
+                             Box& box)
+    {
+        typedef typename geometry::point_type<Box>::type point_type;
+
+        std::size_t ring_count = 0, count = 0;
+        if (h.type != detail::twkb::polygon_type
+            || h.empty
+            || ! decoder.get_count(ring_count)
+            || ring_count < 1
+            || ! decoder.get_count(count)
+            || count < 1)
+        {
+            return false;
+        }
+
+        boost::int64_t values[detail::twkb::max_dimension];
+        boost::int64_t min[detail::twkb::max_dimension];
+        boost::int64_t max[detail::twkb::max_dimension];
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (! decoder.get_values(values))
+            {
+                return false;
+            }
+            for (std::size_t d = 0; d < detail::twkb::max_dimension - 1; ++d)
+            {
+                min[d] = i == 0 ? values[d] : (std::min)(min[d], values[d]);
+                max[d] = i == 0 ? values[d] : (std::max)(max[d], values[d]);
+            }
+        }
+
+        // The interior rings are inside the exterior ring
+        point_type p;
+        for (std::size_t r = 1; r < ring_count; ++r)
+        {
+            if (! decoder.get_count(count))
+            {
+                return false;
+            }
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (! decoder.get_point(p))
+                {
+                    return false;
+                }
+            }
+        }
+
+        detail::twkb::coordinates<point_type>::assign(p, decoder.scales(), min);
+        geometry::detail::assign_point_to_index<min_corner>(p, box);
+        detail::twkb::coordinates<point_type>::assign(p, decoder.scales(), max);
+        geometry::detail::assign_point_to_index<max_corner>(p, box);
+        return true;
+    }
+};
+
+template <typename Polygon>
+struct read_twkb<Polygon, polygon_tag>
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, detail::twkb::header const& h,
+                             Polygon& polygon)
+    {
+        if (h.type != detail::twkb::polygon_type)
+        {
+            return false;
+        }
+        if (h.empty)
+        {
+            range::clear(exterior_ring(polygon));
+            range::clear(interior_rings(polygon));
+            return true;
+        }
+        return detail::twkb::get_rings(decoder, polygon);
+    }
+};
+
+template <typename MultiPoint>
+struct read_twkb<MultiPoint, multi_point_tag>
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, detail::twkb::header const& h,
+                             MultiPoint& multi_point)
+    {
+        if (h.type != detail::twkb::multi_point_type)
+        {
+            return false;
+        }
+        if (h.empty)
+        {
+            range::clear(multi_point);
+            return true;
+        }
+        return detail::twkb::get_elements(decoder, multi_point,
+            [](Decoder& d, auto& point) { return d.get_point(point); });
+    }
+};
+
+template <typename MultiLinestring>
+struct read_twkb<MultiLinestring, multi_linestring_tag>
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, detail::twkb::header const& h,
+                             MultiLinestring& multi_linestring)
+    {
+        if (h.type != detail::twkb::multi_linestring_type)
+        {
+            return false;
+        }
+        if (h.empty)
+        {
+            range::clear(multi_linestring);
+            return true;
+        }
+        return detail::twkb::get_elements(decoder, multi_linestring,
+            [](Decoder& d, auto& linestring)
+            {
+                return detail::twkb::get_points<false>(d, linestring);
+            });
+    }
+};
+
+template <typename MultiPolygon>
+struct read_twkb<MultiPolygon, multi_polygon_tag>
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, detail::twkb::header const& h,
+                             MultiPolygon& multi_polygon)
+    {
+        if (h.type != detail::twkb::multi_polygon_type)
+        {
+            return false;
+        }
+        if (h.empty)
+        {
+            range::clear(multi_polygon);
+            return true;
+        }
+        return detail::twkb::get_elements(decoder, multi_polygon,
+            [](Decoder& d, auto& polygon)
+            {
+                return detail::twkb::get_rings(d, polygon);
+            });
+    }
+};
+
+template <typename DynamicGeometry>
+struct read_twkb<DynamicGeometry, dynamic_geometry_tag>
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, detail::twkb::header const& h,
+                             DynamicGeometry& dynamic_geometry)
+    {
+        return detail::twkb::dynamic_read_caller
+            <
+                DynamicGeometry, dispatch::read_twkb,
+                detail::twkb::dynamic_move_assign
+            >::apply(decoder, h, dynamic_geometry);
+    }
+};
+
+// The geometries of a collection have their own headers
+template <typename GeometryCollection>
+struct read_twkb<GeometryCollection, geometry_collection_tag>
+{
+    template <typename Decoder>
+    static inline bool apply(Decoder& decoder, detail::twkb::header const& h,
+                             GeometryCollection& geometry_collection)
+    {
+        if (h.type != detail::twkb::geometry_collection_type)
+        {
+            return false;
+        }
+        range::clear(geometry_collection);
+
+        std::size_t count = 0;
+        if (h.empty)
+        {
+            return true;
+        }
+        if (! decoder.get_count(count) || ! decoder.skip_ids(count))
+        {
+            return false;
+        }
+
+        detail::twkb::header member;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (! decoder.get_header(member)
+                || ! detail::twkb::dynamic_read_caller
+                    <
+                        GeometryCollection, dispatch::read_twkb,
+                        detail::twkb::dynamic_move_emplace_back
+                    >::apply(decoder, member, geometry_collection))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Reads a geometry from Tiny Well-Known Binary (TWKB)
+\details The points are decoded in place, without allocations besides
+    the ones resizing the ranges of the geometry. Bounding boxes, sizes
+    and identifiers of the input are skipped, m values are discarded.
+\tparam Iterator random access iterator of bytes
+\tparam Geometry \tparam_geometry
+\param begin iterator to the first byte
+\param end iterator past the last byte
+\param geometry \param_geometry output geometry
+\return false for invalid input and for a geometry not matching the type
+    of the output geometry
+*/
+template <typename Iterator, typename Geometry>
+inline bool read_twkb(Iterator begin, Iterator end, Geometry& geometry)
+{
+    concepts::check<Geometry>();
+
+    // The counts are checked against the distance to the end
+    BOOST_STATIC_ASSERT((
+        std::is_convertible
+        <
+            typename std::iterator_traits<Iterator>::iterator_category,
+            const std::random_access_iterator_tag&
+        >::value));
+
+    detail::twkb::decoder<Iterator> decoder(begin, end);
+    detail::twkb::header h;
+    return decoder.get_header(h)
+        && dispatch::read_twkb<Geometry>::apply(decoder, h, geometry);
+}
+
+template <typename ByteType, typename Geometry>
+inline bool read_twkb(ByteType const* bytes, std::size_t length, Geometry& geometry)
+{
+    BOOST_STATIC_ASSERT((std::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+
+    return read_twkb(bytes, bytes + length, geometry);
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_TWKB_READ_TWKB_HPP
@@ -0,0 +1,636 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_TWKB_WRITE_TWKB_HPP
+#define BOOST_GEOMETRY_IO_TWKB_WRITE_TWKB_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/empty.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/exception.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/core/visit.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/util/type_traits.hpp>
+
+#include <boost/geometry/extensions/gis/io/twkb/detail/codec.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Parameters of the TWKB encoding
+\details The coordinates are rounded to the number of decimal digits of
+    their precision. Collections do not have a bounding box of their own,
+    the bounding box is written for each geometry of the collection.
+*/
+struct twkb_options
+{
+    explicit twkb_options(int precision = 0)
+        : xy_precision(precision)
+        , z_precision(precision > 0 ? precision : 0)
+        , bbox(false)
+        , size(false)
+    {}
+
+    //! The precision of x and y, in [-8, 7]
+    int xy_precision;
+    //! The precision of z, in [0, 7]
+    int z_precision;
+    //! Writes the bounding box of the geometry
+    bool bbox;
+    //! Writes the size of the geometry in bytes, allowing to skip it
+    bool size;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace twkb
+{
+
+
+template <typename OutputIterator>
+inline void put_unsigned(OutputIterator& out, boost::uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        *out++ = static_cast<boost::uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = static_cast<boost::uint8_t>(value);
+}
+
+
+// Writes the counts and the points of a geometry, the points as the
+// differences to the previous point
+template <typename OutputIterator>
+class encoder
+{
+public:
+    encoder(OutputIterator out, scale const* scales)
+        : m_out(out)
+        , m_scales(scales)
+    {
+        std::fill(m_last, m_last + max_dimension, boost::int64_t(0));
+    }
+
+    inline void put_count(std::size_t count)
+    {
+        put_unsigned(m_out, count);
+    }
+
+    template <typename Point>
+    inline void put_point(Point const& point)
+    {
+        boost::int64_t values[max_dimension];
+        coordinates<Point>::quantize(point, m_scales, values);
+        for (std::size_t i = 0; i < point_dimension<Point>::value; ++i)
+        {
+            put_unsigned(m_out, zigzag_encode(values[i] - m_last[i]));
+            m_last[i] = values[i];
+        }
+    }
+
+    inline OutputIterator iterator() const
+    {
+        return m_out;
+    }
+
+private:
+    OutputIterator m_out;
+    scale const* m_scales;
+    boost::int64_t m_last[max_dimension];
+};
+
+// Collects the bounding box of the points of a geometry, as an encoder
+class bbox_collector
+{
+public:
+    explicit bbox_collector(scale const* scales)
+        : m_scales(scales)
+        , m_empty(true)
+    {}
+
+    inline void put_count(std::size_t)
+    {}
+
+    template <typename Point>
+    inline void put_point(Point const& point)
+    {
+        boost::int64_t values[max_dimension];
+        coordinates<Point>::quantize(point, m_scales, values);
+        for (std::size_t i = 0; i < point_dimension<Point>::value; ++i)
+        {
+            if (m_empty || values[i] < m_min[i])
+            {
+                m_min[i] = values[i];
+            }
+            if (m_empty || values[i] > m_max[i])
+            {
+                m_max[i] = values[i];
+            }
+        }
+        m_empty = false;
+    }
+
+    template <typename OutputIterator>
+    inline void write(OutputIterator& out, std::size_t dimension) const
+    {
+        for (std::size_t i = 0; i < dimension; ++i)
+        {
+            put_unsigned(out, zigzag_encode(m_empty ? 0 : m_min[i]));
+            put_unsigned(out, zigzag_encode(m_empty ? 0 : m_max[i] - m_min[i]));
+        }
+    }
+
+private:
+    scale const* m_scales;
+    bool m_empty;
+    boost::int64_t m_min[max_dimension];
+    boost::int64_t m_max[max_dimension];
+};
+
+
+// The rings of TWKB are closed, the first point of open rings is repeated
+template <bool Close, typename Encoder, typename Range>
+inline void put_points(Encoder& encoder, Range const& range)
+{
+    bool const close = Close
+                    && geometry::closure<Range>::value == open
+                    && ! boost::empty(range);
+    encoder.put_count(boost::size(range) + (close ? 1 : 0));
+    auto const end = boost::end(range);
+    for (auto it = boost::begin(range); it != end; ++it)
+    {
+        encoder.put_point(*it);
+    }
+    if (close)
+    {
+        encoder.put_point(*boost::begin(range));
+    }
+}
+
+template <typename Encoder, typename Polygon>
+inline void put_rings(Encoder& encoder, Polygon const& polygon)
+{
+    auto const& rings = interior_rings(polygon);
+    encoder.put_count(1 + boost::size(rings));
+    put_points<true>(encoder, exterior_ring(polygon));
+    for (auto const& ring : rings)
+    {
+        put_points<true>(encoder, ring);
+    }
+}
+
+
+struct point_policy
+{
+    static const geometry_type type = point_type;
+
+    template <typename Point>
+    static inline bool is_empty(Point const&)
+    {
+        return false;
+    }
+
+    template <typename Encoder, typename Point>
+    static inline void apply(Encoder& encoder, Point const& point)
+    {
+        encoder.put_point(point);
+    }
+};
+
+struct linestring_policy
+{
+    static const geometry_type type = linestring_type;
+
+    template <typename Linestring>
+    static inline bool is_empty(Linestring const& linestring)
+    {
+        return boost::empty(linestring);
+    }
+
+    template <typename Encoder, typename Linestring>
+    static inline void apply(Encoder& encoder, Linestring const& linestring)
+    {
+        put_points<false>(encoder, linestring);
+    }
+};
+
+struct segment_policy
+{
+    static const geometry_type type = linestring_type;
+
+    template <typename Segment>
+    static inline bool is_empty(Segment const&)
+    {
+        return false;
+    }
+
+    template <typename Encoder, typename Segment>
+    static inline void apply(Encoder& encoder, Segment const& segment)
+    {
+        typename geometry::point_type<Segment>::type p0, p1;
+        geometry::detail::assign_point_from_index<0>(segment, p0);
+        geometry::detail::assign_point_from_index<1>(segment, p1);
+        encoder.put_count(2);
+        encoder.put_point(p0);
+        encoder.put_point(p1);
+    }
+};
+
+// A polygon with one ring
+struct ring_policy
+{
+    static const geometry_type type = polygon_type;
+
+    template <typename Ring>
+    static inline bool is_empty(Ring const& ring)
+    {
+        return boost::empty(ring);
+    }
+
+    template <typename Encoder, typename Ring>
+    static inline void apply(Encoder& encoder, Ring const& ring)
+    {
+        encoder.put_count(1);
+        put_points<true>(encoder, ring);
+    }
+};
+
+// A polygon with the counterclockwise ring of the corners
+struct box_policy
+{
+    static const geometry_type type = polygon_type;
+
+    template <typename Box>
+    static inline bool is_empty(Box const&)
+    {
+        return false;
+    }
+
+    template <typename Encoder, typename Box>
+    static inline void apply(Encoder& encoder, Box const& box)
+    {
+        typename geometry::point_type<Box>::type p0, p1;
+        geometry::detail::assign_point_from_index<min_corner>(box, p0);
+        geometry::detail::assign_point_from_index<max_corner>(box, p1);
+        auto corner = [&](auto const& x, auto const& y)
+        {
+            auto p = p0;
+            geometry::set<0>(p, x);
+            geometry::set<1>(p, y);
+            return p;
+        };
+
+        encoder.put_count(1);
+        encoder.put_count(5);
+        encoder.put_point(p0);
+        encoder.put_point(corner(geometry::get<0>(p1), geometry::get<1>(p0)));
+        encoder.put_point(corner(geometry::get<0>(p1), geometry::get<1>(p1)));
+        encoder.put_point(corner(geometry::get<0>(p0), geometry::get<1>(p1)));
+        encoder.put_point(p0);
+    }
+};
+
+struct polygon_policy
+{
+    static const geometry_type type = polygon_type;
+
+    template <typename Polygon>
+    static inline bool is_empty(Polygon const& polygon)
+    {
+        return boost::empty(exterior_ring(polygon))
+            && boost::empty(interior_rings(polygon));
+    }
+
+    template <typename Encoder, typename Polygon>
+    static inline void apply(Encoder& encoder, Polygon const& polygon)
+    {
+        put_rings(encoder, polygon);
+    }
+};
+
+struct multi_point_policy
+{
+    static const geometry_type type = multi_point_type;
+
+    template <typename MultiPoint>
+    static inline bool is_empty(MultiPoint const& multi_point)
+    {
+        return boost::empty(multi_point);
+    }
+
+    template <typename Encoder, typename MultiPoint>
+    static inline void apply(Encoder& encoder, MultiPoint const& multi_point)
+    {
+        put_points<false>(encoder, multi_point);
+    }
+};
+
+struct multi_linestring_policy
+{
+    static const geometry_type type = multi_linestring_type;
+
+    template <typename MultiLinestring>
+    static inline bool is_empty(MultiLinestring const& multi_linestring)
+    {
+        return boost::empty(multi_linestring);
+    }
+
+    template <typename Encoder, typename MultiLinestring>
+    static inline void apply(Encoder& encoder, MultiLinestring const& multi_linestring)
+    {
+        encoder.put_count(boost::size(multi_linestring));
+        for (auto const& linestring : multi_linestring)
+        {
+            put_points<false>(encoder, linestring);
+        }
+    }
+};
+
+struct multi_polygon_policy
+{
+    static const geometry_type type = multi_polygon_type;
+
+    template <typename MultiPolygon>
+    static inline bool is_empty(MultiPolygon const& multi_polygon)
+    {
+        return boost::empty(multi_polygon);
+    }
+
+    template <typename Encoder, typename MultiPolygon>
+    static inline void apply(Encoder& encoder, MultiPolygon const& multi_polygon)
+    {
+        encoder.put_count(boost::size(multi_polygon));
+        for (auto const& polygon : multi_polygon)
+        {
+            put_rings(encoder, polygon);
+        }
+    }
+};
+
+
+inline void check_options(twkb_options const& options)
+{
+    if (options.xy_precision < -8 || options.xy_precision > 7
+        || options.z_precision < 0 || options.z_precision > 7)
+    {
+        BOOST_THROW_EXCEPTION(invalid_input_exception());
+    }
+}
+
+template <typename OutputIterator>
+inline void put_header(OutputIterator& out, geometry_type type,
+                       twkb_options const& options, std::size_t dimension,
+                       bool empty)
+{
+    *out++ = static_cast<boost::uint8_t>(
+        type | (zigzag_encode(options.xy_precision) << 4));
+
+    int metadata = empty ? empty_flag : 0;
+    if (options.bbox && ! empty && type != geometry_collection_type)
+    {
+        metadata |= bbox_flag;
+    }
+    if (options.size)
+    {
+        metadata |= size_flag;
+    }
+    if (dimension > 2)
+    {
+        metadata |= extended_precision_flag;
+    }
+    *out++ = static_cast<boost::uint8_t>(metadata);
+
+    if (dimension > 2)
+    {
+        *out++ = static_cast<boost::uint8_t>(z_flag | (options.z_precision << 2));
+    }
+}
+
+// Writes the contents following the header, preceded by their size if
+// requested
+template <typename OutputIterator, typename Function>
+inline OutputIterator put_contents(OutputIterator out, twkb_options const& options,
+                                   Function const& function)
+{
+    if (! options.size)
+    {
+        return function(out);
+    }
+
+    std::vector<boost::uint8_t> contents;
+    function(std::back_inserter(contents));
+    put_unsigned(out, contents.size());
+    return std::copy(contents.begin(), contents.end(), out);
+}
+
+template <typename Geometry, typename Policy>
+struct geometry_writer
+{
+    template <typename OutputIterator>
+    static inline OutputIterator apply(Geometry const& geometry, OutputIterator out,
+                                       twkb_options const& options)
+    {
+        typedef typename geometry::point_type<Geometry>::type point_type;
+        static const std::size_t dimension = point_dimension<point_type>::value;
+
+        check_options(options);
+        scale const scales[max_dimension] = { scale(options.xy_precision),
+                                              scale(options.xy_precision),
+                                              scale(options.z_precision),
+                                              scale(0) };
+
+        bool const empty = Policy::is_empty(geometry);
+        put_header(out, Policy::type, options, dimension, empty);
+        if (empty && ! options.size)
+        {
+            return out;
+        }
+
+        return put_contents(out, options, [&](auto it)
+        {
+            if (empty)
+            {
+                return it;
+            }
+            if (options.bbox)
+            {
+                bbox_collector collector(scales);
+                Policy::apply(collector, geometry);
+                collector.write(it, dimension);
+            }
+            encoder<decltype(it)> e(it, scales);
+            Policy::apply(e, geometry);
+            return e.iterator();
+        });
+    }
+};
+
+
+}} // namespace detail::twkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct write_twkb : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct write_twkb<Point, point_tag>
+    : detail::twkb::geometry_writer<Point, detail::twkb::point_policy>
+{};
+
+template <typename Linestring>
+struct write_twkb<Linestring, linestring_tag>
+    : detail::twkb::geometry_writer<Linestring, detail::twkb::linestring_policy>
+{};
+
+template <typename Segment>
+struct write_twkb<Segment, segment_tag>
+    : detail::twkb::geometry_writer<Segment, detail::twkb::segment_policy>
+{};
+
+template <typename Ring>
+struct write_twkb<Ring, ring_tag>
+    : detail::twkb::geometry_writer<Ring, detail::twkb::ring_policy>
+{};
+
+template <typename Box>
+struct write_twkb<Box, box_tag>
+    : detail::twkb::geometry_writer<Box, detail::twkb::box_policy>
+{};
+
+template <typename Polygon>
+struct write_twkb<Polygon, polygon_tag>
+    : detail::twkb::geometry_writer<Polygon, detail::twkb::polygon_policy>
+{};
+
+template <typename MultiPoint>
+struct write_twkb<MultiPoint, multi_point_tag>
+    : detail::twkb::geometry_writer<MultiPoint, detail::twkb::multi_point_policy>
+{};
+
+template <typename MultiLinestring>
+struct write_twkb<MultiLinestring, multi_linestring_tag>
+    : detail::twkb::geometry_writer<MultiLinestring, detail::twkb::multi_linestring_policy>
+{};
+
+template <typename MultiPolygon>
+struct write_twkb<MultiPolygon, multi_polygon_tag>
+    : detail::twkb::geometry_writer<MultiPolygon, detail::twkb::multi_polygon_policy>
+{};
+
+template <typename Geometry>
+struct write_twkb<Geometry, dynamic_geometry_tag>
+{
+    template <typename OutputIterator>
+    static inline OutputIterator apply(Geometry const& geometry, OutputIterator out,
+                                       twkb_options const& options)
+    {
+        traits::visit<Geometry>::apply([&](auto const& g)
+        {
+            out = write_twkb<util::remove_cref_t<decltype(g)>>::apply(g, out, options);
+        }, geometry);
+        return out;
+    }
+};
+
+// The geometries of a collection are written with their own headers
+template <typename Geometry>
+struct write_twkb<Geometry, geometry_collection_tag>
+{
+    template <typename OutputIterator>
+    static inline OutputIterator apply(Geometry const& geometry, OutputIterator out,
+                                       twkb_options const& options)
+    {
+        detail::twkb::check_options(options);
+
+        bool const empty = boost::empty(geometry);
+        detail::twkb::put_header(out, detail::twkb::geometry_collection_type,
+                                 options, 2, empty);
+        if (empty && ! options.size)
+        {
+            return out;
+        }
+
+        return detail::twkb::put_contents(out, options, [&](auto it)
+        {
+            if (empty)
+            {
+                return it;
+            }
+            detail::twkb::put_unsigned(it, boost::size(geometry));
+            auto const end = boost::end(geometry);
+            for (auto git = boost::begin(geometry); git != end; ++git)
+            {
+                traits::iter_visit<Geometry>::apply([&](auto const& g)
+                {
+                    it = write_twkb<util::remove_cref_t<decltype(g)>>::apply(g, it, options);
+                }, git);
+            }
+            return it;
+        });
+    }
+};
+
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Writes a geometry as Tiny Well-Known Binary (TWKB)
+\details The coordinates are rounded to the precision of the options and
+    encoded as variable length integers, differences to the previous point
+    of the geometry.
+\tparam Geometry \tparam_geometry
+\tparam OutputIterator output iterator of bytes
+\param geometry \param_geometry
+\param out output iterator the bytes are written to
+\param options the precision and the optional contents
+\return Output iterator past the last written byte
+\note invalid_input_exception is thrown for precisions out of range,
+    and for coordinates which are not finite or too large to be stored
+    with the precision
+*/
+template <typename Geometry, typename OutputIterator>
+inline OutputIterator write_twkb(Geometry const& geometry, OutputIterator out,
+                                 twkb_options const& options = twkb_options())
+{
+    concepts::check<Geometry const>();
+
+    return dispatch::write_twkb<Geometry>::apply(geometry, out, options);
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_TWKB_WRITE_TWKB_HPP
@@ -0,0 +1,181 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_WKB_SIZE_HPP
+#define BOOST_GEOMETRY_IO_WKB_WKB_SIZE_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/extensions/gis/io/wkb/detail/endian.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/detail/ogc.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+typedef unsigned char byte_type;
+
+static const byte_order_type::enum_t native_byte_order
+    = std::is_same
+        <
+            endian::native_endian_tag, endian::little_endian_tag
+        >::value ? byte_order_type::ndr : byte_order_type::xdr;
+
+template <typename Point>
+struct point_size
+{
+    // Coordinates in WKB are always doubles
+    static const std::size_t value = dimension<Point>::value * sizeof(double);
+};
+
+static const std::size_t header_size = sizeof(boost::uint8_t) + sizeof(boost::uint32_t);
+
+static const std::size_t count_size = sizeof(boost::uint32_t);
+
+template <typename Range>
+inline std::size_t points_size(Range const& range)
+{
+    typedef typename geometry::point_type<Range>::type point_type;
+    return count_size + boost::size(range) * point_size<point_type>::value;
+}
+
+template <typename Polygon>
+inline std::size_t rings_size(Polygon const& polygon)
+{
+    std::size_t result = count_size + points_size(exterior_ring(polygon));
+    auto const& rings = interior_rings(polygon);
+    for (auto it = boost::begin(rings); it != boost::end(rings); ++it)
+    {
+        result += points_size(*it);
+    }
+    return result;
+}
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Tag, typename Geometry>
+struct wkb_size : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct wkb_size<point_tag, Point>
+{
+    static inline std::size_t apply(Point const&)
+    {
+        return detail::wkb::header_size + detail::wkb::point_size<Point>::value;
+    }
+};
+
+template <typename Linestring>
+struct wkb_size<linestring_tag, Linestring>
+{
+    static inline std::size_t apply(Linestring const& linestring)
+    {
+        return detail::wkb::header_size + detail::wkb::points_size(linestring);
+    }
+};
+
+template <typename Polygon>
+struct wkb_size<polygon_tag, Polygon>
+{
+    static inline std::size_t apply(Polygon const& polygon)
+    {
+        return detail::wkb::header_size + detail::wkb::rings_size(polygon);
+    }
+};
+
+template <typename MultiPoint>
+struct wkb_size<multi_point_tag, MultiPoint>
+{
+    static inline std::size_t apply(MultiPoint const& multi_point)
+    {
+        typedef typename geometry::point_type<MultiPoint>::type point_type;
+        return detail::wkb::header_size + detail::wkb::count_size
+            + boost::size(multi_point)
+                * (detail::wkb::header_size + detail::wkb::point_size<point_type>::value);
+    }
+};
+
+template <typename MultiLinestring>
+struct wkb_size<multi_linestring_tag, MultiLinestring>
+{
+    static inline std::size_t apply(MultiLinestring const& multi_linestring)
+    {
+        std::size_t result = detail::wkb::header_size + detail::wkb::count_size;
+        for (auto it = boost::begin(multi_linestring); it != boost::end(multi_linestring); ++it)
+        {
+            result += detail::wkb::header_size + detail::wkb::points_size(*it);
+        }
+        return result;
+    }
+};
+
+template <typename MultiPolygon>
+struct wkb_size<multi_polygon_tag, MultiPolygon>
+{
+    static inline std::size_t apply(MultiPolygon const& multi_polygon)
+    {
+        std::size_t result = detail::wkb::header_size + detail::wkb::count_size;
+        for (auto it = boost::begin(multi_polygon); it != boost::end(multi_polygon); ++it)
+        {
+            result += detail::wkb::header_size + detail::wkb::rings_size(*it);
+        }
+        return result;
+    }
+};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Returns the number of bytes of the WKB of a geometry
+\details The size is computed from the numbers of points, without
+    writing the WKB. It is the size of the WKB written by write_wkb.
+\tparam Geometry \tparam_geometry
+\param geometry \param_geometry
+\return The size of the WKB in bytes
+*/
+template <typename Geometry>
+inline std::size_t wkb_size(Geometry const& geometry)
+{
+    concepts::check<Geometry const>();
+
+    return dispatch::wkb_size
+        <
+            typename tag<Geometry>::type, Geometry
+        >::apply(geometry);
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_WKB_SIZE_HPP
@@ -0,0 +1,767 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_WKB_VIEW_HPP
+#define BOOST_GEOMETRY_IO_WKB_WKB_VIEW_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_system.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/extensions/gis/io/wkb/detail/endian.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/detail/ogc.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/detail/parser.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/wkb_size.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Loads a value from the bytes, values in the native byte order are copied
+template <typename T>
+inline T load(byte_type const* bytes, byte_order_type::enum_t order)
+{
+    T value;
+    if (order == native_byte_order)
+    {
+        std::memcpy(&value, bytes, sizeof(T));
+    }
+    else
+    {
+        byte_type swapped[sizeof(T)];
+        std::reverse_copy(bytes, bytes + sizeof(T), swapped);
+        std::memcpy(&value, swapped, sizeof(T));
+    }
+    return value;
+}
+
+inline byte_order_type::enum_t byte_order(byte_type const* bytes)
+{
+    return byte_order_type::enum_t(*bytes);
+}
+
+// Checks the byte order and the type of a geometry and skips its header
+inline byte_order_type::enum_t check_header(byte_type const*& it,
+                                            byte_type const* end,
+                                            boost::uint32_t type)
+{
+    if (end - it < std::ptrdiff_t(header_size)
+        || *it > byte_order_type::ndr)
+    {
+        throw read_wkb_exception();
+    }
+    byte_order_type::enum_t const order = byte_order(it);
+    if (load<boost::uint32_t>(it + 1, order) != type)
+    {
+        throw read_wkb_exception();
+    }
+    it += header_size;
+    return order;
+}
+
+inline boost::uint32_t check_count(byte_type const*& it, byte_type const* end,
+                                   byte_order_type::enum_t order)
+{
+    if (end - it < std::ptrdiff_t(sizeof(boost::uint32_t)))
+    {
+        throw read_wkb_exception();
+    }
+    boost::uint32_t const count = load<boost::uint32_t>(it, order);
+    it += sizeof(boost::uint32_t);
+    return count;
+}
+
+inline void check_size(byte_type const*& it, byte_type const* end,
+                       boost::uint32_t count, std::size_t size)
+{
+    if (std::size_t(end - it) / size < count)
+    {
+        throw read_wkb_exception();
+    }
+    it += count * size;
+}
+
+template <typename Point, std::size_t Dimension, std::size_t DimensionCount>
+struct assign_point
+{
+    static inline void apply(Point& point, byte_type const* data,
+                             byte_order_type::enum_t order)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+        set<Dimension>(point, static_cast<coordinate_type>(
+            load<double>(data + Dimension * sizeof(double), order)));
+        assign_point<Point, Dimension + 1, DimensionCount>::apply(point, data, order);
+    }
+};
+
+template <typename Point, std::size_t DimensionCount>
+struct assign_point<Point, DimensionCount, DimensionCount>
+{
+    static inline void apply(Point&, byte_type const*, byte_order_type::enum_t)
+    {}
+};
+
+template <typename Point>
+inline Point load_point(byte_type const* data, byte_order_type::enum_t order)
+{
+    Point point;
+    assign_point<Point, 0, dimension<Point>::value>::apply(point, data, order);
+    return point;
+}
+
+// Checks a number of points followed by their coordinates, and decodes them
+template <typename Point>
+inline void check_points(byte_type const*& it, byte_type const* end,
+                         byte_order_type::enum_t order,
+                         std::vector<Point>& points,
+                         std::vector<std::size_t>& counts)
+{
+    boost::uint32_t const count = check_count(it, end, order);
+    byte_type const* data = it;
+    check_size(it, end, count, point_size<Point>::value);
+    for (; data != it; data += point_size<Point>::value)
+    {
+        points.push_back(load_point<Point>(data, order));
+    }
+    counts.push_back(count);
+}
+
+template <typename Point>
+inline void check_polygon(byte_type const*& it, byte_type const* end,
+                          std::vector<Point>& points,
+                          std::vector<std::size_t>& counts)
+{
+    byte_order_type::enum_t const order = check_header(it, end,
+        geometry_type_impl<Point, geometry_type_ogc::polygon>::get());
+    boost::uint32_t const count = check_count(it, end, order);
+    counts.push_back(count);
+    for (boost::uint32_t i = 0; i < count; ++i)
+    {
+        check_points<Point>(it, end, order, points, counts);
+    }
+}
+
+template <typename ByteType>
+inline byte_type const* as_bytes(ByteType const* bytes)
+{
+    BOOST_STATIC_ASSERT((std::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+    return reinterpret_cast<byte_type const*>(bytes);
+}
+
+// Throws if the bytes are not consumed by a check
+inline void check_end(byte_type const* it, byte_type const* end)
+{
+    if (it != end)
+    {
+        throw read_wkb_exception();
+    }
+}
+
+
+// Checks the bytes of a geometry and decodes all its points at once. The
+// counts of points, rings and geometries are listed in the order in which
+// the views are built.
+template <typename Geometry, typename Point>
+inline std::shared_ptr<std::vector<Point> const> decode(byte_type const* bytes,
+                                                        std::size_t length,
+                                                        std::vector<std::size_t>& counts)
+{
+    std::shared_ptr<std::vector<Point> > points
+        = std::make_shared<std::vector<Point> >();
+    points->reserve(length / point_size<Point>::value);
+    byte_type const* it = bytes;
+    Geometry::check(it, bytes + length, *points, counts);
+    check_end(it, bytes + length);
+    return points;
+}
+
+
+// Range of decoded points
+template <typename Point>
+class point_range
+{
+public:
+    typedef Point const* iterator;
+    typedef Point const* const_iterator;
+
+    inline const_iterator begin() const { return m_points; }
+    inline const_iterator end() const { return m_points + m_size; }
+
+    inline std::size_t size() const { return m_size; }
+    inline bool empty() const { return m_size == 0; }
+
+protected:
+    point_range()
+        : m_points(nullptr)
+        , m_size(0)
+    {}
+
+    // Takes the next count of points
+    inline void assign(Point const*& points, std::size_t const*& counts)
+    {
+        m_points = points;
+        m_size = *counts++;
+        points += m_size;
+    }
+
+private:
+    Point const* m_points;
+    std::size_t m_size;
+};
+
+// Range of the views of the geometries of a multi geometry, or of the
+// interior rings of a polygon, stored to be accessed by reference
+template <typename Element>
+class element_range
+{
+public:
+    typedef typename std::vector<Element>::const_iterator iterator;
+    typedef typename std::vector<Element>::const_iterator const_iterator;
+
+    inline const_iterator begin() const { return m_elements.begin(); }
+    inline const_iterator end() const { return m_elements.end(); }
+
+    inline std::size_t size() const { return m_elements.size(); }
+    inline bool empty() const { return m_elements.empty(); }
+
+    // Builds the elements from the next counts
+    template <typename Point>
+    inline void assign(std::size_t size, Point const*& points,
+                       std::size_t const*& counts)
+    {
+        m_elements.reserve(size);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            m_elements.push_back(Element(points, counts));
+        }
+    }
+
+private:
+    std::vector<Element> m_elements;
+};
+
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Read-only point over a WKB point
+\details The coordinates are decoded when they are accessed
+\tparam Point point type providing the coordinate type, dimension and
+    coordinate system
+\ingroup wkb
+*/
+template <typename Point>
+class wkb_point_view
+{
+public:
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    //! Constructs the view, throws read_wkb_exception if the bytes are no WKB point
+    template <typename ByteType>
+    wkb_point_view(ByteType const* bytes, std::size_t length)
+    {
+        namespace wkb = detail::wkb;
+        wkb::byte_type const* it = wkb::as_bytes(bytes);
+        wkb::byte_type const* const end = it + length;
+        m_order = wkb::check_header(it, end,
+            detail::wkb::geometry_type_impl<Point, detail::wkb::geometry_type_ogc::point>::get());
+        m_data = it;
+        wkb::check_size(it, end, 1, wkb::point_size<Point>::value);
+        wkb::check_end(it, end);
+    }
+
+    template <std::size_t Dimension>
+    inline coordinate_type get() const
+    {
+        return static_cast<coordinate_type>(detail::wkb::load<double>(
+            m_data + Dimension * sizeof(double), m_order));
+    }
+
+private:
+    detail::wkb::byte_type const* m_data;
+    detail::wkb::byte_order_type::enum_t m_order;
+};
+
+/*!
+\brief Read-only linestring over a WKB linestring
+\details The points are decoded once, when the view is constructed, into a
+    buffer shared by the copies of the view. Iterators and references to
+    the points are valid as long as a copy of the view exists.
+\note The view is not zero-copy and the points are not decoded lazily:
+    algorithms such as intersects or centroid keep references to points,
+    which requires them to be stored.
+\tparam Point point type of the decoded points
+\ingroup wkb
+*/
+template <typename Point>
+class wkb_linestring_view : public detail::wkb::point_range<Point>
+{
+    typedef detail::wkb::point_range<Point> base_type;
+
+public:
+    //! Constructs the view, throws read_wkb_exception if the bytes are no WKB linestring
+    template <typename ByteType>
+    wkb_linestring_view(ByteType const* bytes, std::size_t length)
+    {
+        std::vector<std::size_t> counts;
+        m_points = detail::wkb::decode<wkb_linestring_view, Point>(
+            detail::wkb::as_bytes(bytes), length, counts);
+        Point const* points = m_points->data();
+        std::size_t const* count = counts.data();
+        base_type::assign(points, count);
+    }
+
+#ifndef DOXYGEN_NO_DETAIL
+    // Internal, constructs the view of a linestring of a multi linestring
+    wkb_linestring_view(Point const*& points, std::size_t const*& counts)
+    {
+        base_type::assign(points, counts);
+    }
+
+    static inline void check(detail::wkb::byte_type const*& it,
+                             detail::wkb::byte_type const* end,
+                             std::vector<Point>& points,
+                             std::vector<std::size_t>& counts)
+    {
+        detail::wkb::byte_order_type::enum_t const order
+            = detail::wkb::check_header(it, end,
+                detail::wkb::geometry_type_impl<Point, detail::wkb::geometry_type_ogc::linestring>::get());
+        detail::wkb::check_points<Point>(it, end, order, points, counts);
+    }
+#endif
+
+private:
+    // Empty for the linestrings of a multi linestring
+    std::shared_ptr<std::vector<Point> const> m_points;
+};
+
+/*!
+\brief Read-only ring over a ring of a WKB polygon
+\details The ring refers to the points decoded by its polygon. Rings in
+    WKB are closed, their orientation is specified by the ClockWise
+    parameter.
+\tparam Point point type of the decoded points
+\tparam ClockWise true for clockwise exterior rings, false for counterclockwise
+\ingroup wkb
+*/
+template <typename Point, bool ClockWise = true>
+class wkb_ring_view : public detail::wkb::point_range<Point>
+{
+    typedef detail::wkb::point_range<Point> base_type;
+
+public:
+    //! Constructs an empty ring
+    wkb_ring_view()
+    {}
+
+#ifndef DOXYGEN_NO_DETAIL
+    // Internal, constructs the view of a ring of a polygon
+    wkb_ring_view(Point const*& points, std::size_t const*& counts)
+    {
+        base_type::assign(points, counts);
+    }
+#endif
+};
+
+/*!
+\brief Read-only polygon over a WKB polygon
+\details The points of all rings are decoded once, when the view is
+    constructed, into a buffer shared by the copies of the view. The rings
+    are stored in the view and returned by reference.
+\note The view is not zero-copy and the points are not decoded lazily, see
+    wkb_linestring_view.
+\tparam Point point type of the decoded points
+\tparam ClockWise true for clockwise exterior rings, false for counterclockwise
+\ingroup wkb
+*/
+template <typename Point, bool ClockWise = true>
+class wkb_polygon_view
+{
+public:
+    typedef wkb_ring_view<Point, ClockWise> ring_type;
+    typedef detail::wkb::element_range<ring_type> inner_container_type;
+
+    //! Constructs the view, throws read_wkb_exception if the bytes are no WKB polygon
+    template <typename ByteType>
+    wkb_polygon_view(ByteType const* bytes, std::size_t length)
+    {
+        std::vector<std::size_t> counts;
+        m_points = detail::wkb::decode<wkb_polygon_view, Point>(
+            detail::wkb::as_bytes(bytes), length, counts);
+        Point const* points = m_points->data();
+        std::size_t const* count = counts.data();
+        assign(points, count);
+    }
+
+    inline ring_type const& exterior_ring() const
+    {
+        return m_exterior;
+    }
+
+    inline inner_container_type const& interior_rings() const
+    {
+        return m_interiors;
+    }
+
+#ifndef DOXYGEN_NO_DETAIL
+    // Internal, constructs the view of a polygon of a multi polygon
+    wkb_polygon_view(Point const*& points, std::size_t const*& counts)
+    {
+        assign(points, counts);
+    }
+
+    static inline void check(detail::wkb::byte_type const*& it,
+                             detail::wkb::byte_type const* end,
+                             std::vector<Point>& points,
+                             std::vector<std::size_t>& counts)
+    {
+        detail::wkb::check_polygon<Point>(it, end, points, counts);
+    }
+#endif
+
+private:
+    inline void assign(Point const*& points, std::size_t const*& counts)
+    {
+        std::size_t const ring_count = *counts++;
+        if (ring_count > 0)
+        {
+            m_exterior = ring_type(points, counts);
+            m_interiors.assign(ring_count - 1, points, counts);
+        }
+    }
+
+    // Empty for the polygons of a multi polygon
+    std::shared_ptr<std::vector<Point> const> m_points;
+    ring_type m_exterior;
+    inner_container_type m_interiors;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Range of the geometries of a WKB multi geometry, each with its header
+template <typename Element, geometry_type_ogc::enum_t Type, typename Point>
+class multi_range : public element_range<Element>
+{
+    typedef element_range<Element> base_type;
+
+public:
+    template <typename ByteType>
+    multi_range(ByteType const* bytes, std::size_t length)
+    {
+        std::vector<std::size_t> counts;
+        m_points = decode<multi_range, Point>(as_bytes(bytes), length, counts);
+        Point const* points = m_points->data();
+        std::size_t const* count = counts.data();
+        std::size_t const size = *count++;
+        base_type::assign(size, points, count);
+    }
+
+    static inline void check(byte_type const*& it, byte_type const* end,
+                             std::vector<Point>& points,
+                             std::vector<std::size_t>& counts)
+    {
+        byte_order_type::enum_t const order = check_header(it, end,
+            geometry_type_impl<Point, Type>::get());
+        boost::uint32_t const count = check_count(it, end, order);
+        counts.push_back(count);
+        for (boost::uint32_t i = 0; i < count; ++i)
+        {
+            Element::check(it, end, points, counts);
+        }
+    }
+
+private:
+    std::shared_ptr<std::vector<Point> const> m_points;
+};
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Read-only multi point over a WKB multi point
+\details The points are decoded once, when the view is constructed, into a
+    buffer shared by the copies of the view
+\tparam Point point type of the decoded points
+\ingroup wkb
+*/
+template <typename Point>
+class wkb_multi_point_view : public detail::wkb::point_range<Point>
+{
+    typedef detail::wkb::point_range<Point> base_type;
+
+public:
+    //! Constructs the view, throws read_wkb_exception if the bytes are no WKB multi point
+    template <typename ByteType>
+    wkb_multi_point_view(ByteType const* bytes, std::size_t length)
+    {
+        std::vector<std::size_t> counts;
+        m_points = detail::wkb::decode<wkb_multi_point_view, Point>(
+            detail::wkb::as_bytes(bytes), length, counts);
+        Point const* points = m_points->data();
+        std::size_t const* count = counts.data();
+        base_type::assign(points, count);
+    }
+
+#ifndef DOXYGEN_NO_DETAIL
+    static inline void check(detail::wkb::byte_type const*& it,
+                             detail::wkb::byte_type const* end,
+                             std::vector<Point>& points,
+                             std::vector<std::size_t>& counts)
+    {
+        namespace wkb = detail::wkb;
+        typedef wkb::geometry_type_ogc ogc;
+        wkb::byte_order_type::enum_t const order = wkb::check_header(it, end,
+            wkb::geometry_type_impl<Point, ogc::multipoint>::get());
+        boost::uint32_t const count = wkb::check_count(it, end, order);
+        for (boost::uint32_t i = 0; i < count; ++i)
+        {
+            wkb::byte_order_type::enum_t const point_order = wkb::check_header(it, end,
+                wkb::geometry_type_impl<Point, ogc::point>::get());
+            wkb::byte_type const* const data = it;
+            wkb::check_size(it, end, 1, wkb::point_size<Point>::value);
+            points.push_back(wkb::load_point<Point>(data, point_order));
+        }
+        counts.push_back(count);
+    }
+#endif
+
+private:
+    std::shared_ptr<std::vector<Point> const> m_points;
+};
+
+/*!
+\brief Read-only multi linestring over a WKB multi linestring
+\details The points are decoded once, when the view is constructed. The
+    linestrings are stored in the view and returned by reference.
+\tparam Point point type of the decoded points
+\ingroup wkb
+*/
+template <typename Point>
+class wkb_multi_linestring_view
+    : public detail::wkb::multi_range
+        <
+            wkb_linestring_view<Point>,
+            detail::wkb::geometry_type_ogc::multilinestring,
+            Point
+        >
+{
+    typedef detail::wkb::multi_range
+        <
+            wkb_linestring_view<Point>,
+            detail::wkb::geometry_type_ogc::multilinestring,
+            Point
+        > base_type;
+
+public:
+    //! Constructs the view, throws read_wkb_exception if the bytes are no WKB multi linestring
+    template <typename ByteType>
+    wkb_multi_linestring_view(ByteType const* bytes, std::size_t length)
+        : base_type(bytes, length)
+    {}
+};
+
+/*!
+\brief Read-only multi polygon over a WKB multi polygon
+\details The points are decoded once, when the view is constructed. The
+    polygons are stored in the view and returned by reference.
+\tparam Point point type of the decoded points
+\tparam ClockWise true for clockwise exterior rings, false for counterclockwise
+\ingroup wkb
+*/
+template <typename Point, bool ClockWise = true>
+class wkb_multi_polygon_view
+    : public detail::wkb::multi_range
+        <
+            wkb_polygon_view<Point, ClockWise>,
+            detail::wkb::geometry_type_ogc::multipolygon,
+            Point
+        >
+{
+    typedef detail::wkb::multi_range
+        <
+            wkb_polygon_view<Point, ClockWise>,
+            detail::wkb::geometry_type_ogc::multipolygon,
+            Point
+        > base_type;
+
+public:
+    //! Constructs the view, throws read_wkb_exception if the bytes are no WKB multi polygon
+    template <typename ByteType>
+    wkb_multi_polygon_view(ByteType const* bytes, std::size_t length)
+        : base_type(bytes, length)
+    {}
+};
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Point>
+struct tag<wkb_point_view<Point> >
+{
+    typedef point_tag type;
+};
+
+template <typename Point>
+struct coordinate_type<wkb_point_view<Point> >
+{
+    typedef typename geometry::coordinate_type<Point>::type type;
+};
+
+template <typename Point>
+struct coordinate_system<wkb_point_view<Point> >
+{
+    typedef typename geometry::coordinate_system<Point>::type type;
+};
+
+template <typename Point>
+struct dimension<wkb_point_view<Point> >
+    : geometry::dimension<Point>
+{};
+
+template <typename Point, std::size_t Dimension>
+struct access<wkb_point_view<Point>, Dimension>
+{
+    static inline typename geometry::coordinate_type<Point>::type
+        get(wkb_point_view<Point> const& p)
+    {
+        return p.template get<Dimension>();
+    }
+};
+
+
+template <typename Point>
+struct tag<wkb_linestring_view<Point> >
+{
+    typedef linestring_tag type;
+};
+
+
+template <typename Point, bool ClockWise>
+struct tag<wkb_ring_view<Point, ClockWise> >
+{
+    typedef ring_tag type;
+};
+
+template <typename Point, bool ClockWise>
+struct point_order<wkb_ring_view<Point, ClockWise> >
+{
+    static const order_selector value = ClockWise ? clockwise : counterclockwise;
+};
+
+template <typename Point, bool ClockWise>
+struct closure<wkb_ring_view<Point, ClockWise> >
+{
+    static const closure_selector value = closed;
+};
+
+
+template <typename Point, bool ClockWise>
+struct tag<wkb_polygon_view<Point, ClockWise> >
+{
+    typedef polygon_tag type;
+};
+
+template <typename Point, bool ClockWise>
+struct ring_const_type<wkb_polygon_view<Point, ClockWise> >
+{
+    typedef typename wkb_polygon_view<Point, ClockWise>::ring_type const& type;
+};
+
+template <typename Point, bool ClockWise>
+struct ring_mutable_type<wkb_polygon_view<Point, ClockWise> >
+{
+    typedef typename wkb_polygon_view<Point, ClockWise>::ring_type const& type;
+};
+
+template <typename Point, bool ClockWise>
+struct interior_const_type<wkb_polygon_view<Point, ClockWise> >
+{
+    typedef typename wkb_polygon_view<Point, ClockWise>::inner_container_type const& type;
+};
+
+template <typename Point, bool ClockWise>
+struct interior_mutable_type<wkb_polygon_view<Point, ClockWise> >
+{
+    typedef typename wkb_polygon_view<Point, ClockWise>::inner_container_type const& type;
+};
+
+template <typename Point, bool ClockWise>
+struct exterior_ring<wkb_polygon_view<Point, ClockWise> >
+{
+    static inline typename wkb_polygon_view<Point, ClockWise>::ring_type const&
+        get(wkb_polygon_view<Point, ClockWise> const& p)
+    {
+        return p.exterior_ring();
+    }
+};
+
+template <typename Point, bool ClockWise>
+struct interior_rings<wkb_polygon_view<Point, ClockWise> >
+{
+    static inline typename wkb_polygon_view<Point, ClockWise>::inner_container_type const&
+        get(wkb_polygon_view<Point, ClockWise> const& p)
+    {
+        return p.interior_rings();
+    }
+};
+
+
+template <typename Point>
+struct tag<wkb_multi_point_view<Point> >
+{
+    typedef multi_point_tag type;
+};
+
+template <typename Point>
+struct tag<wkb_multi_linestring_view<Point> >
+{
+    typedef multi_linestring_tag type;
+};
+
+template <typename Point, bool ClockWise>
+struct tag<wkb_multi_polygon_view<Point, ClockWise> >
+{
+    typedef multi_polygon_tag type;
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_WKB_VIEW_HPP
@@ -0,0 +1,279 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_WRITE_WKB_BUFFER_HPP
+#define BOOST_GEOMETRY_IO_WKB_WRITE_WKB_BUFFER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/static_assert.hpp>
+
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_system.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/point.hpp>
+
+#include <boost/geometry/extensions/gis/io/wkb/detail/ogc.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/wkb_size.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Points of model::point<double> (and derived, e.g. point_xy<double>) are
+// stored as the doubles of WKB, in the same order
+template <typename Point>
+struct is_native_point
+{
+    static const bool value = std::is_base_of
+        <
+            model::point
+                <
+                    double, dimension<Point>::value,
+                    typename coordinate_system<Point>::type
+                >,
+            Point
+        >::value
+        && sizeof(Point) == point_size<Point>::value;
+};
+
+// Native points stored contiguously are copied at once
+template <typename Range>
+struct is_native_range
+{
+    typedef typename boost::range_value<Range>::type point_type;
+    typedef typename boost::range_iterator<Range const>::type iterator_type;
+
+    static const bool value = is_native_point<point_type>::value
+        && (std::is_pointer<iterator_type>::value
+            || std::is_same
+                <
+                    iterator_type,
+                    typename std::vector<point_type>::const_iterator
+                >::value);
+};
+
+template <typename T>
+inline byte_type* put_value(byte_type* out, T const& value)
+{
+    std::memcpy(out, &value, sizeof(T));
+    return out + sizeof(T);
+}
+
+template <typename Geometry>
+inline byte_type* put_header(byte_type* out)
+{
+    *out++ = static_cast<byte_type>(native_byte_order);
+    return put_value(out, boost::uint32_t(geometry_type<Geometry>::get()));
+}
+
+template
+<
+    typename Point,
+    std::size_t Dimension = 0,
+    std::size_t DimensionCount = dimension<Point>::value
+>
+struct coordinates_copier
+{
+    static inline byte_type* apply(byte_type* out, Point const& point)
+    {
+        // NOTE: coordinates of any type are converted to double
+        out = put_value(out, static_cast<double>(geometry::get<Dimension>(point)));
+        return coordinates_copier<Point, Dimension + 1, DimensionCount>::apply(out, point);
+    }
+};
+
+template <typename Point, std::size_t DimensionCount>
+struct coordinates_copier<Point, DimensionCount, DimensionCount>
+{
+    static inline byte_type* apply(byte_type* out, Point const&)
+    {
+        return out;
+    }
+};
+
+template <typename Range>
+inline byte_type* put_points(byte_type* out, Range const& range, std::true_type)
+{
+    typedef typename boost::range_value<Range>::type point_type;
+
+    std::size_t const count = boost::size(range);
+    out = put_value(out, boost::uint32_t(count));
+    if (count > 0)
+    {
+        std::size_t const size = count * point_size<point_type>::value;
+        std::memcpy(out, std::addressof(*boost::begin(range)), size);
+        out += size;
+    }
+    return out;
+}
+
+template <typename Range>
+inline byte_type* put_points(byte_type* out, Range const& range, std::false_type)
+{
+    typedef typename boost::range_value<Range>::type point_type;
+
+    out = put_value(out, boost::uint32_t(boost::size(range)));
+    for (auto it = boost::begin(range); it != boost::end(range); ++it)
+    {
+        out = coordinates_copier<point_type>::apply(out, *it);
+    }
+    return out;
+}
+
+template <typename Range>
+inline byte_type* put_points(byte_type* out, Range const& range)
+{
+    return put_points(out, range,
+                      std::integral_constant<bool, is_native_range<Range>::value>());
+}
+
+template <typename Polygon>
+inline byte_type* put_rings(byte_type* out, Polygon const& polygon)
+{
+    auto const& rings = interior_rings(polygon);
+    out = put_value(out, boost::uint32_t(1 + boost::size(rings)));
+    out = put_points(out, exterior_ring(polygon));
+    for (auto it = boost::begin(rings); it != boost::end(rings); ++it)
+    {
+        out = put_points(out, *it);
+    }
+    return out;
+}
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Tag, typename Geometry>
+struct write_wkb_buffer : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct write_wkb_buffer<point_tag, Point>
+{
+    static inline detail::wkb::byte_type* apply(Point const& point,
+                                                 detail::wkb::byte_type* out)
+    {
+        out = detail::wkb::put_header<Point>(out);
+        return detail::wkb::coordinates_copier<Point>::apply(out, point);
+    }
+};
+
+template <typename Linestring>
+struct write_wkb_buffer<linestring_tag, Linestring>
+{
+    static inline detail::wkb::byte_type* apply(Linestring const& linestring,
+                                                 detail::wkb::byte_type* out)
+    {
+        out = detail::wkb::put_header<Linestring>(out);
+        return detail::wkb::put_points(out, linestring);
+    }
+};
+
+template <typename Polygon>
+struct write_wkb_buffer<polygon_tag, Polygon>
+{
+    static inline detail::wkb::byte_type* apply(Polygon const& polygon,
+                                                 detail::wkb::byte_type* out)
+    {
+        out = detail::wkb::put_header<Polygon>(out);
+        return detail::wkb::put_rings(out, polygon);
+    }
+};
+
+template <typename MultiGeometry, typename SingleTag>
+struct write_wkb_buffer_multi
+{
+    static inline detail::wkb::byte_type* apply(MultiGeometry const& multi,
+                                                 detail::wkb::byte_type* out)
+    {
+        typedef typename boost::range_value<MultiGeometry>::type single_type;
+
+        out = detail::wkb::put_header<MultiGeometry>(out);
+        out = detail::wkb::put_value(out, boost::uint32_t(boost::size(multi)));
+        for (auto it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            out = write_wkb_buffer<SingleTag, single_type>::apply(*it, out);
+        }
+        return out;
+    }
+};
+
+template <typename MultiPoint>
+struct write_wkb_buffer<multi_point_tag, MultiPoint>
+    : write_wkb_buffer_multi<MultiPoint, point_tag>
+{};
+
+template <typename MultiLinestring>
+struct write_wkb_buffer<multi_linestring_tag, MultiLinestring>
+    : write_wkb_buffer_multi<MultiLinestring, linestring_tag>
+{};
+
+template <typename MultiPolygon>
+struct write_wkb_buffer<multi_polygon_tag, MultiPolygon>
+    : write_wkb_buffer_multi<MultiPolygon, polygon_tag>
+{};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Writes the WKB of a geometry into a buffer
+\details The WKB is written in the native byte order, as by write_wkb.
+    Coordinates stored as contiguous doubles, e.g. the points of
+    model::linestring<model::d2::point_xy<double> >, are copied at once.
+\tparam Geometry \tparam_geometry
+\tparam ByteType type of the bytes of the buffer
+\param geometry \param_geometry
+\param buffer pointer to at least wkb_size(geometry) bytes
+\return Pointer past the last written byte
+*/
+template <typename Geometry, typename ByteType>
+inline ByteType* write_wkb_buffer(Geometry const& geometry, ByteType* buffer)
+{
+    BOOST_STATIC_ASSERT((std::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+
+    concepts::check<Geometry const>();
+
+    detail::wkb::byte_type* const end = dispatch::write_wkb_buffer
+        <
+            typename tag<Geometry>::type, Geometry
+        >::apply(geometry, reinterpret_cast<detail::wkb::byte_type*>(buffer));
+    return reinterpret_cast<ByteType*>(end);
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_WRITE_WKB_BUFFER_HPP
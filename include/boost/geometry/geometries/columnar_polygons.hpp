@@ -0,0 +1,518 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_GEOMETRIES_COLUMNAR_POLYGONS_HPP
+#define BOOST_GEOMETRY_GEOMETRIES_COLUMNAR_POLYGONS_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/concept/assert.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/exception.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/point_concept.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace columnar
+{
+
+// Iterates over consecutive rings, delimited by the offsets of their first
+// points. The rings are returned by value, their points by reference.
+template <typename Ring>
+class ring_iterator
+    : public boost::iterator_facade
+        <
+            ring_iterator<Ring>,
+            Ring const,
+            boost::random_access_traversal_tag,
+            Ring
+        >
+{
+    typedef typename Ring::value_type point_type;
+
+public:
+    ring_iterator()
+        : m_points(nullptr)
+        , m_offset(nullptr)
+    {}
+
+    ring_iterator(point_type const* points, std::size_t const* offset)
+        : m_points(points)
+        , m_offset(offset)
+    {}
+
+private:
+    friend class boost::iterator_core_access;
+
+    inline Ring dereference() const
+    {
+        return Ring(m_points + m_offset[0], m_points + m_offset[1]);
+    }
+
+    inline bool equal(ring_iterator const& other) const
+    {
+        return m_offset == other.m_offset;
+    }
+
+    inline void increment() { ++m_offset; }
+    inline void decrement() { --m_offset; }
+    inline void advance(std::ptrdiff_t n) { m_offset += n; }
+
+    inline std::ptrdiff_t distance_to(ring_iterator const& other) const
+    {
+        return other.m_offset - m_offset;
+    }
+
+    point_type const* m_points;
+    std::size_t const* m_offset;
+};
+
+}} // namespace detail::columnar
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace model
+{
+
+
+/*!
+\brief Read-only ring of a polygon of columnar_polygons
+\details The ring refers to consecutive points of the container, it is
+    valid as long as the container is not modified.
+\ingroup geometries
+\tparam Point point type
+\tparam ClockWise true for clockwise direction,
+            false for CounterClockWise direction
+\tparam Closed true for closed rings (last point == first point),
+            false open points
+*/
+template <typename Point, bool ClockWise = true, bool Closed = true>
+class columnar_ring
+{
+    BOOST_CONCEPT_ASSERT( (concepts::Point<Point>) );
+
+public:
+    typedef Point value_type;
+    typedef Point const& reference;
+    typedef Point const& const_reference;
+    typedef Point const* iterator;
+    typedef Point const* const_iterator;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    columnar_ring()
+        : m_first(nullptr)
+        , m_last(nullptr)
+    {}
+
+    columnar_ring(Point const* first, Point const* last)
+        : m_first(first)
+        , m_last(last)
+    {}
+
+    inline const_iterator begin() const { return m_first; }
+    inline const_iterator end() const { return m_last; }
+    inline size_type size() const { return size_type(m_last - m_first); }
+    inline bool empty() const { return m_first == m_last; }
+    inline const_reference operator[](size_type i) const { return m_first[i]; }
+
+private:
+    Point const* m_first;
+    Point const* m_last;
+};
+
+
+/*!
+\brief Read-only interior rings of a polygon of columnar_polygons
+\ingroup geometries
+*/
+template <typename Point, bool ClockWise = true, bool Closed = true>
+class columnar_interior_rings
+{
+public:
+    typedef columnar_ring<Point, ClockWise, Closed> value_type;
+    typedef geometry::detail::columnar::ring_iterator<value_type> iterator;
+    typedef iterator const_iterator;
+    typedef std::size_t size_type;
+
+    columnar_interior_rings()
+        : m_points(nullptr)
+        , m_offsets(nullptr)
+        , m_count(0)
+    {}
+
+    // The offsets of the rings are followed by the offset past the last ring
+    columnar_interior_rings(Point const* points, std::size_t const* offsets,
+                            std::size_t count)
+        : m_points(points)
+        , m_offsets(offsets)
+        , m_count(count)
+    {}
+
+    inline const_iterator begin() const { return const_iterator(m_points, m_offsets); }
+    inline const_iterator end() const { return const_iterator(m_points, m_offsets + m_count); }
+    inline size_type size() const { return m_count; }
+    inline bool empty() const { return m_count == 0; }
+
+    inline value_type operator[](size_type i) const
+    {
+        return value_type(m_points + m_offsets[i], m_points + m_offsets[i + 1]);
+    }
+
+private:
+    Point const* m_points;
+    std::size_t const* m_offsets;
+    std::size_t m_count;
+};
+
+
+/*!
+\brief Read-only polygon of columnar_polygons
+\details The polygon is a lightweight view, its rings are returned by
+    value and refer to the points of the container. It is valid as long
+    as the container is not modified.
+\ingroup geometries
+*/
+template <typename Point, bool ClockWise = true, bool Closed = true>
+class columnar_polygon
+{
+public:
+    typedef Point point_type;
+    typedef columnar_ring<Point, ClockWise, Closed> ring_type;
+    typedef columnar_interior_rings<Point, ClockWise, Closed> inner_container_type;
+
+    columnar_polygon()
+        : m_points(nullptr)
+        , m_offsets(nullptr)
+        , m_count(0)
+    {}
+
+    // The offsets of the rings are followed by the offset past the last ring
+    columnar_polygon(Point const* points, std::size_t const* offsets,
+                     std::size_t count)
+        : m_points(points)
+        , m_offsets(offsets)
+        , m_count(count)
+    {}
+
+    inline ring_type outer() const
+    {
+        return m_count == 0
+            ? ring_type()
+            : ring_type(m_points + m_offsets[0], m_points + m_offsets[1]);
+    }
+
+    inline inner_container_type inners() const
+    {
+        return m_count == 0
+            ? inner_container_type()
+            : inner_container_type(m_points, m_offsets + 1, m_count - 1);
+    }
+
+private:
+    Point const* m_points;
+    std::size_t const* m_offsets;
+    std::size_t m_count;
+};
+
+
+/*!
+\brief Polygons stored in flat buffers of points and offsets
+\details The points of all rings are stored consecutively in one buffer.
+    The ring offsets are the positions of the first point of each ring,
+    the polygon offsets the positions of the first ring of each polygon,
+    each followed by the position past the last one (as in GeoArrow).
+    The polygons are accessed as columnar_polygon views, adapted to the
+    Polygon Concept, without allocations per polygon or ring.
+\ingroup geometries
+\tparam Point point type
+\tparam ClockWise true for clockwise direction,
+            false for CounterClockWise direction
+\tparam Closed true for closed polygons (last point == first point),
+            false open points
+\note The container is not a multi polygon, the algorithms are applied
+    to its polygons.
+*/
+template <typename Point, bool ClockWise = true, bool Closed = true>
+class columnar_polygons
+{
+    BOOST_CONCEPT_ASSERT( (concepts::Point<Point>) );
+
+public:
+    typedef columnar_polygon<Point, ClockWise, Closed> value_type;
+    typedef std::size_t size_type;
+
+    class const_iterator
+        : public boost::iterator_facade
+            <
+                const_iterator,
+                value_type const,
+                boost::random_access_traversal_tag,
+                value_type
+            >
+    {
+    public:
+        const_iterator()
+            : m_container(nullptr)
+            , m_index(0)
+        {}
+
+        const_iterator(columnar_polygons const* container, std::size_t index)
+            : m_container(container)
+            , m_index(index)
+        {}
+
+    private:
+        friend class boost::iterator_core_access;
+
+        inline value_type dereference() const { return (*m_container)[m_index]; }
+        inline bool equal(const_iterator const& other) const { return m_index == other.m_index; }
+        inline void increment() { ++m_index; }
+        inline void decrement() { --m_index; }
+        inline void advance(std::ptrdiff_t n) { m_index += n; }
+
+        inline std::ptrdiff_t distance_to(const_iterator const& other) const
+        {
+            return std::ptrdiff_t(other.m_index) - std::ptrdiff_t(m_index);
+        }
+
+        columnar_polygons const* m_container;
+        std::size_t m_index;
+    };
+    typedef const_iterator iterator;
+
+    columnar_polygons()
+        : m_ring_offsets(1, 0)
+        , m_polygon_offsets(1, 0)
+    {}
+
+    /*!
+    \brief Constructs the polygons from the buffers, without copying them
+    \note invalid_input_exception is thrown if the offsets are not
+        ascending or do not start at 0 and end at the number of points
+        and rings
+    */
+    columnar_polygons(std::vector<Point> points,
+                      std::vector<std::size_t> ring_offsets,
+                      std::vector<std::size_t> polygon_offsets)
+        : m_points(std::move(points))
+        , m_ring_offsets(std::move(ring_offsets))
+        , m_polygon_offsets(std::move(polygon_offsets))
+    {
+        if (! check_offsets(m_ring_offsets, m_points.size())
+            || ! check_offsets(m_polygon_offsets, m_ring_offsets.size() - 1))
+        {
+            BOOST_THROW_EXCEPTION(invalid_input_exception());
+        }
+    }
+
+    inline void reserve(size_type polygons, size_type rings, size_type points)
+    {
+        m_polygon_offsets.reserve(polygons + 1);
+        m_ring_offsets.reserve(rings + 1);
+        m_points.reserve(points);
+    }
+
+    //! Appends a polygon (any polygon type)
+    template <typename Polygon>
+    inline void push_back(Polygon const& polygon)
+    {
+        append_ring(geometry::exterior_ring(polygon));
+        auto const& rings = geometry::interior_rings(polygon);
+        for (auto it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            append_ring(*it);
+        }
+        finish_polygon();
+    }
+
+    //! Appends a point to the current ring
+    inline void append_point(Point const& point)
+    {
+        m_points.push_back(point);
+    }
+
+    //! Finishes the current ring, its points are the appended points
+    inline void finish_ring()
+    {
+        m_ring_offsets.push_back(m_points.size());
+    }
+
+    //! Finishes the current polygon, its rings are the finished rings
+    inline void finish_polygon()
+    {
+        m_polygon_offsets.push_back(m_ring_offsets.size() - 1);
+    }
+
+    inline void clear()
+    {
+        m_points.clear();
+        m_ring_offsets.assign(1, 0);
+        m_polygon_offsets.assign(1, 0);
+    }
+
+    inline size_type size() const { return m_polygon_offsets.size() - 1; }
+    inline bool empty() const { return size() == 0; }
+
+    inline value_type operator[](size_type i) const
+    {
+        std::size_t const first = m_polygon_offsets[i];
+        return value_type(m_points.data(), m_ring_offsets.data() + first,
+                          m_polygon_offsets[i + 1] - first);
+    }
+
+    inline const_iterator begin() const { return const_iterator(this, 0); }
+    inline const_iterator end() const { return const_iterator(this, size()); }
+
+    inline std::vector<Point> const& points() const { return m_points; }
+    inline std::vector<std::size_t> const& ring_offsets() const { return m_ring_offsets; }
+    inline std::vector<std::size_t> const& polygon_offsets() const { return m_polygon_offsets; }
+
+private:
+    template <typename Ring>
+    inline void append_ring(Ring const& ring)
+    {
+        m_points.insert(m_points.end(), boost::begin(ring), boost::end(ring));
+        finish_ring();
+    }
+
+    static inline bool check_offsets(std::vector<std::size_t> const& offsets,
+                                     std::size_t count)
+    {
+        if (offsets.empty() || offsets.front() != 0 || offsets.back() != count)
+        {
+            return false;
+        }
+        for (std::size_t i = 1; i < offsets.size(); ++i)
+        {
+            if (offsets[i] < offsets[i - 1])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<Point> m_points;
+    std::vector<std::size_t> m_ring_offsets;
+    std::vector<std::size_t> m_polygon_offsets;
+};
+
+
+} // namespace model
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<model::columnar_ring<Point, ClockWise, Closed> >
+{
+    typedef ring_tag type;
+};
+
+template <typename Point, bool Closed>
+struct point_order<model::columnar_ring<Point, false, Closed> >
+{
+    static const order_selector value = counterclockwise;
+};
+
+template <typename Point, bool Closed>
+struct point_order<model::columnar_ring<Point, true, Closed> >
+{
+    static const order_selector value = clockwise;
+};
+
+template <typename Point, bool PointOrder>
+struct closure<model::columnar_ring<Point, PointOrder, true> >
+{
+    static const closure_selector value = closed;
+};
+
+template <typename Point, bool PointOrder>
+struct closure<model::columnar_ring<Point, PointOrder, false> >
+{
+    static const closure_selector value = open;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<model::columnar_polygon<Point, ClockWise, Closed> >
+{
+    typedef polygon_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct ring_const_type<model::columnar_polygon<Point, ClockWise, Closed> >
+{
+    typedef model::columnar_ring<Point, ClockWise, Closed> type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct ring_mutable_type<model::columnar_polygon<Point, ClockWise, Closed> >
+{
+    typedef model::columnar_ring<Point, ClockWise, Closed> type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_const_type<model::columnar_polygon<Point, ClockWise, Closed> >
+{
+    typedef model::columnar_interior_rings<Point, ClockWise, Closed> type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_mutable_type<model::columnar_polygon<Point, ClockWise, Closed> >
+{
+    typedef model::columnar_interior_rings<Point, ClockWise, Closed> type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct exterior_ring<model::columnar_polygon<Point, ClockWise, Closed> >
+{
+    typedef model::columnar_polygon<Point, ClockWise, Closed> polygon_type;
+
+    static inline typename polygon_type::ring_type get(polygon_type const& p)
+    {
+        return p.outer();
+    }
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct interior_rings<model::columnar_polygon<Point, ClockWise, Closed> >
+{
+    typedef model::columnar_polygon<Point, ClockWise, Closed> polygon_type;
+
+    static inline typename polygon_type::inner_container_type get(polygon_type const& p)
+    {
+        return p.inners();
+    }
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_GEOMETRIES_COLUMNAR_POLYGONS_HPP
@@ -0,0 +1,755 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_GEOJSON_DETAIL_PARSER_HPP
+#define BOOST_GEOMETRY_IO_GEOJSON_DETAIL_PARSER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/core/exception.hpp>
+#include <boost/geometry/io/wkt/detail/tokenizer.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Exception showing things wrong with GeoJSON parsing
+\ingroup geojson
+*/
+class read_geojson_exception : public geometry::exception
+{
+public:
+    explicit read_geojson_exception(std::string const& msg)
+        : m_message(msg)
+    {}
+
+    read_geojson_exception(std::string const& msg, std::size_t position)
+        : m_message(msg + " at position " + std::to_string(position))
+    {}
+
+    virtual char const* what() const throw()
+    {
+        return m_message.c_str();
+    }
+
+private:
+    std::string m_message;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace geojson
+{
+
+
+// Characters of a string in memory
+class string_source
+{
+public:
+    string_source(char const* first, char const* last)
+        : m_first(first)
+        , m_it(first)
+        , m_last(last)
+    {}
+
+    // Returns the current character or -1 at the end
+    inline int peek() const
+    {
+        return m_it != m_last ? static_cast<unsigned char>(*m_it) : -1;
+    }
+
+    inline void advance()
+    {
+        ++m_it;
+    }
+
+    inline std::size_t position() const
+    {
+        return std::size_t(m_it - m_first);
+    }
+
+private:
+    char const* m_first;
+    char const* m_it;
+    char const* m_last;
+};
+
+// Characters of an input stream, read in blocks
+class stream_source
+{
+public:
+    explicit stream_source(std::istream& is)
+        : m_is(is)
+        , m_buffer(1 << 16)
+        , m_it(0)
+        , m_size(0)
+        , m_offset(0)
+    {
+        fill();
+    }
+
+    inline int peek() const
+    {
+        return m_it != m_size ? static_cast<unsigned char>(m_buffer[m_it]) : -1;
+    }
+
+    inline void advance()
+    {
+        if (++m_it == m_size)
+        {
+            fill();
+        }
+    }
+
+    inline std::size_t position() const
+    {
+        return m_offset + m_it;
+    }
+
+private:
+    inline void fill()
+    {
+        m_offset += m_size;
+        m_it = 0;
+        m_size = 0;
+        if (m_is.good())
+        {
+            m_is.read(m_buffer.data(), std::streamsize(m_buffer.size()));
+            m_size = std::size_t(m_is.gcount());
+        }
+    }
+
+    std::istream& m_is;
+    std::vector<char> m_buffer;
+    std::size_t m_it;
+    std::size_t m_size;
+    std::size_t m_offset;
+};
+
+
+/*!
+\brief Internal, reads the tokens of JSON from a source of characters
+\details Strings and numbers are decoded into buffers reused for all
+    tokens, values which are not needed are skipped without storing them.
+*/
+template <typename Source>
+class lexer
+{
+public:
+    explicit lexer(Source& source)
+        : m_source(source)
+    {}
+
+    // Returns the first character of the next token or -1 at the end
+    inline int peek()
+    {
+        int c = m_source.peek();
+        while (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+        {
+            m_source.advance();
+            c = m_source.peek();
+        }
+        return c;
+    }
+
+    inline bool consume(char c)
+    {
+        if (peek() == c)
+        {
+            m_source.advance();
+            return true;
+        }
+        return false;
+    }
+
+    inline void expect(char c)
+    {
+        if (! consume(c))
+        {
+            error(std::string("Expected '") + c + "'");
+        }
+    }
+
+    // Returns the next string, valid until the next string is read
+    inline std::string const& read_string()
+    {
+        if (peek() != '"')
+        {
+            error("Expected string");
+        }
+        m_source.advance();
+
+        m_string.clear();
+        while (true)
+        {
+            int const c = m_source.peek();
+            if (c == '"')
+            {
+                m_source.advance();
+                return m_string;
+            }
+            if (c < 0x20)
+            {
+                error("Invalid or unterminated string");
+            }
+            m_source.advance();
+            if (c == '\\')
+            {
+                read_escape();
+            }
+            else
+            {
+                m_string += char(c);
+            }
+        }
+    }
+
+    inline double read_number()
+    {
+        m_number.clear();
+        int c = peek();
+        while (c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E'
+               || (c >= '0' && c <= '9'))
+        {
+            m_number += char(c);
+            m_source.advance();
+            c = m_source.peek();
+        }
+        if (m_number.empty())
+        {
+            error("Expected number");
+        }
+
+        try
+        {
+            detail::wkt::token const t(m_number.data(),
+                                       m_number.data() + m_number.size());
+            return detail::wkt::coordinate_parser<double>::apply(t);
+        }
+        catch (boost::bad_lexical_cast const&)
+        {
+            error("Invalid number '" + m_number + "'");
+        }
+        return 0;
+    }
+
+    // Skips a value of any type, nested objects and arrays are skipped
+    // without recursion
+    inline void skip_value()
+    {
+        m_closing.clear();
+        while (true)
+        {
+            int const c = peek();
+            if (c == '{' || c == '[')
+            {
+                m_source.advance();
+                char const closing = c == '{' ? '}' : ']';
+                if (! consume(closing))
+                {
+                    m_closing.push_back(closing);
+                    if (closing == '}')
+                    {
+                        read_string();
+                        expect(':');
+                    }
+                    continue;
+                }
+            }
+            else if (c == '"')
+            {
+                read_string();
+            }
+            else if (c == 't')
+            {
+                expect_literal("true");
+            }
+            else if (c == 'f')
+            {
+                expect_literal("false");
+            }
+            else if (c == 'n')
+            {
+                expect_literal("null");
+            }
+            else
+            {
+                read_number();
+            }
+
+            // After a value, the next member or element or the ends of
+            // the objects and arrays
+            while (! m_closing.empty())
+            {
+                int const next = peek();
+                if (next == ',')
+                {
+                    m_source.advance();
+                    if (m_closing.back() == '}')
+                    {
+                        read_string();
+                        expect(':');
+                    }
+                    break;
+                }
+                if (next != m_closing.back())
+                {
+                    error("Expected ',' or end of object or array");
+                }
+                m_source.advance();
+                m_closing.pop_back();
+            }
+
+            if (m_closing.empty())
+            {
+                return;
+            }
+        }
+    }
+
+    // Returns true and skips null if the next value is null
+    inline bool consume_null()
+    {
+        if (peek() == 'n')
+        {
+            expect_literal("null");
+            return true;
+        }
+        return false;
+    }
+
+    inline void expect_end()
+    {
+        if (peek() != -1)
+        {
+            error("Unexpected characters after the end");
+        }
+    }
+
+    inline void error(std::string const& message) const
+    {
+        BOOST_THROW_EXCEPTION(read_geojson_exception(message, m_source.position()));
+    }
+
+private:
+    inline void expect_literal(char const* literal)
+    {
+        for (; *literal != '\0'; ++literal)
+        {
+            if (m_source.peek() != *literal)
+            {
+                error("Invalid literal");
+            }
+            m_source.advance();
+        }
+    }
+
+    inline int read_hex4()
+    {
+        int result = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            int const c = m_source.peek();
+            int digit = -1;
+            if (c >= '0' && c <= '9')
+            {
+                digit = c - '0';
+            }
+            else if (c >= 'a' && c <= 'f')
+            {
+                digit = c - 'a' + 10;
+            }
+            else if (c >= 'A' && c <= 'F')
+            {
+                digit = c - 'A' + 10;
+            }
+            if (digit < 0)
+            {
+                error("Invalid unicode escape");
+            }
+            m_source.advance();
+            result = result * 16 + digit;
+        }
+        return result;
+    }
+
+    // Appends the character of an escape sequence, after the backslash
+    inline void read_escape()
+    {
+        int const c = m_source.peek();
+        m_source.advance();
+        switch (c)
+        {
+            case '"' : m_string += '"'; return;
+            case '\\' : m_string += '\\'; return;
+            case '/' : m_string += '/'; return;
+            case 'b' : m_string += '\b'; return;
+            case 'f' : m_string += '\f'; return;
+            case 'n' : m_string += '\n'; return;
+            case 'r' : m_string += '\r'; return;
+            case 't' : m_string += '\t'; return;
+            case 'u' : break;
+            default : error("Invalid escape");
+        }
+
+        // UTF-16 code unit(s) encoded as UTF-8
+        long code = read_hex4();
+        if (code >= 0xD800 && code < 0xDC00)
+        {
+            if (m_source.peek() != '\\')
+            {
+                error("Invalid unicode escape");
+            }
+            m_source.advance();
+            if (m_source.peek() != 'u')
+            {
+                error("Invalid unicode escape");
+            }
+            m_source.advance();
+            long const low = read_hex4();
+            if (low < 0xDC00 || low >= 0xE000)
+            {
+                error("Invalid unicode escape");
+            }
+            code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+        }
+
+        if (code < 0x80)
+        {
+            m_string += char(code);
+        }
+        else if (code < 0x800)
+        {
+            m_string += char(0xC0 | (code >> 6));
+            m_string += char(0x80 | (code & 0x3F));
+        }
+        else if (code < 0x10000)
+        {
+            m_string += char(0xE0 | (code >> 12));
+            m_string += char(0x80 | ((code >> 6) & 0x3F));
+            m_string += char(0x80 | (code & 0x3F));
+        }
+        else
+        {
+            m_string += char(0xF0 | (code >> 18));
+            m_string += char(0x80 | ((code >> 12) & 0x3F));
+            m_string += char(0x80 | ((code >> 6) & 0x3F));
+            m_string += char(0x80 | (code & 0x3F));
+        }
+    }
+
+    Source& m_source;
+    std::string m_string;
+    std::string m_number;
+    std::vector<char> m_closing;
+};
+
+
+// Calls function(key) for the members of an object, the function reads
+// the value. The key is valid until the next string is read.
+template <typename Lexer, typename Function>
+inline void for_each_member(Lexer& lexer, Function const& function)
+{
+    lexer.expect('{');
+    if (lexer.consume('}'))
+    {
+        return;
+    }
+    do
+    {
+        std::string const& key = lexer.read_string();
+        lexer.expect(':');
+        function(key);
+    } while (lexer.consume(','));
+    lexer.expect('}');
+}
+
+
+enum geometry_type
+{
+    unknown_type,
+    point_type,
+    linestring_type,
+    polygon_type,
+    multi_point_type,
+    multi_linestring_type,
+    multi_polygon_type,
+    geometry_collection_type
+};
+
+inline geometry_type to_geometry_type(std::string const& name)
+{
+    static char const* const names[] =
+    {
+        "Point", "LineString", "Polygon", "MultiPoint", "MultiLineString",
+        "MultiPolygon", "GeometryCollection"
+    };
+    for (std::size_t i = 0; i < sizeof(names) / sizeof(names[0]); ++i)
+    {
+        if (name == names[i])
+        {
+            return geometry_type(i + 1);
+        }
+    }
+    return unknown_type;
+}
+
+// The depth of the arrays of coordinates of a geometry type
+inline std::size_t coordinates_depth(geometry_type type)
+{
+    switch (type)
+    {
+        case point_type : return 1;
+        case linestring_type : return 2;
+        case multi_point_type : return 2;
+        case polygon_type : return 3;
+        case multi_linestring_type : return 3;
+        case multi_polygon_type : return 4;
+        default : return 0;
+    }
+}
+
+
+// An array of coordinates, either a position (an array of numbers) or an
+// array of arrays
+struct coordinates_array
+{
+    std::size_t count;
+    std::size_t first_value;
+    bool is_position;
+};
+
+/*!
+\brief Internal, a GeoJSON geometry object read from the input
+\details The members of the object may be in any order, so the type may
+    follow the coordinates. The coordinates are stored in flat buffers,
+    the arrays in the order of their opening brackets, and converted to
+    the output geometry when the object is complete. The buffers are kept
+    to read the next object without allocations.
+*/
+struct parsed_geometry
+{
+    parsed_geometry()
+        : type(unknown_type)
+        , has_coordinates(false)
+        , has_geometries(false)
+        , geometry_count(0)
+    {}
+
+    inline void clear()
+    {
+        type = unknown_type;
+        has_coordinates = false;
+        has_geometries = false;
+        arrays.clear();
+        values.clear();
+        geometry_count = 0;
+    }
+
+    geometry_type type;
+    bool has_coordinates;
+    bool has_geometries;
+    std::vector<coordinates_array> arrays;
+    std::vector<double> values;
+
+    // The members of a GeometryCollection, the first geometry_count are used
+    std::vector<parsed_geometry> geometries;
+    std::size_t geometry_count;
+};
+
+
+// Limits the recursion for nested GeometryCollections
+static const std::size_t max_collection_depth = 64;
+
+template <typename Lexer>
+inline void parse_coordinates(Lexer& lexer, parsed_geometry& geometry,
+                              std::size_t depth)
+{
+    if (depth > 4)
+    {
+        lexer.error("Too deeply nested coordinates");
+    }
+
+    lexer.expect('[');
+    std::size_t const index = geometry.arrays.size();
+    geometry.arrays.push_back(coordinates_array{0, geometry.values.size(), false});
+    if (lexer.consume(']'))
+    {
+        return;
+    }
+
+    std::size_t count = 0;
+    bool const is_position = lexer.peek() != '[';
+    do
+    {
+        if (is_position)
+        {
+            geometry.values.push_back(lexer.read_number());
+        }
+        else
+        {
+            parse_coordinates(lexer, geometry, depth + 1);
+        }
+        ++count;
+    } while (lexer.consume(','));
+    lexer.expect(']');
+
+    geometry.arrays[index].count = count;
+    geometry.arrays[index].is_position = is_position;
+}
+
+template <typename Lexer>
+inline void parse_geometry(Lexer& lexer, parsed_geometry& geometry,
+                           std::size_t depth);
+
+// Reads the coordinates or the geometries of a geometry object, returns
+// false for other members
+template <typename Lexer>
+inline bool parse_geometry_member(Lexer& lexer, std::string const& key,
+                                  parsed_geometry& geometry, std::size_t depth)
+{
+    if (key == "coordinates")
+    {
+        geometry.arrays.clear();
+        geometry.values.clear();
+        parse_coordinates(lexer, geometry, 1);
+        geometry.has_coordinates = true;
+        return true;
+    }
+
+    if (key == "geometries")
+    {
+        if (depth >= max_collection_depth)
+        {
+            lexer.error("Too deeply nested geometry collections");
+        }
+
+        geometry.geometry_count = 0;
+        lexer.expect('[');
+        if (! lexer.consume(']'))
+        {
+            do
+            {
+                if (geometry.geometry_count == geometry.geometries.size())
+                {
+                    geometry.geometries.emplace_back();
+                }
+                parse_geometry(lexer,
+                               geometry.geometries[geometry.geometry_count++],
+                               depth + 1);
+            } while (lexer.consume(','));
+            lexer.expect(']');
+        }
+        geometry.has_geometries = true;
+        return true;
+    }
+
+    return false;
+}
+
+template <typename Lexer>
+inline void check_geometry(Lexer& lexer, parsed_geometry const& geometry)
+{
+    if (geometry.type == unknown_type)
+    {
+        lexer.error("Missing geometry type");
+    }
+    if (geometry.type == geometry_collection_type ? ! geometry.has_geometries
+                                                   : ! geometry.has_coordinates)
+    {
+        lexer.error("Missing coordinates or geometries");
+    }
+}
+
+template <typename Lexer>
+inline void parse_geometry(Lexer& lexer, parsed_geometry& geometry,
+                           std::size_t depth)
+{
+    geometry.clear();
+    for_each_member(lexer, [&](std::string const& key)
+    {
+        if (key == "type")
+        {
+            geometry.type = to_geometry_type(lexer.read_string());
+            if (geometry.type == unknown_type)
+            {
+                lexer.error("Unknown geometry type");
+            }
+        }
+        else if (! parse_geometry_member(lexer, key, geometry, depth))
+        {
+            lexer.skip_value();
+        }
+    });
+    check_geometry(lexer, geometry);
+}
+
+// Parses a geometry object or the geometry of a Feature object. Returns
+// false if the geometry of the Feature is null.
+template <typename Lexer>
+inline bool parse_geometry_or_feature(Lexer& lexer, parsed_geometry& geometry)
+{
+    geometry.clear();
+    bool is_feature = false;
+    bool is_null = false;
+    bool has_geometry = false;
+    for_each_member(lexer, [&](std::string const& key)
+    {
+        if (key == "type")
+        {
+            std::string const& type = lexer.read_string();
+            is_feature = type == "Feature";
+            if (! is_feature)
+            {
+                geometry.type = to_geometry_type(type);
+                if (geometry.type == unknown_type)
+                {
+                    lexer.error("Unknown type");
+                }
+            }
+        }
+        else if (key == "geometry")
+        {
+            is_null = lexer.consume_null();
+            if (! is_null)
+            {
+                parse_geometry(lexer, geometry, 0);
+            }
+            has_geometry = true;
+        }
+        else if (! parse_geometry_member(lexer, key, geometry, 0))
+        {
+            lexer.skip_value();
+        }
+    });
+
+    if (! is_feature)
+    {
+        check_geometry(lexer, geometry);
+        return true;
+    }
+    if (! has_geometry)
+    {
+        lexer.error("Missing geometry of feature");
+    }
+    return ! is_null;
+}
+
+
+}} // namespace detail::geojson
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_GEOJSON_DETAIL_PARSER_HPP
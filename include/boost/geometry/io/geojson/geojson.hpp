@@ -0,0 +1,13 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_GEOJSON_GEOJSON_HPP
+#define BOOST_GEOMETRY_IO_GEOJSON_GEOJSON_HPP
+
+#include <boost/geometry/io/geojson/read.hpp>
+#include <boost/geometry/io/geojson/write.hpp>
+
+#endif // BOOST_GEOMETRY_IO_GEOJSON_GEOJSON_HPP
@@ -0,0 +1,734 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_GEOJSON_READ_HPP
+#define BOOST_GEOMETRY_IO_GEOJSON_READ_HPP
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <utility>
+
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/geometry_types.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/mutable_range.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/io/geojson/detail/parser.hpp>
+
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/sequence.hpp>
+#include <boost/geometry/util/type_traits.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace geojson
+{
+
+
+template
+<
+    typename Point,
+    std::size_t Dimension = 0,
+    std::size_t DimensionCount = geometry::dimension<Point>::value
+>
+struct position_assigner
+{
+    // Coordinates missing in the position are set to zero
+    static inline void apply(double const* values, std::size_t count, Point& point)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+        geometry::set<Dimension>(point, Dimension < count
+                                        ? coordinate_type(values[Dimension])
+                                        : coordinate_type(0));
+        position_assigner<Point, Dimension + 1, DimensionCount>::apply(values, count, point);
+    }
+};
+
+template <typename Point, std::size_t DimensionCount>
+struct position_assigner<Point, DimensionCount, DimensionCount>
+{
+    static inline void apply(double const*, std::size_t, Point&)
+    {}
+};
+
+
+inline coordinates_array const& position(parsed_geometry const& geometry,
+                                         std::size_t index)
+{
+    coordinates_array const& array = geometry.arrays[index];
+    if (! array.is_position || array.count < 2)
+    {
+        BOOST_THROW_EXCEPTION(read_geojson_exception("Invalid position"));
+    }
+    return array;
+}
+
+// Returns the number of elements of an array of arrays
+inline std::size_t array_count(parsed_geometry const& geometry, std::size_t index)
+{
+    coordinates_array const& array = geometry.arrays[index];
+    if (array.is_position)
+    {
+        BOOST_THROW_EXCEPTION(read_geojson_exception("Invalid coordinates"));
+    }
+    return array.count;
+}
+
+
+// The functions reading coordinates return the index of the array
+// following the arrays which were read
+
+template <typename Point>
+inline std::size_t read_position(parsed_geometry const& geometry,
+                                 std::size_t index, Point& point)
+{
+    coordinates_array const& array = position(geometry, index);
+    position_assigner<Point>::apply(geometry.values.data() + array.first_value,
+                                    array.count, point);
+    return index + 1;
+}
+
+template <typename Range>
+inline std::size_t read_positions(parsed_geometry const& geometry,
+                                  std::size_t index, Range& range)
+{
+    typedef typename point_type<Range>::type point_type;
+
+    std::size_t const count = array_count(geometry, index++);
+    range::clear(range);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        point_type point;
+        index = read_position(geometry, index, point);
+        range::push_back(range, point);
+    }
+    return index;
+}
+
+inline bool equal_positions(parsed_geometry const& geometry,
+                            std::size_t index1, std::size_t index2)
+{
+    coordinates_array const& a1 = geometry.arrays[index1];
+    coordinates_array const& a2 = geometry.arrays[index2];
+    if (a1.count != a2.count)
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < a1.count; ++i)
+    {
+        if (geometry.values[a1.first_value + i] != geometry.values[a2.first_value + i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The rings of GeoJSON are closed, the closing point is not added to
+// rings which are open
+template <typename Ring>
+inline std::size_t read_ring(parsed_geometry const& geometry,
+                             std::size_t index, Ring& ring)
+{
+    std::size_t const first = index;
+    index = read_positions(geometry, index, ring);
+    if (geometry::closure<Ring>::value == open
+        && boost::size(ring) > 1
+        && equal_positions(geometry, first + 1, index - 1))
+    {
+        range::pop_back(ring);
+    }
+    return index;
+}
+
+template <typename Polygon>
+inline std::size_t read_polygon(parsed_geometry const& geometry,
+                                std::size_t index, Polygon& polygon)
+{
+    std::size_t const count = array_count(geometry, index++);
+    if (count == 0)
+    {
+        range::clear(exterior_ring(polygon));
+    }
+    range::clear(interior_rings(polygon));
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (i == 0)
+        {
+            auto&& ring = exterior_ring(polygon);
+            index = read_ring(geometry, index, ring);
+        }
+        else
+        {
+            typename ring_type<Polygon>::type ring;
+            index = read_ring(geometry, index, ring);
+            range::push_back(geometry::interior_rings(polygon), std::move(ring));
+        }
+    }
+    return index;
+}
+
+template <typename MultiGeometry, typename Function>
+inline std::size_t read_multi(parsed_geometry const& geometry, std::size_t index,
+                              MultiGeometry& multi, Function const& read_single)
+{
+    std::size_t const count = array_count(geometry, index++);
+    range::clear(multi);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        traits::resize<MultiGeometry>::apply(multi, boost::size(multi) + 1);
+        index = read_single(geometry, index, range::back(multi));
+    }
+    return index;
+}
+
+
+inline void check_type(parsed_geometry const& geometry, geometry_type type)
+{
+    if (geometry.type != type)
+    {
+        BOOST_THROW_EXCEPTION(read_geojson_exception(
+            "Unable to store this type of geometry in this geometry"));
+    }
+}
+
+
+struct dynamic_move_assign
+{
+    template <typename DynamicGeometry, typename Geometry>
+    static void apply(DynamicGeometry& dynamic_geometry, Geometry & geometry)
+    {
+        dynamic_geometry = std::move(geometry);
+    }
+};
+
+struct dynamic_move_emplace_back
+{
+    template <typename GeometryCollection, typename Geometry>
+    static void apply(GeometryCollection& geometry_collection, Geometry & geometry)
+    {
+        traits::emplace_back<GeometryCollection>::apply(geometry_collection, std::move(geometry));
+    }
+};
+
+// Reads a geometry of the type of the GeoJSON object, one of the types
+// of a dynamic geometry or of a geometry collection
+template
+<
+    typename Geometry,
+    template <typename, typename> class ReadGeojson,
+    typename AppendPolicy
+>
+struct dynamic_read_caller
+{
+    static inline void apply(parsed_geometry const& parsed, Geometry& geometry)
+    {
+        switch (parsed.type)
+        {
+            case point_type :
+                read<util::is_point>(parsed, geometry);
+                break;
+            case linestring_type :
+                read<util::is_linestring>(parsed, geometry, false)
+                || read<util::is_segment>(parsed, geometry);
+                break;
+            case polygon_type :
+                read<util::is_polygon>(parsed, geometry, false)
+                || read<util::is_ring>(parsed, geometry, false)
+                || read<util::is_box>(parsed, geometry);
+                break;
+            case multi_point_type :
+                read<util::is_multi_point>(parsed, geometry);
+                break;
+            case multi_linestring_type :
+                read<util::is_multi_linestring>(parsed, geometry);
+                break;
+            case multi_polygon_type :
+                read<util::is_multi_polygon>(parsed, geometry);
+                break;
+            default :
+                read<util::is_geometry_collection>(parsed, geometry);
+                break;
+        }
+    }
+
+private:
+    template
+    <
+        template <typename> class UnaryPred,
+        typename Geom = typename util::sequence_find_if
+            <
+                typename traits::geometry_types<Geometry>::type, UnaryPred
+            >::type,
+        std::enable_if_t<! std::is_void<Geom>::value, int> = 0
+    >
+    static bool read(parsed_geometry const& parsed, Geometry& geometry, bool = true)
+    {
+        Geom g;
+        ReadGeojson<Geom, typename tag<Geom>::type>::apply(parsed, g);
+        AppendPolicy::apply(geometry, g);
+        return true;
+    }
+
+    template
+    <
+        template <typename> class UnaryPred,
+        typename Geom = typename util::sequence_find_if
+            <
+                typename traits::geometry_types<Geometry>::type, UnaryPred
+            >::type,
+        std::enable_if_t<std::is_void<Geom>::value, int> = 0
+    >
+    static bool read(parsed_geometry const&, Geometry&, bool throw_on_misfit = true)
+    {
+        if (throw_on_misfit)
+        {
+            BOOST_THROW_EXCEPTION(read_geojson_exception(
+                "Unable to store this type of geometry in this geometry"));
+        }
+        return false;
+    }
+};
+
+
+template
+<
+    typename Box,
+    std::size_t Dimension = 0,
+    std::size_t DimensionCount = geometry::dimension<Box>::value
+>
+struct box_assigner
+{
+    static inline void apply(parsed_geometry const& parsed, std::size_t first,
+                             std::size_t last, Box& box)
+    {
+        typedef typename coordinate_type<Box>::type coordinate_type;
+
+        double min_value = 0;
+        double max_value = 0;
+        for (std::size_t i = first; i < last; ++i)
+        {
+            coordinates_array const& array = parsed.arrays[i];
+            double const value = Dimension < array.count
+                               ? parsed.values[array.first_value + Dimension]
+                               : 0;
+            if (i == first || value < min_value)
+            {
+                min_value = value;
+            }
+            if (i == first || value > max_value)
+            {
+                max_value = value;
+            }
+        }
+        geometry::set<min_corner, Dimension>(box, coordinate_type(min_value));
+        geometry::set<max_corner, Dimension>(box, coordinate_type(max_value));
+
+        box_assigner<Box, Dimension + 1, DimensionCount>::apply(parsed, first, last, box);
+    }
+};
+
+template <typename Box, std::size_t DimensionCount>
+struct box_assigner<Box, DimensionCount, DimensionCount>
+{
+    static inline void apply(parsed_geometry const&, std::size_t, std::size_t, Box&)
+    {}
+};
+
+
+}} // namespace detail::geojson
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct read_geojson : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct read_geojson<Point, point_tag>
+{
+    static inline void apply(detail::geojson::parsed_geometry const& parsed,
+                             Point& point)
+    {
+        detail::geojson::check_type(parsed, detail::geojson::point_type);
+        detail::geojson::read_position(parsed, 0, point);
+    }
+};
+
+template <typename Linestring>
+struct read_geojson<Linestring, linestring_tag>
+{
+    static inline void apply(detail::geojson::parsed_geometry const& parsed,
+                             Linestring& linestring)
+    {
+        detail::geojson::check_type(parsed, detail::geojson::linestring_type);
+        detail::geojson::read_positions(parsed, 0, linestring);
+    }
+};
+
+// A Polygon with one ring
+template <typename Ring>
+struct read_geojson<Ring, ring_tag>
+{
+    static inline void apply(detail::geojson::parsed_geometry const& parsed,
+                             Ring& ring)
+    {
+        detail::geojson::check_type(parsed, detail::geojson::polygon_type);
+        if (detail::geojson::array_count(parsed, 0) != 1)
+        {
+            BOOST_THROW_EXCEPTION(read_geojson_exception(
+                "Ring should be a Polygon with one ring"));
+        }
+        detail::geojson::read_ring(parsed, 1, ring);
+    }
+};
+
+template <typename Polygon>
+struct read_geojson<Polygon, polygon_tag>
+{
+    static inline void apply(detail::geojson::parsed_geometry const& parsed,
+                             Polygon& polygon)
+    {
+        detail::geojson::check_type(parsed, detail::geojson::polygon_type);
+        detail::geojson::read_polygon(parsed, 0, polygon);
+    }
+};
+
+template <typename MultiPoint>
+struct read_geojson<MultiPoint, multi_point_tag>
+{
+    static inline void apply(detail::geojson::parsed_geometry const& parsed,
+                             MultiPoint& multi_point)
+    {
+        detail::geojson::check_type(parsed, detail::geojson::multi_point_type);
+        detail::geojson::read_positions(parsed, 0, multi_point);
+    }
+};
+
+template <typename MultiLinestring>
+struct read_geojson<MultiLinestring, multi_linestring_tag>
+{
+    static inline void apply(detail::geojson::parsed_geometry const& parsed,
+                             MultiLinestring& multi_linestring)
+    {
+        detail::geojson::check_type(parsed, detail::geojson::multi_linestring_type);
+        detail::geojson::read_multi(parsed, 0, multi_linestring,
+            [](detail::geojson::parsed_geometry const& p, std::size_t index,
+               typename boost::range_value<MultiLinestring>::type& linestring)
+            {
+                return detail::geojson::read_positions(p, index, linestring);
+            });
+    }
+};
+
+template <typename MultiPolygon>
+struct read_geojson<MultiPolygon, multi_polygon_tag>
+{
+    static inline void apply(detail::geojson::parsed_geometry const& parsed,
+                             MultiPolygon& multi_polygon)
+    {
+        detail::geojson::check_type(parsed, detail::geojson::multi_polygon_type);
+        detail::geojson::read_multi(parsed, 0, multi_polygon,
+            [](detail::geojson::parsed_geometry const& p, std::size_t index,
+               typename boost::range_value<MultiPolygon>::type& polygon)
+            {
+                return detail::geojson::read_polygon(p, index, polygon);
+            });
+    }
+};
+
+// The envelope of the positions of the exterior ring of a Polygon
+template <typename Box>
+struct read_geojson<Box, box_tag>
+{
+    static inline void apply(detail::geojson::parsed_geometry const& parsed,
+                             Box& box)
+    {
+        detail::geojson::check_type(parsed, detail::geojson::polygon_type);
+        std::size_t const count = detail::geojson::array_count(parsed, 0) > 0
+                                ? detail::geojson::array_count(parsed, 1)
+                                : 0;
+        if (count == 0)
+        {
+            BOOST_THROW_EXCEPTION(read_geojson_exception(
+                "Box should be a Polygon with points"));
+        }
+        for (std::size_t i = 2; i < count + 2; ++i)
+        {
+            detail::geojson::position(parsed, i);
+        }
+        detail::geojson::box_assigner<Box>::apply(parsed, 2, count + 2, box);
+    }
+};
+
+// A LineString with two points
+template <typename Segment>
+struct read_geojson<Segment, segment_tag>
+{
+    static inline void apply(detail::geojson::parsed_geometry const& parsed,
+                             Segment& segment)
+    {
+        typedef typename point_type<Segment>::type point_type;
+
+        detail::geojson::check_type(parsed, detail::geojson::linestring_type);
+        if (detail::geojson::array_count(parsed, 0) != 2)
+        {
+            BOOST_THROW_EXCEPTION(read_geojson_exception(
+                "Segment should have 2 points"));
+        }
+        point_type p0, p1;
+        detail::geojson::read_position(parsed, 1, p0);
+        detail::geojson::read_position(parsed, 2, p1);
+        geometry::detail::assign_point_to_index<0>(p0, segment);
+        geometry::detail::assign_point_to_index<1>(p1, segment);
+    }
+};
+
+template <typename DynamicGeometry>
+struct read_geojson<DynamicGeometry, dynamic_geometry_tag>
+{
+    static inline void apply(detail::geojson::parsed_geometry const& parsed,
+                             DynamicGeometry& dynamic_geometry)
+    {
+        detail::geojson::dynamic_read_caller
+            <
+                DynamicGeometry, dispatch::read_geojson,
+                detail::geojson::dynamic_move_assign
+            >::apply(parsed, dynamic_geometry);
+    }
+};
+
+template <typename GeometryCollection>
+struct read_geojson<GeometryCollection, geometry_collection_tag>
+{
+    static inline void apply(detail::geojson::parsed_geometry const& parsed,
+                             GeometryCollection& geometry_collection)
+    {
+        detail::geojson::check_type(parsed, detail::geojson::geometry_collection_type);
+        range::clear(geometry_collection);
+        for (std::size_t i = 0; i < parsed.geometry_count; ++i)
+        {
+            detail::geojson::dynamic_read_caller
+                <
+                    GeometryCollection, dispatch::read_geojson,
+                    detail::geojson::dynamic_move_emplace_back
+                >::apply(parsed.geometries[i], geometry_collection);
+        }
+    }
+};
+
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Parses GeoJSON from a range of characters into a geometry (any geometry)
+\details The JSON is parsed in one pass without building a document in
+    memory. The input is either a geometry object or a Feature object.
+    Other members, e.g. "bbox" or "properties", are skipped.
+\ingroup geojson
+\tparam Geometry \tparam_geometry
+\param first pointer to the first character of the GeoJSON
+\param last pointer past the last character of the GeoJSON
+\param geometry \param_geometry output geometry
+\note read_geojson_exception is thrown for invalid input, for a geometry
+    not matching the type of the output geometry and for a Feature without
+    geometry
+*/
+template <typename Geometry>
+inline void read_geojson(char const* first, char const* last, Geometry& geometry)
+{
+    geometry::concepts::check<Geometry>();
+
+    detail::geojson::string_source source(first, last);
+    detail::geojson::lexer<detail::geojson::string_source> lexer(source);
+    detail::geojson::parsed_geometry parsed;
+    if (! detail::geojson::parse_geometry_or_feature(lexer, parsed))
+    {
+        BOOST_THROW_EXCEPTION(read_geojson_exception("Feature without geometry"));
+    }
+    lexer.expect_end();
+
+    dispatch::read_geojson<Geometry>::apply(parsed, geometry);
+}
+
+/*!
+\brief Parses GeoJSON into a geometry (any geometry)
+\ingroup geojson
+\tparam Geometry \tparam_geometry
+\param json string containing GeoJSON
+\param geometry \param_geometry output geometry
+*/
+template <typename Geometry>
+inline void read_geojson(std::string const& json, Geometry& geometry)
+{
+    geometry::read_geojson(json.data(), json.data() + json.size(), geometry);
+}
+
+/*!
+\brief Parses GeoJSON into a geometry (any geometry) and returns it
+\ingroup geojson
+\tparam Geometry \tparam_geometry
+\param json string containing GeoJSON
+*/
+template <typename Geometry>
+inline Geometry from_geojson(std::string const& json)
+{
+    Geometry geometry;
+    geometry::read_geojson(json, geometry);
+    return geometry;
+}
+
+
+/*!
+\brief Reads the geometries of the features of a GeoJSON FeatureCollection
+    from a stream, one at a time
+\details The stream is read in blocks and only the current feature is held
+    in memory, so collections larger than the memory can be processed.
+    Features with a null geometry are skipped, the properties of the
+    features and the other members are skipped.
+\ingroup geojson
+\tparam Geometry \tparam_geometry
+*/
+template <typename Geometry>
+class geojson_reader
+{
+    typedef detail::geojson::lexer<detail::geojson::stream_source> lexer_type;
+
+public:
+    explicit geojson_reader(std::istream& is)
+        : m_source(is)
+        , m_lexer(m_source)
+        , m_state(state_start)
+    {
+        geometry::concepts::check<Geometry>();
+    }
+
+    geojson_reader(geojson_reader const&) = delete;
+    geojson_reader& operator=(geojson_reader const&) = delete;
+
+    /*!
+    \brief Reads the geometry of the next feature
+    \return false if there are no more features
+    \note read_geojson_exception is thrown for invalid input and for
+        a geometry not matching the type of the output geometry
+    */
+    inline bool next(Geometry& geometry)
+    {
+        if (m_state == state_start)
+        {
+            m_lexer.expect('{');
+            m_state = find_features() ? state_first_feature : state_end;
+        }
+
+        while (m_state != state_end)
+        {
+            if (m_lexer.consume(']'))
+            {
+                skip_members();
+                m_state = state_end;
+                return false;
+            }
+            if (m_state == state_first_feature)
+            {
+                m_state = state_feature;
+            }
+            else
+            {
+                m_lexer.expect(',');
+            }
+
+            if (detail::geojson::parse_geometry_or_feature(m_lexer, m_parsed))
+            {
+                dispatch::read_geojson<Geometry>::apply(m_parsed, geometry);
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    enum state
+    {
+        state_start,
+        state_first_feature,
+        state_feature,
+        state_end
+    };
+
+    // Skips the members preceding the features, returns false if the
+    // object has no features
+    inline bool find_features()
+    {
+        if (m_lexer.consume('}'))
+        {
+            m_lexer.expect_end();
+            return false;
+        }
+        do
+        {
+            bool const is_features = m_lexer.read_string() == "features";
+            m_lexer.expect(':');
+            if (is_features)
+            {
+                m_lexer.expect('[');
+                return true;
+            }
+            m_lexer.skip_value();
+        } while (m_lexer.consume(','));
+        m_lexer.expect('}');
+        m_lexer.expect_end();
+        return false;
+    }
+
+    // Skips the members following the features
+    inline void skip_members()
+    {
+        while (m_lexer.consume(','))
+        {
+            m_lexer.read_string();
+            m_lexer.expect(':');
+            m_lexer.skip_value();
+        }
+        m_lexer.expect('}');
+        m_lexer.expect_end();
+    }
+
+    detail::geojson::stream_source m_source;
+    lexer_type m_lexer;
+    detail::geojson::parsed_geometry m_parsed;
+    state m_state;
+};
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_GEOJSON_READ_HPP
@@ -0,0 +1,535 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_GEOJSON_WRITE_HPP
+#define BOOST_GEOMETRY_IO_GEOJSON_WRITE_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/empty.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/exception.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/core/visit.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/io/wkt/detail/writer.hpp>
+
+#include <boost/geometry/util/type_traits.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace geojson
+{
+
+
+// JSON has no representation of NaN and infinity
+template <typename CoordinateType>
+inline void check_coordinate(CoordinateType const& value)
+{
+    if (! boost::math::isfinite(value))
+    {
+        BOOST_THROW_EXCEPTION(invalid_input_exception());
+    }
+}
+
+template <typename CoordinateType>
+inline void check_coordinates(CoordinateType const& x0, CoordinateType const& y0,
+                              CoordinateType const& x1, CoordinateType const& y1)
+{
+    check_coordinate(x0);
+    check_coordinate(y0);
+    check_coordinate(x1);
+    check_coordinate(y1);
+}
+
+template <typename Writer, typename CoordinateType>
+inline void write_coordinate(Writer& writer, CoordinateType const& value)
+{
+    check_coordinate(value);
+    writer << value;
+}
+
+template
+<
+    typename Point,
+    std::size_t Dimension = 0,
+    std::size_t DimensionCount = geometry::dimension<Point>::value
+>
+struct coordinates_writer
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Point const& point)
+    {
+        if (Dimension > 0)
+        {
+            writer << ',';
+        }
+        write_coordinate(writer, geometry::get<Dimension>(point));
+        coordinates_writer<Point, Dimension + 1, DimensionCount>::apply(writer, point);
+    }
+};
+
+template <typename Point, std::size_t DimensionCount>
+struct coordinates_writer<Point, DimensionCount, DimensionCount>
+{
+    template <typename Writer>
+    static inline void apply(Writer&, Point const&)
+    {}
+};
+
+template <typename Writer, typename Point>
+inline void write_position(Writer& writer, Point const& point)
+{
+    writer << '[';
+    coordinates_writer<Point>::apply(writer, point);
+    writer << ']';
+}
+
+// Writes the points of a range, the rings of GeoJSON are closed so
+// the first point of an open ring is repeated if Close is true
+template <bool Close, typename Writer, typename Range>
+inline void write_positions(Writer& writer, Range const& range)
+{
+    writer << '[';
+    auto const end = boost::end(range);
+    for (auto it = boost::begin(range); it != end; ++it)
+    {
+        if (it != boost::begin(range))
+        {
+            writer << ',';
+        }
+        write_position(writer, *it);
+    }
+    if (Close && geometry::closure<Range>::value == open && ! boost::empty(range))
+    {
+        writer << ',';
+        write_position(writer, *boost::begin(range));
+    }
+    writer << ']';
+}
+
+template <typename Writer, typename Polygon>
+inline void write_rings(Writer& writer, Polygon const& polygon)
+{
+    writer << '[';
+    write_positions<true>(writer, exterior_ring(polygon));
+    for (auto const& ring : interior_rings(polygon))
+    {
+        writer << ',';
+        write_positions<true>(writer, ring);
+    }
+    writer << ']';
+}
+
+template <typename Writer, typename Multi, typename Function>
+inline void write_multi(Writer& writer, Multi const& multi, Function const& function)
+{
+    writer << '[';
+    auto const end = boost::end(multi);
+    for (auto it = boost::begin(multi); it != end; ++it)
+    {
+        if (it != boost::begin(multi))
+        {
+            writer << ',';
+        }
+        function(writer, *it);
+    }
+    writer << ']';
+}
+
+template <typename Writer>
+inline void write_prefix(Writer& writer, char const* type)
+{
+    writer << "{\"type\":\"" << type << "\",\"coordinates\":";
+}
+
+
+}} // namespace detail::geojson
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct geojson : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct geojson<Point, point_tag>
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Point const& point)
+    {
+        detail::geojson::write_prefix(writer, "Point");
+        detail::geojson::write_position(writer, point);
+        writer << '}';
+    }
+};
+
+template <typename Linestring>
+struct geojson<Linestring, linestring_tag>
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Linestring const& linestring)
+    {
+        detail::geojson::write_prefix(writer, "LineString");
+        detail::geojson::write_positions<false>(writer, linestring);
+        writer << '}';
+    }
+};
+
+// A LineString with two points
+template <typename Segment>
+struct geojson<Segment, segment_tag>
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Segment const& segment)
+    {
+        auto const& x0 = geometry::get<0, 0>(segment);
+        auto const& y0 = geometry::get<0, 1>(segment);
+        auto const& x1 = geometry::get<1, 0>(segment);
+        auto const& y1 = geometry::get<1, 1>(segment);
+        detail::geojson::check_coordinates(x0, y0, x1, y1);
+
+        detail::geojson::write_prefix(writer, "LineString");
+        writer << "[[" << x0 << ',' << y0 << "],[" << x1 << ',' << y1 << "]]}";
+    }
+};
+
+// A Polygon with one ring
+template <typename Ring>
+struct geojson<Ring, ring_tag>
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Ring const& ring)
+    {
+        detail::geojson::write_prefix(writer, "Polygon");
+        writer << '[';
+        detail::geojson::write_positions<true>(writer, ring);
+        writer << "]}";
+    }
+};
+
+// A Polygon with the counterclockwise ring of the corners
+template <typename Box>
+struct geojson<Box, box_tag>
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Box const& box)
+    {
+        auto const& x0 = geometry::get<min_corner, 0>(box);
+        auto const& y0 = geometry::get<min_corner, 1>(box);
+        auto const& x1 = geometry::get<max_corner, 0>(box);
+        auto const& y1 = geometry::get<max_corner, 1>(box);
+        detail::geojson::check_coordinates(x0, y0, x1, y1);
+
+        detail::geojson::write_prefix(writer, "Polygon");
+        writer << "[[[" << x0 << ',' << y0 << "],[" << x1 << ',' << y0
+               << "],[" << x1 << ',' << y1 << "],[" << x0 << ',' << y1
+               << "],[" << x0 << ',' << y0 << "]]]}";
+    }
+};
+
+template <typename Polygon>
+struct geojson<Polygon, polygon_tag>
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Polygon const& polygon)
+    {
+        detail::geojson::write_prefix(writer, "Polygon");
+        detail::geojson::write_rings(writer, polygon);
+        writer << '}';
+    }
+};
+
+template <typename MultiPoint>
+struct geojson<MultiPoint, multi_point_tag>
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, MultiPoint const& multi_point)
+    {
+        detail::geojson::write_prefix(writer, "MultiPoint");
+        detail::geojson::write_positions<false>(writer, multi_point);
+        writer << '}';
+    }
+};
+
+template <typename MultiLinestring>
+struct geojson<MultiLinestring, multi_linestring_tag>
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, MultiLinestring const& multi_linestring)
+    {
+        detail::geojson::write_prefix(writer, "MultiLineString");
+        detail::geojson::write_multi(writer, multi_linestring,
+            [](Writer& w, auto const& linestring)
+            {
+                detail::geojson::write_positions<false>(w, linestring);
+            });
+        writer << '}';
+    }
+};
+
+template <typename MultiPolygon>
+struct geojson<MultiPolygon, multi_polygon_tag>
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, MultiPolygon const& multi_polygon)
+    {
+        detail::geojson::write_prefix(writer, "MultiPolygon");
+        detail::geojson::write_multi(writer, multi_polygon,
+            [](Writer& w, auto const& polygon)
+            {
+                detail::geojson::write_rings(w, polygon);
+            });
+        writer << '}';
+    }
+};
+
+template <typename Geometry>
+struct geojson<Geometry, dynamic_geometry_tag>
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Geometry const& geometry)
+    {
+        traits::visit<Geometry>::apply([&](auto const& g)
+        {
+            geojson<util::remove_cref_t<decltype(g)>>::apply(writer, g);
+        }, geometry);
+    }
+};
+
+template <typename Geometry>
+struct geojson<Geometry, geometry_collection_tag>
+{
+    template <typename Writer>
+    static inline void apply(Writer& writer, Geometry const& geometry)
+    {
+        geojson::output_or_recursive_call(writer, geometry);
+    }
+
+private:
+    template
+    <
+        typename Writer, typename Geom,
+        std::enable_if_t<util::is_geometry_collection<Geom>::value, int> = 0
+    >
+    static void output_or_recursive_call(Writer& writer, Geom const& geom)
+    {
+        writer << "{\"type\":\"GeometryCollection\",\"geometries\":[";
+
+        auto const end = boost::end(geom);
+        for (auto it = boost::begin(geom); it != end; ++it)
+        {
+            if (it != boost::begin(geom))
+            {
+                writer << ',';
+            }
+
+            traits::iter_visit<Geom>::apply([&](auto const& g)
+            {
+                geojson::output_or_recursive_call(writer, g);
+            }, it);
+        }
+
+        writer << "]}";
+    }
+
+    template
+    <
+        typename Writer, typename Geom,
+        std::enable_if_t<! util::is_geometry_collection<Geom>::value, int> = 0
+    >
+    static void output_or_recursive_call(Writer& writer, Geom const& geom)
+    {
+        geojson<Geom>::apply(writer, geom);
+    }
+};
+
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Writes a geometry as a GeoJSON geometry object to an output iterator
+\details The coordinates are formatted without iostreams, in the shortest
+    representation which is read back as the same value, or with the
+    specified number of significant digits. Open rings are closed, boxes
+    are written as polygons and segments as linestrings.
+\ingroup geojson
+\tparam Geometry \tparam_geometry
+\tparam OutputIterator output iterator of characters
+\param geometry \param_geometry
+\param out output iterator the characters are written to
+\param significant_digits If positive, the number of significant digits
+    of floating point coordinates
+\return Output iterator past the last written character
+*/
+template <typename Geometry, typename OutputIterator>
+inline OutputIterator write_geojson(Geometry const& geometry, OutputIterator out,
+                                    int significant_digits = 0)
+{
+    concepts::check<Geometry const>();
+
+    typedef detail::wkt::iterator_output<OutputIterator> output_type;
+    detail::wkt::writer<output_type> writer(output_type(out), significant_digits);
+    dispatch::geojson<Geometry>::apply(writer, geometry);
+    return writer.output().iterator();
+}
+
+/*!
+\brief Appends a geometry as a GeoJSON geometry object to a string
+\ingroup geojson
+\tparam Geometry \tparam_geometry
+\param geometry \param_geometry
+\param str string the characters are appended to
+\param significant_digits If positive, the number of significant digits
+    of floating point coordinates
+*/
+template <typename Geometry>
+inline void write_geojson(Geometry const& geometry, std::string& str,
+                          int significant_digits = 0)
+{
+    concepts::check<Geometry const>();
+
+    detail::wkt::writer<detail::wkt::string_output> writer(
+        detail::wkt::string_output(str), significant_digits);
+    dispatch::geojson<Geometry>::apply(writer, geometry);
+}
+
+/*!
+\brief Returns a geometry as a GeoJSON geometry object
+\ingroup geojson
+\tparam Geometry \tparam_geometry
+\param geometry \param_geometry
+\param significant_digits If positive, the number of significant digits
+    of floating point coordinates
+*/
+template <typename Geometry>
+inline std::string to_geojson(Geometry const& geometry, int significant_digits = 0)
+{
+    std::string result;
+    geometry::write_geojson(geometry, result, significant_digits);
+    return result;
+}
+
+
+/*!
+\brief Writes geometries to a stream as the features of a GeoJSON
+    FeatureCollection, one at a time
+\details Each feature is formatted in a buffer and written to the stream,
+    so collections larger than the memory can be written. The collection
+    is terminated by close() or by the destructor.
+\ingroup geojson
+*/
+class geojson_writer
+{
+public:
+    explicit geojson_writer(std::ostream& os, int significant_digits = 0)
+        : m_os(os)
+        , m_significant_digits(significant_digits)
+        , m_count(0)
+        , m_closed(false)
+    {
+        m_os << "{\"type\":\"FeatureCollection\",\"features\":[";
+    }
+
+    geojson_writer(geojson_writer const&) = delete;
+    geojson_writer& operator=(geojson_writer const&) = delete;
+
+    ~geojson_writer()
+    {
+        try
+        {
+            close();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    /*!
+    \brief Writes a feature
+    \param geometry \param_geometry
+    \param properties the JSON of the properties of the feature, an object
+        or null
+    \note Throws invalid_input_exception for non-finite coordinates, the
+        feature is not written, and invalid_output_exception if the
+        collection is closed
+    */
+    template <typename Geometry>
+    inline void write(Geometry const& geometry,
+                      std::string const& properties = "null")
+    {
+        if (m_closed)
+        {
+            BOOST_THROW_EXCEPTION(invalid_output_exception());
+        }
+
+        m_buffer.clear();
+        if (m_count > 0)
+        {
+            m_buffer += ',';
+        }
+        m_buffer += "{\"type\":\"Feature\",\"geometry\":";
+        geometry::write_geojson(geometry, m_buffer, m_significant_digits);
+        m_buffer += ",\"properties\":";
+        m_buffer += properties;
+        m_buffer += '}';
+        m_os.write(m_buffer.data(), std::streamsize(m_buffer.size()));
+        ++m_count;
+    }
+
+    //! Returns the number of written features
+    inline std::size_t count() const
+    {
+        return m_count;
+    }
+
+    //! Terminates the collection, no features can be written afterwards
+    inline void close()
+    {
+        if (! m_closed)
+        {
+            m_closed = true;
+            m_os << "]}";
+            m_os.flush();
+        }
+    }
+
+private:
+    std::ostream& m_os;
+    int m_significant_digits;
+    std::size_t m_count;
+    bool m_closed;
+    std::string m_buffer;
+};
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_GEOJSON_WRITE_HPP
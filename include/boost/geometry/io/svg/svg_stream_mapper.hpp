@@ -0,0 +1,622 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_SVG_STREAM_MAPPER_HPP
+#define BOOST_GEOMETRY_IO_SVG_STREAM_MAPPER_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+#include <boost/noncopyable.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+#include <boost/geometry/algorithms/transform.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/core/visit.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/io/svg/write.hpp>
+#include <boost/geometry/io/wkt/detail/writer.hpp>
+#include <boost/geometry/strategies/transform/map_transformer.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+#include <boost/geometry/util/type_traits.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace svg
+{
+
+// The output is written to the stream when the buffer holds at least
+// this number of characters
+static const std::size_t stream_buffer_size = 65536;
+
+// SVG coordinates are written with a resolution of 1/100 pixel
+template <typename T>
+inline T round_svg_coordinate(T const& value, std::true_type)
+{
+    return std::round(value * T(100)) / T(100);
+}
+
+template <typename T>
+inline T round_svg_coordinate(T const& value, std::false_type)
+{
+    return value;
+}
+
+template <typename T>
+inline T round_svg_coordinate(T const& value)
+{
+    return round_svg_coordinate(value, std::is_floating_point<T>());
+}
+
+
+/*!
+\brief Internal, renders geometries as SVG elements into a character buffer
+\details Points are transformed to SVG pixels one by one, without
+    intermediate geometries. A vertex closer than the tolerance (in pixels)
+    to the previously written vertex is skipped, the last vertex of a range
+    is always written.
+*/
+template <typename Box, typename Transformer, typename SvgPoint>
+class stream_renderer
+{
+public:
+    typedef SvgPoint svg_point_type;
+    typedef typename coordinate_type<SvgPoint>::type svg_coordinate_type;
+
+    stream_renderer(Box const& viewport, Transformer const& transformer,
+                    double width, double height, double tolerance)
+        : m_viewport(viewport)
+        , m_transformer(transformer)
+        , m_width(width)
+        , m_height(height)
+        , m_squared_tolerance(tolerance * tolerance)
+        , m_writer(wkt::string_output(m_buffer), 0)
+    {}
+
+    inline Box const& viewport() const
+    {
+        return m_viewport;
+    }
+
+    inline Transformer const& transformer() const
+    {
+        return m_transformer;
+    }
+
+    inline std::string& buffer()
+    {
+        return m_buffer;
+    }
+
+    // Returns false if the envelope of the geometry is outside the viewport
+    template <typename Geometry>
+    inline bool visible(Geometry const& geometry) const
+    {
+        if (geometry::is_empty(geometry))
+        {
+            return false;
+        }
+
+        Box const envelope = return_envelope<Box>(geometry);
+        return geometry::get<min_corner, 0>(envelope) <= geometry::get<max_corner, 0>(m_viewport)
+            && geometry::get<max_corner, 0>(envelope) >= geometry::get<min_corner, 0>(m_viewport)
+            && geometry::get<min_corner, 1>(envelope) <= geometry::get<max_corner, 1>(m_viewport)
+            && geometry::get<max_corner, 1>(envelope) >= geometry::get<min_corner, 1>(m_viewport);
+    }
+
+    // Returns false if a circle of the specified radius (in pixels) is
+    // outside the SVG map
+    inline bool visible(SvgPoint const& point, double radius) const
+    {
+        double const x = geometry::get<0>(point);
+        double const y = geometry::get<1>(point);
+        return x >= -radius && x <= m_width + radius
+            && y >= -radius && y <= m_height + radius;
+    }
+
+    template <typename Point>
+    inline SvgPoint transform(Point const& point) const
+    {
+        SvgPoint result;
+        geometry::transform(point, result, m_transformer);
+        return result;
+    }
+
+    inline stream_renderer& operator<<(char const* str)
+    {
+        m_writer << str;
+        return *this;
+    }
+
+    inline stream_renderer& operator<<(std::string const& str)
+    {
+        m_buffer.append(str);
+        return *this;
+    }
+
+    inline stream_renderer& operator<<(double value)
+    {
+        m_writer << value;
+        return *this;
+    }
+
+    inline void put_coordinate(svg_coordinate_type const& value)
+    {
+        m_writer << round_svg_coordinate(value);
+    }
+
+    inline void put_point(char const* separator, SvgPoint const& point)
+    {
+        m_writer << separator;
+        put_coordinate(geometry::get<0>(point));
+        m_writer << ',';
+        put_coordinate(geometry::get<1>(point));
+    }
+
+    // Writes the points of a range, the first one preceded by first_separator
+    // and the others by separator. Returns the number of written points.
+    template <typename Range>
+    inline std::size_t put_points(Range const& range,
+                                  char const* first_separator,
+                                  char const* separator)
+    {
+        std::size_t count = 0;
+        SvgPoint previous;
+        SvgPoint skipped;
+        bool has_skipped = false;
+        for (auto it = boost::begin(range); it != boost::end(range); ++it)
+        {
+            SvgPoint const point = transform(*it);
+            if (count > 0 && squared_distance(point, previous) < m_squared_tolerance)
+            {
+                skipped = point;
+                has_skipped = true;
+                continue;
+            }
+
+            put_point(count == 0 ? first_separator : separator, point);
+            previous = point;
+            has_skipped = false;
+            ++count;
+        }
+
+        if (has_skipped)
+        {
+            put_point(separator, skipped);
+            ++count;
+        }
+        return count;
+    }
+
+private:
+    static inline double squared_distance(SvgPoint const& p1, SvgPoint const& p2)
+    {
+        double const dx = double(geometry::get<0>(p1)) - double(geometry::get<0>(p2));
+        double const dy = double(geometry::get<1>(p1)) - double(geometry::get<1>(p2));
+        return dx * dx + dy * dy;
+    }
+
+    Box m_viewport;
+    Transformer m_transformer;
+    double m_width;
+    double m_height;
+    double m_squared_tolerance;
+    std::string m_buffer;
+    wkt::writer<wkt::string_output> m_writer;
+};
+
+
+}} // namespace detail::svg
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+
+template
+<
+    typename Geometry,
+    typename Tag = typename tag_cast<typename tag<Geometry>::type, multi_tag>::type
+>
+struct svg_stream_map
+{
+    BOOST_GEOMETRY_STATIC_ASSERT_FALSE(
+        "Not or not yet implemented for this Geometry type.",
+        Geometry, Tag);
+};
+
+
+template <typename Point>
+struct svg_stream_map<Point, point_tag>
+{
+    template <typename Renderer>
+    static inline bool apply(Renderer& renderer, Point const& point,
+                             std::string const& style, double size)
+    {
+        double const radius = size < 0 ? 5 : size;
+        auto const p = renderer.transform(point);
+        if (! renderer.visible(p, radius))
+        {
+            return false;
+        }
+
+        renderer << "<circle cx=\"";
+        renderer.put_coordinate(geometry::get<0>(p));
+        renderer << "\" cy=\"";
+        renderer.put_coordinate(geometry::get<1>(p));
+        renderer << "\" r=\"" << radius << "\" style=\"" << style << "\"/>\n";
+        return true;
+    }
+};
+
+
+template <typename Box>
+struct svg_stream_map<Box, box_tag>
+{
+    template <typename Renderer>
+    static inline bool apply(Renderer& renderer, Box const& box,
+                             std::string const& style, double)
+    {
+        if (! renderer.visible(box))
+        {
+            return false;
+        }
+
+        // The transformation mirrors the y-axis, the corners of the
+        // transformed box are ordered by transforming the box itself
+        typedef typename Renderer::svg_coordinate_type ct;
+        model::box<typename Renderer::svg_point_type> ibox;
+        geometry::transform(box, ibox, renderer.transformer());
+
+        // Prevent invisible boxes, making them >=1, using "max"
+        ct const x = geometry::get<min_corner, 0>(ibox);
+        ct const y = geometry::get<min_corner, 1>(ibox);
+        ct const width = (std::max)(ct(1), geometry::get<max_corner, 0>(ibox) - x);
+        ct const height = (std::max)(ct(1), geometry::get<max_corner, 1>(ibox) - y);
+
+        renderer << "<rect x=\"";
+        renderer.put_coordinate(x);
+        renderer << "\" y=\"";
+        renderer.put_coordinate(y);
+        renderer << "\" width=\"";
+        renderer.put_coordinate(width);
+        renderer << "\" height=\"";
+        renderer.put_coordinate(height);
+        renderer << "\" style=\"" << style << "\"/>\n";
+        return true;
+    }
+};
+
+
+template <typename Segment>
+struct svg_stream_map<Segment, segment_tag>
+{
+    template <typename Renderer>
+    static inline bool apply(Renderer& renderer, Segment const& segment,
+                             std::string const& style, double)
+    {
+        if (! renderer.visible(segment))
+        {
+            return false;
+        }
+
+        typedef typename point_type<Segment>::type point_type;
+        point_type p1, p2;
+        geometry::detail::assign_point_from_index<0>(segment, p1);
+        geometry::detail::assign_point_from_index<1>(segment, p2);
+        auto const ip1 = renderer.transform(p1);
+        auto const ip2 = renderer.transform(p2);
+
+        renderer << "<line x1=\"";
+        renderer.put_coordinate(geometry::get<0>(ip1));
+        renderer << "\" y1=\"";
+        renderer.put_coordinate(geometry::get<1>(ip1));
+        renderer << "\" x2=\"";
+        renderer.put_coordinate(geometry::get<0>(ip2));
+        renderer << "\" y2=\"";
+        renderer.put_coordinate(geometry::get<1>(ip2));
+        renderer << "\" style=\"" << style << "\"/>\n";
+        return true;
+    }
+};
+
+
+template <typename Range, typename Policy>
+struct svg_stream_map_range
+{
+    template <typename Renderer>
+    static inline bool apply(Renderer& renderer, Range const& range,
+                             std::string const& style, double)
+    {
+        if (! renderer.visible(range))
+        {
+            return false;
+        }
+
+        renderer << "<" << Policy::prefix() << " points=\"";
+        renderer.put_points(range, "", " ");
+        renderer << "\" style=\"" << style << Policy::style() << "\"/>\n";
+        return true;
+    }
+};
+
+template <typename Linestring>
+struct svg_stream_map<Linestring, linestring_tag>
+    : svg_stream_map_range<Linestring, detail::svg::prefix_linestring>
+{};
+
+template <typename Ring>
+struct svg_stream_map<Ring, ring_tag>
+    : svg_stream_map_range<Ring, detail::svg::prefix_ring>
+{};
+
+
+template <typename Polygon>
+struct svg_stream_map<Polygon, polygon_tag>
+{
+    template <typename Renderer>
+    static inline bool apply(Renderer& renderer, Polygon const& polygon,
+                             std::string const& style, double)
+    {
+        if (! renderer.visible(geometry::exterior_ring(polygon)))
+        {
+            return false;
+        }
+
+        renderer << "<g fill-rule=\"evenodd\"><path d=\"";
+        renderer.put_points(geometry::exterior_ring(polygon), "M ", " L ");
+
+        auto const& rings = geometry::interior_rings(polygon);
+        for (auto it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            // Interior rings collapsing to less than three vertices
+            // are not visible and removed again
+            std::size_t const size = renderer.buffer().size();
+            if (renderer.put_points(*it, "M ", " L ") < 3)
+            {
+                renderer.buffer().resize(size);
+            }
+        }
+        renderer << " z \" style=\"" << style << "\"/></g>\n";
+        return true;
+    }
+};
+
+
+template <typename Multi>
+struct svg_stream_map<Multi, multi_tag>
+{
+    template <typename Renderer>
+    static inline bool apply(Renderer& renderer, Multi const& multi,
+                             std::string const& style, double size)
+    {
+        typedef typename boost::range_value<Multi>::type single_type;
+
+        // Each element is culled separately
+        bool result = false;
+        for (auto it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            if (svg_stream_map<single_type>::apply(renderer, *it, style, size))
+            {
+                result = true;
+            }
+        }
+        return result;
+    }
+};
+
+
+template <typename Geometry>
+struct svg_stream_map<Geometry, dynamic_geometry_tag>
+{
+    template <typename Renderer>
+    static inline bool apply(Renderer& renderer, Geometry const& geometry,
+                             std::string const& style, double size)
+    {
+        bool result = false;
+        traits::visit<Geometry>::apply([&](auto const& g)
+        {
+            result = svg_stream_map<util::remove_cref_t<decltype(g)>>::apply(
+                        renderer, g, style, size);
+        }, geometry);
+        return result;
+    }
+};
+
+
+template <typename Geometry>
+struct svg_stream_map<Geometry, geometry_collection_tag>
+{
+    template <typename Renderer>
+    static inline bool apply(Renderer& renderer, Geometry const& geometry,
+                             std::string const& style, double size)
+    {
+        bool result = false;
+        for (auto it = boost::begin(geometry); it != boost::end(geometry); ++it)
+        {
+            traits::iter_visit<Geometry>::apply([&](auto const& g)
+            {
+                if (svg_stream_map<util::remove_cref_t<decltype(g)>>::apply(
+                        renderer, g, style, size))
+                {
+                    result = true;
+                }
+            }, it);
+        }
+        return result;
+    }
+};
+
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Helper class to stream large amounts of geometries into an SVG map
+\details Unlike svg_mapper, the viewport (in map units) is specified up front,
+    so geometries can be mapped as they are read. Geometries (or, for multi
+    geometries, elements) whose envelope is outside the viewport are skipped.
+    Vertices closer than the tolerance to the previous vertex are skipped
+    while they are transformed to SVG pixels, and coordinates are written
+    with a resolution of 1/100 pixel. The output is formatted into a buffer
+    and written to the stream in blocks.
+
+    To skip the geometries outside the viewport without visiting them, they
+    can be stored in an rtree and queried with, for example,
+    rtree.query(index::intersects(mapper.viewport()), iterator).
+\tparam Point Point type, for input geometries.
+\tparam SameScale Boolean flag indicating if horizontal and vertical scale should
+    be the same. The default value is true
+\tparam SvgCoordinateType Coordinate type of SVG points. The default value is double
+\ingroup svg
+*/
+template
+<
+    typename Point,
+    bool SameScale = true,
+    typename SvgCoordinateType = double
+>
+class svg_stream_mapper : boost::noncopyable
+{
+    typedef model::point<SvgCoordinateType, 2, cs::cartesian> svg_point_type;
+
+    typedef typename geometry::select_most_precise
+        <
+            typename coordinate_type<Point>::type,
+            double
+        >::type calculation_type;
+
+    typedef strategy::transform::map_transformer
+        <
+            calculation_type,
+            geometry::dimension<Point>::type::value,
+            geometry::dimension<Point>::type::value,
+            true,
+            SameScale
+        > transformer_type;
+
+    typedef detail::svg::stream_renderer
+        <
+            model::box<Point>, transformer_type, svg_point_type
+        > renderer_type;
+
+    std::ostream& m_stream;
+    renderer_type m_renderer;
+
+public :
+
+    /*!
+    \brief Constructor, initializing the SVG map. Writes the header of the SVG.
+    \param stream Output stream, should be a stream already open
+    \param viewport Box (in map units) mapped to the SVG map
+    \param width Width of the SVG map (in SVG pixels)
+    \param height Height of the SVG map (in SVG pixels)
+    \param tolerance Minimal distance (in SVG pixels) between written vertices,
+        0 writes all vertices
+    \param width_height Optional information to increase width and/or height
+    */
+    svg_stream_mapper(std::ostream& stream
+        , model::box<Point> const& viewport
+        , SvgCoordinateType width
+        , SvgCoordinateType height
+        , double tolerance = 0.5
+        , std::string const& width_height = "width=\"100%\" height=\"100%\"")
+        : m_stream(stream)
+        , m_renderer(viewport, transformer_type(viewport, width, height),
+                     width, height, tolerance)
+    {
+        m_renderer
+            << "<?xml version=\"1.0\" standalone=\"no\"?>\n"
+            << "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\"\n"
+            << "\"http://www.w3.org/Graphics/SVG/1.1/DTD/svg11.dtd\">\n"
+            << "<svg " << width_height << " version=\"1.1\"\n"
+            << "xmlns=\"http://www.w3.org/2000/svg\"\n"
+            << "xmlns:xlink=\"http://www.w3.org/1999/xlink\">\n";
+    }
+
+    /*!
+    \brief Destructor, called automatically. Closes the SVG by streaming <\/svg>
+        and writes the buffered output to the stream
+    */
+    ~svg_stream_mapper()
+    {
+        m_renderer << "</svg>\n";
+        flush();
+    }
+
+    /*!
+    \brief Maps a geometry into the SVG map using the specified style,
+        if it is (partly) inside the viewport
+    \tparam Geometry \tparam_geometry
+    \param geometry \param_geometry
+    \param style String containing verbatim SVG style information
+    \param size Optional size (used for SVG points) in SVG pixels. For linestrings,
+        specify linewidth in the SVG style information
+    \return False if the geometry is outside the viewport and not mapped
+    */
+    template <typename Geometry>
+    bool map(Geometry const& geometry, std::string const& style,
+             double size = -1.0)
+    {
+        bool const result = dispatch::svg_stream_map<Geometry>::apply(
+                                m_renderer, geometry, style, size);
+        if (m_renderer.buffer().size() >= detail::svg::stream_buffer_size)
+        {
+            flush();
+        }
+        return result;
+    }
+
+    /*!
+    \brief Returns the viewport, the box (in map units) mapped to the SVG map
+    */
+    model::box<Point> const& viewport() const
+    {
+        return m_renderer.viewport();
+    }
+
+    /*!
+    \brief Writes the buffered output to the stream
+    */
+    void flush()
+    {
+        std::string& buffer = m_renderer.buffer();
+        m_stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_SVG_STREAM_MAPPER_HPP
@@ -0,0 +1,333 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
+#define BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+#include <boost/config.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/util/coordinate_cast.hpp>
+
+#if ! defined(BOOST_NO_CXX17_HDR_STRING_VIEW) && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define BOOST_GEOMETRY_DETAIL_WKT_USE_FROM_CHARS
+#endif
+#endif
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+
+// The characters of the WKT string, converted to a string only for
+// error messages
+class wkt_view
+{
+public:
+    wkt_view(std::string const& wkt)
+        : m_first(wkt.data())
+        , m_last(wkt.data() + wkt.size())
+    {}
+
+    wkt_view(char const* first, char const* last)
+        : m_first(first)
+        , m_last(last)
+    {}
+
+    inline char const* begin() const { return m_first; }
+    inline char const* end() const { return m_last; }
+
+    explicit operator std::string() const
+    {
+        return std::string(m_first, m_last);
+    }
+
+private:
+    char const* m_first;
+    char const* m_last;
+};
+
+
+// A token referring to the characters of the WKT string
+class token
+{
+public:
+    typedef char const* iterator;
+    typedef char const* const_iterator;
+
+    token()
+        : m_first(nullptr)
+        , m_last(nullptr)
+    {}
+
+    token(char const* first, char const* last)
+        : m_first(first)
+        , m_last(last)
+    {}
+
+    inline char const* begin() const { return m_first; }
+    inline char const* end() const { return m_last; }
+    inline std::size_t size() const { return std::size_t(m_last - m_first); }
+
+    inline operator std::string() const
+    {
+        return std::string(m_first, m_last);
+    }
+
+    friend inline bool operator==(token const& t, char const* value)
+    {
+        std::size_t const n = std::strlen(value);
+        return t.size() == n && std::memcmp(t.m_first, value, n) == 0;
+    }
+
+    friend inline bool operator!=(token const& t, char const* value)
+    {
+        return ! (t == value);
+    }
+
+private:
+    char const* m_first;
+    char const* m_last;
+};
+
+
+// Case insensitive comparison of a token with an (ASCII) keyword
+inline bool iequals(token const& t, char const* value)
+{
+    char const* it = t.begin();
+    for (; it != t.end() && *value != '\0'; ++it, ++value)
+    {
+        char c = *it;
+        if (c >= 'a' && c <= 'z')
+        {
+            c = char(c - 'a' + 'A');
+        }
+        char v = *value;
+        if (v >= 'a' && v <= 'z')
+        {
+            v = char(v - 'a' + 'A');
+        }
+        if (c != v)
+        {
+            return false;
+        }
+    }
+    return it == t.end() && *value == '\0';
+}
+
+inline bool iequals(token const& t, std::string const& value)
+{
+    return iequals(t, value.c_str());
+}
+
+
+/*!
+\brief Internal, splits WKT into tokens in one pass without allocations
+\details Spaces separate tokens, and "(", ")" and "," are tokens of their
+    own, as boost::tokenizer with char_separator<char>(" ", ",()") does.
+    The tokens refer to the characters of the WKT string.
+*/
+class tokenizer
+{
+public:
+    class iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef token value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef token const* pointer;
+        typedef token const& reference;
+
+        iterator()
+            : m_last(nullptr)
+        {}
+
+        iterator(char const* position, char const* last)
+            : m_last(last)
+        {
+            next(position);
+        }
+
+        inline token const& operator*() const { return m_token; }
+        inline token const* operator->() const { return &m_token; }
+
+        inline iterator& operator++()
+        {
+            next(m_token.end());
+            return *this;
+        }
+
+        inline iterator operator++(int)
+        {
+            iterator result = *this;
+            ++(*this);
+            return result;
+        }
+
+        inline bool operator==(iterator const& other) const
+        {
+            return m_token.begin() == other.m_token.begin();
+        }
+
+        inline bool operator!=(iterator const& other) const
+        {
+            return ! (*this == other);
+        }
+
+        //! Returns the end of the characters of the WKT string
+        inline char const* last() const
+        {
+            return m_last;
+        }
+
+    private:
+        static inline bool is_delimiter(char c)
+        {
+            return c == ' ' || c == ',' || c == '(' || c == ')';
+        }
+
+        inline void next(char const* position)
+        {
+            while (position != m_last && *position == ' ')
+            {
+                ++position;
+            }
+
+            char const* end = position;
+            if (end != m_last)
+            {
+                if (*end == ',' || *end == '(' || *end == ')')
+                {
+                    ++end;
+                }
+                else
+                {
+                    while (end != m_last && ! is_delimiter(*end))
+                    {
+                        ++end;
+                    }
+                }
+            }
+            m_token = token(position, end);
+        }
+
+        token m_token;
+        char const* m_last;
+    };
+
+    typedef iterator const_iterator;
+
+    explicit tokenizer(wkt_view const& wkt)
+        : m_first(wkt.begin())
+        , m_last(wkt.end())
+    {}
+
+    inline iterator begin() const
+    {
+        return iterator(m_first, m_last);
+    }
+
+    inline iterator end() const
+    {
+        return iterator(m_last, m_last);
+    }
+
+private:
+    char const* m_first;
+    char const* m_last;
+};
+
+
+// Returns the number of points of a coordinate sequence, counting the
+// commas before the closing parenthesis, starting at the first token after
+// the opening parenthesis. Used to reserve memory.
+inline std::size_t point_count(tokenizer::iterator const& it)
+{
+    char const* position = it->begin();
+    char const* const last = it.last();
+    if (position == last || *position == ')')
+    {
+        return 0;
+    }
+
+    std::size_t result = 1;
+    for (; position != last && *position != ')' && *position != '('; ++position)
+    {
+        if (*position == ',')
+        {
+            ++result;
+        }
+    }
+    return result;
+}
+
+
+template
+<
+    typename CoordinateType,
+    bool IsNumber = std::is_floating_point<CoordinateType>::value
+                 || (std::is_integral<CoordinateType>::value
+                     && sizeof(CoordinateType) > 1)
+>
+struct coordinate_parser
+{
+    static inline CoordinateType apply(token const& t)
+    {
+        return coordinate_cast<CoordinateType>::apply(std::string(t));
+    }
+};
+
+// Numbers are converted directly from the characters of the token, with
+// std::from_chars if it is available or with lexical_cast otherwise
+template <typename CoordinateType>
+struct coordinate_parser<CoordinateType, true>
+{
+    static inline CoordinateType apply(token const& t)
+    {
+#if defined(BOOST_GEOMETRY_DETAIL_WKT_USE_FROM_CHARS)
+        char const* first = t.begin();
+        if (first != t.end() && *first == '+')
+        {
+            ++first;
+        }
+        CoordinateType result;
+        std::from_chars_result const r = std::from_chars(first, t.end(), result);
+        if (r.ec != std::errc() || r.ptr != t.end() || first == t.end())
+        {
+            BOOST_THROW_EXCEPTION(boost::bad_lexical_cast());
+        }
+        return result;
+#elif defined(BOOST_GEOMETRY_NO_LEXICAL_CAST)
+        return coordinate_cast<CoordinateType>::apply(std::string(t));
+#else
+        return boost::lexical_cast<CoordinateType>(t.begin(), t.size());
+#endif
+    }
+};
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_DETAIL_TOKENIZER_HPP
@@ -0,0 +1,243 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_DETAIL_WRITER_HPP
+#define BOOST_GEOMETRY_IO_WKT_DETAIL_WRITER_HPP
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include <boost/config.hpp>
+#include <boost/lexical_cast.hpp>
+
+#if ! defined(BOOST_NO_CXX17_HDR_STRING_VIEW) && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define BOOST_GEOMETRY_DETAIL_WKT_USE_TO_CHARS
+#endif
+#endif
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+
+// Appends characters to a string
+class string_output
+{
+public:
+    explicit string_output(std::string& str)
+        : m_str(str)
+    {}
+
+    inline void append(char const* first, char const* last)
+    {
+        m_str.append(first, last);
+    }
+
+private:
+    std::string& m_str;
+};
+
+// Copies characters to an output iterator
+template <typename OutputIterator>
+class iterator_output
+{
+public:
+    explicit iterator_output(OutputIterator it)
+        : m_it(it)
+    {}
+
+    inline void append(char const* first, char const* last)
+    {
+        m_it = std::copy(first, last, m_it);
+    }
+
+    inline OutputIterator iterator() const
+    {
+        return m_it;
+    }
+
+private:
+    OutputIterator m_it;
+};
+
+
+// Large enough for the shortest representation of any floating point
+// value and for any precision up to max_digits10
+static const std::size_t coordinate_buffer_size = 64;
+
+
+template
+<
+    typename CoordinateType,
+    bool IsFloatingPoint = std::is_floating_point<CoordinateType>::value,
+    bool IsIntegral = (std::is_integral<CoordinateType>::value
+                       && sizeof(CoordinateType) > 1)
+>
+struct coordinate_formatter
+{
+    template <typename Output>
+    static inline void apply(Output& output, CoordinateType const& value, int)
+    {
+        std::string const str = boost::lexical_cast<std::string>(value);
+        output.append(str.data(), str.data() + str.size());
+    }
+};
+
+// Floating point values are written in the shortest representation which
+// is read back as the same value or, if precision is positive, with that
+// number of significant digits, as a stream in its default notation does
+template <typename CoordinateType>
+struct coordinate_formatter<CoordinateType, true, false>
+{
+    template <typename Output>
+    static inline void apply(Output& output, CoordinateType const& value,
+                             int precision)
+    {
+        char buffer[coordinate_buffer_size];
+        char const* const end = format(buffer, value,
+            (std::min)(precision, max_digits10()));
+        output.append(buffer, end);
+    }
+
+private:
+    static inline int max_digits10()
+    {
+        return std::numeric_limits<CoordinateType>::max_digits10;
+    }
+
+#if defined(BOOST_GEOMETRY_DETAIL_WKT_USE_TO_CHARS)
+    static inline char* format(char* buffer, CoordinateType const& value,
+                               int precision)
+    {
+        std::to_chars_result const r = precision > 0
+            ? std::to_chars(buffer, buffer + coordinate_buffer_size, value,
+                            std::chars_format::general, precision)
+            : std::to_chars(buffer, buffer + coordinate_buffer_size, value);
+        return r.ptr;
+    }
+#else
+    static inline float parse(char const* str, float) { return std::strtof(str, nullptr); }
+    static inline double parse(char const* str, double) { return std::strtod(str, nullptr); }
+    static inline long double parse(char const* str, long double) { return std::strtold(str, nullptr); }
+
+    static inline char* print(char* buffer, CoordinateType const& value,
+                              int precision)
+    {
+        int const n = std::snprintf(buffer, coordinate_buffer_size, "%.*Lg",
+                                    precision, static_cast<long double>(value));
+        return buffer + (std::min)(n, int(coordinate_buffer_size) - 1);
+    }
+
+    static inline char* format(char* buffer, CoordinateType const& value,
+                               int precision)
+    {
+        if (precision > 0)
+        {
+            return print(buffer, value, precision);
+        }
+
+        // The least number of significant digits reading back the value
+        int const digits10 = std::numeric_limits<CoordinateType>::digits10;
+        for (int digits = digits10; digits < max_digits10(); ++digits)
+        {
+            char* const end = print(buffer, value, digits);
+            *end = '\0';
+            if (parse(buffer, value) == value)
+            {
+                return end;
+            }
+        }
+        return print(buffer, value, max_digits10());
+    }
+#endif
+};
+
+template <typename CoordinateType>
+struct coordinate_formatter<CoordinateType, false, true>
+{
+    template <typename Output>
+    static inline void apply(Output& output, CoordinateType const& value, int)
+    {
+        char buffer[coordinate_buffer_size];
+#if defined(BOOST_GEOMETRY_DETAIL_WKT_USE_TO_CHARS)
+        char const* const end
+            = std::to_chars(buffer, buffer + coordinate_buffer_size, value).ptr;
+#else
+        int const n = std::is_signed<CoordinateType>::value
+            ? std::snprintf(buffer, coordinate_buffer_size, "%lld",
+                            static_cast<long long>(value))
+            : std::snprintf(buffer, coordinate_buffer_size, "%llu",
+                            static_cast<unsigned long long>(value));
+        char const* const end = buffer + n;
+#endif
+        output.append(buffer, end);
+    }
+};
+
+
+/*!
+\brief Internal, output of the WKT writers to a character buffer
+\details Provides the operators of an output stream used by the WKT
+    writers, formatting the coordinates without iostreams.
+*/
+template <typename Output>
+class writer
+{
+public:
+    writer(Output const& output, int precision)
+        : m_output(output)
+        , m_precision(precision)
+    {}
+
+    inline writer& operator<<(char const* str)
+    {
+        m_output.append(str, str + std::strlen(str));
+        return *this;
+    }
+
+    inline writer& operator<<(char c)
+    {
+        m_output.append(&c, &c + 1);
+        return *this;
+    }
+
+    template <typename CoordinateType>
+    inline writer& operator<<(CoordinateType const& value)
+    {
+        coordinate_formatter<CoordinateType>::apply(m_output, value, m_precision);
+        return *this;
+    }
+
+    inline Output const& output() const
+    {
+        return m_output;
+    }
+
+private:
+    Output m_output;
+    int m_precision;
+};
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_DETAIL_WRITER_HPP
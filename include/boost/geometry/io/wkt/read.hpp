@@ -23,9 +23,14 @@
 
 #include <cstddef>
 #include <string>
+#include <type_traits>
+
+#include <boost/config.hpp>
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+#include <string_view>
+#endif
 
 #include <boost/lexical_cast.hpp>
-#include <boost/tokenizer.hpp>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/range/begin.hpp>
@@ -55,6 +60,7 @@
 #include <boost/geometry/geometries/concepts/check.hpp>
 
 #include <boost/geometry/io/wkt/detail/prefix.hpp>
+#include <boost/geometry/io/wkt/detail/tokenizer.hpp>
 
 #include <boost/geometry/strategies/io/cartesian.hpp>
 #include <boost/geometry/strategies/io/geographic.hpp>
@@ -85,12 +91,20 @@ struct read_wkt_exception : public geometry::exception
         if (it != end)
         {
             source = " at '";
-            source += it->c_str();
+            source.append(it->begin(), it->end());
             source += "'";
         }
         complete = message + source + " in '" + wkt.substr(0, 100) + "'";
     }
 
+    template <typename Iterator>
+    read_wkt_exception(std::string const& msg,
+                       Iterator const& it,
+                       Iterator const& end,
+                       detail::wkt::wkt_view const& wkt)
+        : read_wkt_exception(msg, it, end, std::string(wkt))
+    {}
+
     read_wkt_exception(std::string const& msg, std::string const& wkt)
         : message(msg)
         , wkt(wkt)
@@ -98,6 +112,11 @@ struct read_wkt_exception : public geometry::exception
         complete = message + "' in (" + wkt.substr(0, 100) + ")";
     }
 
+    read_wkt_exception(std::string const& msg,
+                       detail::wkt::wkt_view const& wkt)
+        : read_wkt_exception(msg, std::string(wkt))
+    {}
+
     virtual ~read_wkt_exception() throw() {}
 
     virtual const char* what() const throw()
@@ -117,8 +136,6 @@ private :
 namespace detail { namespace wkt
 {
 
-typedef boost::tokenizer<boost::char_separator<char> > tokenizer;
-
 template <typename Point,
           std::size_t Dimension = 0,
           std::size_t DimensionCount = geometry::dimension<Point>::value>
@@ -127,7 +144,7 @@ struct parsing_assigner
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
                              Point& point,
-                             std::string const& wkt)
+                             wkt_view const& wkt)
     {
         typedef typename coordinate_type<Point>::type coordinate_type;
 
@@ -138,13 +155,12 @@ struct parsing_assigner
         {
             // Initialize missing coordinates to default constructor (zero)
             // OR
-            // Use lexical_cast for conversion to double/int
-            // Note that it is much slower than atof. However, it is more standard
-            // and in parsing the change in performance falls probably away against
-            // the tokenizing
+            // Convert numbers directly from the characters of the token
+            // (with std::from_chars if available), other types with
+            // coordinate_cast
             set<Dimension>(point, finished
                     ? coordinate_type()
-                    : coordinate_cast<coordinate_type>::apply(*it));
+                    : coordinate_parser<coordinate_type>::apply(*it));
         }
         catch(boost::bad_lexical_cast const& blc)
         {
@@ -170,7 +186,7 @@ struct parsing_assigner<Point, DimensionCount, DimensionCount>
     static inline void apply(tokenizer::iterator&,
                              tokenizer::iterator const&,
                              Point&,
-                             std::string const&)
+                             wkt_view const&)
     {
     }
 };
@@ -180,7 +196,7 @@ struct parsing_assigner<Point, DimensionCount, DimensionCount>
 template <typename Iterator>
 inline void handle_open_parenthesis(Iterator& it,
                                     Iterator const& end,
-                                    std::string const& wkt)
+                                    wkt_view const& wkt)
 {
     if (it == end || *it != "(")
     {
@@ -193,7 +209,7 @@ inline void handle_open_parenthesis(Iterator& it,
 template <typename Iterator>
 inline void handle_close_parenthesis(Iterator& it,
                                      Iterator const& end,
-                                     std::string const& wkt)
+                                     wkt_view const& wkt)
 {
     if (it != end && *it == ")")
     {
@@ -208,7 +224,7 @@ inline void handle_close_parenthesis(Iterator& it,
 template <typename Iterator>
 inline void check_end(Iterator& it,
                       Iterator const& end,
-                      std::string const& wkt)
+                      wkt_view const& wkt)
 {
     if (it != end)
     {
@@ -229,7 +245,7 @@ struct container_inserter
     template <typename OutputIterator>
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             wkt_view const& wkt,
                              OutputIterator out)
     {
         handle_open_parenthesis(it, end, wkt);
@@ -324,6 +340,19 @@ private:
     point_type first_point;
 };
 
+// Reserves memory for count more points, if the range supports it
+template <typename Range>
+inline auto reserve_points(Range& range, std::size_t count, int)
+    -> decltype(range.reserve(count), void())
+{
+    range.reserve(boost::size(range) + count);
+}
+
+template <typename Range>
+inline void reserve_points(Range& , std::size_t , long)
+{
+}
+
 // Geometry is a value-type or reference-type
 template <typename Geometry>
 struct container_appender
@@ -332,11 +361,16 @@ struct container_appender
 
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             wkt_view const& wkt,
                              Geometry out)
     {
         handle_open_parenthesis(it, end, wkt);
 
+        if (it != end)
+        {
+            reserve_points(out, point_count(it), 0);
+        }
+
         stateful_range_appender<Geometry> appender;
 
         // Parse points until closing parenthesis
@@ -369,7 +403,7 @@ struct point_parser
 {
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             wkt_view const& wkt,
                              P& point)
     {
         handle_open_parenthesis(it, end, wkt);
@@ -384,7 +418,7 @@ struct linestring_parser
 {
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             wkt_view const& wkt,
                              Geometry& geometry)
     {
         container_appender<Geometry&>::apply(it, end, wkt, geometry);
@@ -397,7 +431,7 @@ struct ring_parser
 {
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             wkt_view const& wkt,
                              Ring& ring)
     {
         // A ring should look like polygon((x y,x y,x y...))
@@ -422,7 +456,7 @@ struct polygon_parser
 
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             wkt_view const& wkt,
                              Polygon& poly)
     {
 
@@ -458,10 +492,10 @@ struct polygon_parser
 
 
 inline bool one_of(tokenizer::iterator const& it,
-                   std::string const& value,
+                   char const* value,
                    bool& is_present)
 {
-    if (boost::iequals(*it, value))
+    if (iequals(*it, value))
     {
         is_present = true;
         return true;
@@ -470,11 +504,11 @@ inline bool one_of(tokenizer::iterator const& it,
 }
 
 inline bool one_of(tokenizer::iterator const& it,
-                   std::string const& value,
+                   char const* value,
                    bool& present1,
                    bool& present2)
 {
-    if (boost::iequals(*it, value))
+    if (iequals(*it, value))
     {
         present1 = true;
         present2 = true;
@@ -538,10 +572,10 @@ struct dimension<Geometry, geometry_collection_tag>
 template <typename Geometry>
 inline bool initialize(tokenizer::iterator& it,
                        tokenizer::iterator const& end,
-                       std::string const& wkt,
-                       std::string const& geometry_name)
+                       wkt_view const& wkt,
+                       char const* geometry_name)
 {
-    if (it == end || ! boost::iequals(*it++, geometry_name))
+    if (it == end || ! iequals(*it++, geometry_name))
     {
         BOOST_THROW_EXCEPTION(read_wkt_exception(std::string("Should start with '") + geometry_name + "'", wkt));
     }
@@ -578,11 +612,11 @@ inline bool initialize(tokenizer::iterator& it,
 template <typename Geometry, template<typename> class Parser, typename PrefixPolicy>
 struct geometry_parser
 {
-    static inline void apply(std::string const& wkt, Geometry& geometry)
+    static inline void apply(wkt_view const& wkt, Geometry& geometry)
     {
         geometry::clear(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it = tokens.begin();
         tokenizer::iterator const end = tokens.end();
 
@@ -593,7 +627,7 @@ struct geometry_parser
 
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             wkt_view const& wkt,
                              Geometry& geometry)
     {
         if (initialize<Geometry>(it, end, wkt, PrefixPolicy::apply()))
@@ -607,11 +641,11 @@ struct geometry_parser
 template <typename MultiGeometry, template<typename> class Parser, typename PrefixPolicy>
 struct multi_parser
 {
-    static inline void apply(std::string const& wkt, MultiGeometry& geometry)
+    static inline void apply(wkt_view const& wkt, MultiGeometry& geometry)
     {
         traits::clear<MultiGeometry>::apply(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it = tokens.begin();
         tokenizer::iterator const end = tokens.end();
 
@@ -622,7 +656,7 @@ struct multi_parser
 
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             wkt_view const& wkt,
                              MultiGeometry& geometry)
     {
         if (initialize<MultiGeometry>(it, end, wkt, PrefixPolicy::apply()))
@@ -654,7 +688,7 @@ struct noparenthesis_point_parser
 {
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             wkt_view const& wkt,
                              P& point)
     {
         parsing_assigner<P>::apply(it, end, point, wkt);
@@ -664,11 +698,11 @@ struct noparenthesis_point_parser
 template <typename MultiGeometry, typename PrefixPolicy>
 struct multi_point_parser
 {
-    static inline void apply(std::string const& wkt, MultiGeometry& geometry)
+    static inline void apply(wkt_view const& wkt, MultiGeometry& geometry)
     {
         traits::clear<MultiGeometry>::apply(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it = tokens.begin();
         tokenizer::iterator const end = tokens.end();
 
@@ -679,7 +713,7 @@ struct multi_point_parser
 
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             wkt_view const& wkt,
                              MultiGeometry& geometry)
     {
         if (initialize<MultiGeometry>(it, end, wkt, PrefixPolicy::apply()))
@@ -733,9 +767,9 @@ struct multi_point_parser
 template <typename Box>
 struct box_parser
 {
-    static inline void apply(std::string const& wkt, Box& box)
+    static inline void apply(wkt_view const& wkt, Box& box)
     {
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it = tokens.begin();
         tokenizer::iterator end = tokens.end();
 
@@ -746,11 +780,11 @@ struct box_parser
 
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             wkt_view const& wkt,
                              Box& box)
     {
         bool should_close = false;
-        if (it != end && boost::iequals(*it, "POLYGON"))
+        if (it != end && iequals(*it, "POLYGON"))
         {
             ++it;
             bool has_empty, has_z, has_m;
@@ -763,7 +797,7 @@ struct box_parser
             handle_open_parenthesis(it, end, wkt);
             should_close = true;
         }
-        else if (it != end && boost::iequals(*it, "BOX"))
+        else if (it != end && iequals(*it, "BOX"))
         {
             ++it;
         }
@@ -813,9 +847,9 @@ struct box_parser
 template <typename Segment>
 struct segment_parser
 {
-    static inline void apply(std::string const& wkt, Segment& segment)
+    static inline void apply(wkt_view const& wkt, Segment& segment)
     {
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it = tokens.begin();
         tokenizer::iterator end = tokens.end();
 
@@ -826,10 +860,10 @@ struct segment_parser
 
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             wkt_view const& wkt,
                              Segment& segment)
     {
-        if (it != end && (boost::iequals(*it, "SEGMENT") || boost::iequals(*it, "LINESTRING")))
+        if (it != end && (iequals(*it, "SEGMENT") || iequals(*it, "LINESTRING")))
         {
             ++it;
         }
@@ -883,45 +917,45 @@ struct dynamic_readwkt_caller
 {
     static inline void apply(tokenizer::iterator& it,
                              tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             wkt_view const& wkt,
                              Geometry& geometry)
     {
-        if (boost::iequals(*it, "POINT"))
+        if (iequals(*it, "POINT"))
         {
             parse_geometry<util::is_point>("POINT", it, end, wkt, geometry);
         }
-        else if (boost::iequals(*it, "MULTIPOINT"))
+        else if (iequals(*it, "MULTIPOINT"))
         {
             parse_geometry<util::is_multi_point>("MULTIPOINT", it, end, wkt, geometry);
         }
-        else if (boost::iequals(*it, "SEGMENT"))
+        else if (iequals(*it, "SEGMENT"))
         {
             parse_geometry<util::is_segment>("SEGMENT", it, end, wkt, geometry);
         }
-        else if (boost::iequals(*it, "LINESTRING"))
+        else if (iequals(*it, "LINESTRING"))
         {
             parse_geometry<util::is_linestring>("LINESTRING", it, end, wkt, geometry, false)
             || parse_geometry<util::is_segment>("LINESTRING", it, end, wkt, geometry);
         }
-        else if (boost::iequals(*it, "MULTILINESTRING"))
+        else if (iequals(*it, "MULTILINESTRING"))
         {
             parse_geometry<util::is_multi_linestring>("MULTILINESTRING", it, end, wkt, geometry);
         }
-        else if (boost::iequals(*it, "BOX"))
+        else if (iequals(*it, "BOX"))
         {
             parse_geometry<util::is_box>("BOX", it, end, wkt, geometry);
         }
-        else if (boost::iequals(*it, "POLYGON"))
+        else if (iequals(*it, "POLYGON"))
         {
             parse_geometry<util::is_polygon>("POLYGON", it, end, wkt, geometry, false)
             || parse_geometry<util::is_ring>("POLYGON", it, end, wkt, geometry, false)
             || parse_geometry<util::is_box>("POLYGON", it, end, wkt, geometry);
         }
-        else if (boost::iequals(*it, "MULTIPOLYGON"))
+        else if (iequals(*it, "MULTIPOLYGON"))
         {
             parse_geometry<util::is_multi_polygon>("MULTIPOLYGON", it, end, wkt, geometry);
         }
-        else if (boost::iequals(*it, "GEOMETRYCOLLECTION"))
+        else if (iequals(*it, "GEOMETRYCOLLECTION"))
         {
             parse_geometry<util::is_geometry_collection>("GEOMETRYCOLLECTION", it, end, wkt, geometry);
         }
@@ -946,7 +980,7 @@ private:
     static bool parse_geometry(const char * ,
                                tokenizer::iterator& it,
                                tokenizer::iterator const& end,
-                               std::string const& wkt,
+                               wkt_view const& wkt,
                                Geometry& geometry,
                                bool = true)
     {
@@ -968,7 +1002,7 @@ private:
     static bool parse_geometry(const char * name,
                                tokenizer::iterator& ,
                                tokenizer::iterator const& ,
-                               std::string const& wkt,
+                               wkt_view const& wkt,
                                Geometry& ,
                                bool throw_on_misfit = true)
     {
@@ -1082,9 +1116,9 @@ struct read_wkt<Segment, segment_tag>
 template <typename DynamicGeometry>
 struct read_wkt<DynamicGeometry, dynamic_geometry_tag>
 {
-    static inline void apply(std::string const& wkt, DynamicGeometry& dynamic_geometry)
+    static inline void apply(detail::wkt::wkt_view const& wkt, DynamicGeometry& dynamic_geometry)
     {
-        detail::wkt::tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        detail::wkt::tokenizer tokens(wkt);
         detail::wkt::tokenizer::iterator it = tokens.begin();
         detail::wkt::tokenizer::iterator end = tokens.end();
         if (it == end)
@@ -1107,11 +1141,11 @@ struct read_wkt<DynamicGeometry, dynamic_geometry_tag>
 template <typename Geometry>
 struct read_wkt<Geometry, geometry_collection_tag>
 {
-    static inline void apply(std::string const& wkt, Geometry& geometry)
+    static inline void apply(detail::wkt::wkt_view const& wkt, Geometry& geometry)
     {
         range::clear(geometry);
 
-        detail::wkt::tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        detail::wkt::tokenizer tokens(wkt);
         detail::wkt::tokenizer::iterator it = tokens.begin();
         detail::wkt::tokenizer::iterator const end = tokens.end();
 
@@ -1122,7 +1156,7 @@ struct read_wkt<Geometry, geometry_collection_tag>
 
     static inline void apply(detail::wkt::tokenizer::iterator& it,
                              detail::wkt::tokenizer::iterator const& end,
-                             std::string const& wkt,
+                             detail::wkt::wkt_view const& wkt,
                              Geometry& geometry)
     {
         if (detail::wkt::initialize<Geometry>(it, end, wkt, "GEOMETRYCOLLECTION"))
@@ -1169,6 +1203,45 @@ inline void read_wkt(std::string const& wkt, Geometry& geometry)
     dispatch::read_wkt<Geometry>::apply(wkt, geometry);
 }
 
+/*!
+\brief Parses OGC Well-Known Text (\ref WKT) from a range of characters into
+    a geometry (any geometry)
+\details The characters are parsed in place, they do not have to be copied
+    into a string or terminated, e.g. WKT in a larger buffer or in a memory
+    mapped file.
+\ingroup wkt
+\tparam Geometry \tparam_geometry
+\param first pointer to the first character of the \ref WKT
+\param last pointer past the last character of the \ref WKT
+\param geometry \param_geometry output geometry
+*/
+template <typename Geometry>
+inline void read_wkt(char const* first, char const* last, Geometry& geometry)
+{
+    geometry::concepts::check<Geometry>();
+    dispatch::read_wkt<Geometry>::apply(detail::wkt::wkt_view(first, last), geometry);
+}
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+/*!
+\brief Parses OGC Well-Known Text (\ref WKT) from a string view into
+    a geometry (any geometry)
+\ingroup wkt
+\tparam Geometry \tparam_geometry
+\param wkt string view of the \ref WKT
+\param geometry \param_geometry output geometry
+*/
+template
+<
+    typename StringView, typename Geometry,
+    std::enable_if_t<std::is_same<StringView, std::string_view>::value, int> = 0
+>
+inline void read_wkt(StringView const& wkt, Geometry& geometry)
+{
+    geometry::read_wkt(wkt.data(), wkt.data() + wkt.size(), geometry);
+}
+#endif
+
 /*!
 \brief Parses OGC Well-Known Text (\ref WKT) into a geometry (any geometry) and returns it
 \ingroup wkt
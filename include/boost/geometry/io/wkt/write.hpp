@@ -47,6 +47,7 @@
 #include <boost/geometry/geometries/ring.hpp>
 
 #include <boost/geometry/io/wkt/detail/prefix.hpp>
+#include <boost/geometry/io/wkt/detail/writer.hpp>
 
 #include <boost/geometry/strategies/io/cartesian.hpp>
 #include <boost/geometry/strategies/io/geographic.hpp>
@@ -72,8 +73,8 @@ namespace detail { namespace wkt
 template <typename P, int I, int Count>
 struct stream_coordinate
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os, P const& p)
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os, P const& p)
     {
         os << (I > 0 ? " " : "") << get<I>(p);
         stream_coordinate<P, I + 1, Count>::apply(os, p);
@@ -83,8 +84,8 @@ struct stream_coordinate
 template <typename P, int Count>
 struct stream_coordinate<P, Count, Count>
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>&, P const&)
+    template <typename OutputStream>
+    static inline void apply(OutputStream&, P const&)
     {}
 };
 
@@ -120,8 +121,8 @@ struct double_closing_parenthesis
 template <typename Point, typename Policy>
 struct wkt_point
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os, Point const& p, bool)
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os, Point const& p, bool)
     {
         os << Policy::apply() << "(";
         stream_coordinate<Point, 0, dimension<Point>::type::value>::apply(os, p);
@@ -142,8 +143,8 @@ template
 >
 struct wkt_range
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Range const& range, bool force_closure = ForceClosurePossible)
     {
         typedef typename boost::range_iterator<Range const>::type iterator_type;
@@ -215,8 +216,8 @@ struct wkt_sequence
 template <typename Polygon, typename PrefixPolicy>
 struct wkt_poly
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Polygon const& poly, bool force_closure)
     {
         typedef typename ring_type<Polygon const>::type ring;
@@ -242,8 +243,8 @@ struct wkt_poly
 template <typename Multi, typename StreamPolicy, typename PrefixPolicy>
 struct wkt_multi
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Multi const& geometry, bool force_closure)
     {
         os << PrefixPolicy::apply();
@@ -271,8 +272,8 @@ struct wkt_box
 {
     typedef typename point_type<Box>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Box const& box, bool force_closure)
     {
         // Convert to a clockwire ring, then stream.
@@ -296,8 +297,8 @@ struct wkt_box
             //assert_dimension<B, 2>();
         }
 
-        template <typename RingType, typename Char, typename Traits>
-        static inline void do_apply(std::basic_ostream<Char, Traits>& os,
+        template <typename RingType, typename OutputStream>
+        static inline void do_apply(OutputStream& os,
                     Box const& box)
         {
             RingType ring;
@@ -315,8 +316,8 @@ struct wkt_segment
 {
     typedef typename point_type<Segment>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Segment const& segment, bool)
     {
         // Convert to two points, then stream
@@ -605,6 +606,57 @@ inline std::string to_wkt(Geometry const& geometry, int significant_digits)
     return ss.str();
 }
 
+/*!
+\brief Writes a geometry as WKT to an output iterator
+\details The coordinates are formatted without iostreams, in the shortest
+    representation which is read back as the same value, or with the
+    specified number of significant digits
+\tparam Geometry \tparam_geometry
+\tparam OutputIterator output iterator of characters
+\param geometry \param_geometry
+\param out output iterator the characters are written to
+\param significant_digits If positive, the number of significant digits
+    of floating point coordinates
+\return Output iterator past the last written character
+\ingroup wkt
+*/
+template <typename Geometry, typename OutputIterator>
+inline OutputIterator write_wkt(Geometry const& geometry, OutputIterator out,
+                                int significant_digits = 0)
+{
+    concepts::check<Geometry const>();
+
+    typedef detail::wkt::iterator_output<OutputIterator> output_type;
+    detail::wkt::writer<output_type> writer(output_type(out), significant_digits);
+    dispatch::wkt<Geometry>::apply(writer, geometry,
+                                   ! util::is_ring<Geometry>::value);
+    return writer.output().iterator();
+}
+
+/*!
+\brief Appends a geometry as WKT to a string
+\details The coordinates are formatted without iostreams, in the shortest
+    representation which is read back as the same value, or with the
+    specified number of significant digits
+\tparam Geometry \tparam_geometry
+\param geometry \param_geometry
+\param str string the characters are appended to
+\param significant_digits If positive, the number of significant digits
+    of floating point coordinates
+\ingroup wkt
+*/
+template <typename Geometry>
+inline void write_wkt(Geometry const& geometry, std::string& str,
+                      int significant_digits = 0)
+{
+    concepts::check<Geometry const>();
+
+    detail::wkt::writer<detail::wkt::string_output> writer(
+        detail::wkt::string_output(str), significant_digits);
+    dispatch::wkt<Geometry>::apply(writer, geometry,
+                                   ! util::is_ring<Geometry>::value);
+}
+
 #if defined(_MSC_VER)
 #pragma warning(pop)  
 #endif
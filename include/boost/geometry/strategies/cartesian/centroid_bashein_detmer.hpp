@@ -163,6 +163,15 @@ private :
             , sum_x(calc_type())
             , sum_y(calc_type())
         {}
+
+        // Adds the segments of other sums, e.g. calculated concurrently
+        inline void merge(sums const& other)
+        {
+            count += other.count;
+            sum_a2 += other.sum_a2;
+            sum_x += other.sum_x;
+            sum_y += other.sum_y;
+        }
     };
 
 public :
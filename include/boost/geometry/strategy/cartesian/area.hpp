@@ -78,6 +78,12 @@ public :
             assert_dimension<Geometry, 2>();
         }
 
+        // Adds the segments of another state, e.g. calculated concurrently
+        inline void merge(state const& other)
+        {
+            sum += other.sum;
+        }
+
     private:
         inline return_type area() const
         {
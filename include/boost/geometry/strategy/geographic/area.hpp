@@ -138,6 +138,14 @@ public:
             , m_crosses_prime_meridian(0)
         {}
 
+        // Adds the segments of another state, e.g. calculated concurrently
+        inline void merge(state const& other)
+        {
+            m_excess_sum += other.m_excess_sum;
+            m_correction_sum += other.m_correction_sum;
+            m_crosses_prime_meridian += other.m_crosses_prime_meridian;
+        }
+
     private:
         inline return_type area(spheroid_constants const& spheroid_const) const
         {
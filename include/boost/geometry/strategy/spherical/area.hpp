@@ -77,6 +77,13 @@ public:
             , m_crosses_prime_meridian(0)
         {}
 
+        // Adds the segments of another state, e.g. calculated concurrently
+        inline void merge(state const& other)
+        {
+            m_sum += other.m_sum;
+            m_crosses_prime_meridian += other.m_crosses_prime_meridian;
+        }
+
     private:
         template <typename RadiusType>
         inline return_type area(RadiusType const& r) const
@@ -0,0 +1,189 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_UTIL_PARALLEL_HPP
+#define BOOST_GEOMETRY_UTIL_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+#include <boost/config.hpp>
+#include <boost/core/ignore_unused.hpp>
+
+#if defined(BOOST_HAS_THREADS) && ! defined(BOOST_GEOMETRY_DISABLE_THREADS)
+#define BOOST_GEOMETRY_DETAIL_PARALLEL_USE_THREADS
+#endif
+
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_USE_THREADS
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Execution policy requesting the parallel execution of an algorithm
+\details Algorithms taking this policy as the first argument split the work
+    among the requested number of threads. The result is the same as the
+    result of the sequential version of the algorithm. If threads are not
+    available (BOOST_HAS_THREADS is not defined or BOOST_GEOMETRY_DISABLE_THREADS
+    is defined) the algorithm is executed sequentially.
+*/
+class parallel_execution
+{
+public:
+    //! \param thread_count the number of threads, 0 means the number
+    //!     of hardware threads
+    explicit parallel_execution(std::size_t thread_count = 0)
+        : m_thread_count(thread_count)
+    {}
+
+    inline std::size_t thread_count() const
+    {
+        return m_thread_count;
+    }
+
+private:
+    std::size_t m_thread_count;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace parallel
+{
+
+
+template <typename T>
+struct is_execution_policy
+    : std::is_same<T, parallel_execution>
+{};
+
+
+// Returns the number of workers used to process count tasks
+inline std::size_t worker_count(parallel_execution const& policy,
+                                std::size_t count)
+{
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_USE_THREADS
+    std::size_t result = policy.thread_count();
+    if (result == 0)
+    {
+        result = std::thread::hardware_concurrency();
+    }
+    result = (std::min)(result, count);
+    return result > 0 ? result : 1;
+#else
+    boost::ignore_unused(policy, count);
+    return 1;
+#endif
+}
+
+
+// Calls function(index, worker) for all indexes in [0, count).
+// The indexes are distributed dynamically in chunks among the workers.
+// The worker identifier is in [0, worker_count(policy, count)) and may be
+// used to access per-worker data without synchronization.
+// The first exception thrown by function is rethrown by for_each_index,
+// the processing of remaining indexes is then stopped.
+template <typename Function>
+inline void for_each_index(parallel_execution const& policy,
+                           std::size_t count,
+                           Function const& function)
+{
+    std::size_t const workers = worker_count(policy, count);
+
+#ifdef BOOST_GEOMETRY_DETAIL_PARALLEL_USE_THREADS
+    if (workers > 1)
+    {
+        // A few chunks per worker to balance tasks of different cost
+        std::size_t const chunk = (std::max)(count / (workers * 8),
+                                             std::size_t(1));
+
+        std::atomic<std::size_t> next(0);
+        std::atomic<bool> stop(false);
+        std::exception_ptr exception;
+        std::mutex mutex;
+
+        auto const work = [&](std::size_t worker)
+        {
+            try
+            {
+                while (! stop.load(std::memory_order_relaxed))
+                {
+                    std::size_t const first = next.fetch_add(chunk);
+                    if (first >= count)
+                    {
+                        return;
+                    }
+                    std::size_t const last = (std::min)(first + chunk, count);
+                    for (std::size_t i = first; i < last; ++i)
+                    {
+                        function(i, worker);
+                    }
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (! exception)
+                {
+                    exception = std::current_exception();
+                }
+                stop = true;
+            }
+        };
+
+        std::vector<std::thread> threads;
+        try
+        {
+            threads.reserve(workers - 1);
+            for (std::size_t w = 1; w < workers; ++w)
+            {
+                threads.emplace_back(work, w);
+            }
+        }
+        catch (...)
+        {
+            // A thread could not be created, the remaining ones do the work
+        }
+
+        work(0);
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+
+        return;
+    }
+#endif
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        function(i, std::size_t(0));
+    }
+}
+
+
+}} // namespace detail::parallel
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_UTIL_PARALLEL_HPP
@@ -0,0 +1,245 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/accumulators.hpp>
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// The points of the rings of the polygons, each ring closed
+template <typename Polygons>
+std::vector<std::vector<typename bg::point_type<typename Polygons::value_type>::type> >
+ring_points(Polygons const& mpoly)
+{
+    std::vector<std::vector<typename bg::point_type<typename Polygons::value_type>::type> > result;
+    for (auto const& poly : mpoly)
+    {
+        result.emplace_back(poly.outer().begin(), poly.outer().end());
+        for (auto const& ring : poly.inners())
+        {
+            result.emplace_back(ring.begin(), ring.end());
+        }
+    }
+    return result;
+}
+
+// Adds the points from index first to last of the stream of rings
+template <typename Accumulator, typename Rings>
+void add_points(Accumulator& acc, Rings const& rings, std::size_t first, std::size_t last)
+{
+    std::size_t index = 0;
+    for (auto const& ring : rings)
+    {
+        for (auto const& point : ring)
+        {
+            if (index >= first && index < last)
+            {
+                acc.add(point);
+            }
+            index++;
+        }
+        if (index - 1 >= first && index - 1 < last)
+        {
+            acc.close_ring();
+        }
+    }
+}
+
+template <typename Accumulator, typename Rings>
+std::vector<Accumulator> chunked(Rings const& rings, std::size_t chunk_size,
+                                 Accumulator const& prototype)
+{
+    std::size_t count = 0;
+    for (auto const& ring : rings)
+    {
+        count += ring.size();
+    }
+
+    std::vector<Accumulator> result;
+    for (std::size_t first = 0; first < count; first += chunk_size)
+    {
+        result.push_back(prototype);
+        add_points(result.back(), rings, first, first + chunk_size);
+    }
+    return result;
+}
+
+template <typename Accumulator>
+Accumulator merged(std::vector<Accumulator> const& chunks, bool tree)
+{
+    if (! tree)
+    {
+        Accumulator result = chunks.front();
+        for (std::size_t i = 1; i < chunks.size(); i++)
+        {
+            result.merge(chunks[i]);
+        }
+        return result;
+    }
+
+    // Merges neighbours pairwise, as threads combining their results
+    std::vector<Accumulator> level = chunks;
+    while (level.size() > 1)
+    {
+        std::vector<Accumulator> next;
+        for (std::size_t i = 0; i < level.size(); i += 2)
+        {
+            next.push_back(level[i]);
+            if (i + 1 < level.size())
+            {
+                next.back().merge(level[i + 1]);
+            }
+        }
+        level.swap(next);
+    }
+    return level.front();
+}
+
+template <typename P>
+void test_areal(std::string const& caseid, std::string const& wkt)
+{
+    typedef bg::model::multi_polygon<bg::model::polygon<P> > multi_polygon;
+
+    multi_polygon mpoly;
+    bg::read_wkt(wkt, mpoly);
+
+    double const expected_area = bg::area(mpoly);
+    P expected_centroid;
+    bg::centroid(mpoly, expected_centroid);
+
+    auto const rings = ring_points(mpoly);
+    for (std::size_t chunk_size : {1, 2, 3, 5, 1000})
+    {
+        for (bool tree : {false, true})
+        {
+            auto const area_acc = merged(chunked(rings, chunk_size,
+                                         bg::area_accumulator<P>()), tree);
+            BOOST_CHECK_CLOSE(double(area_acc.area()), expected_area, 1e-9);
+
+            P origin = rings.front().front();
+            auto const centroid_acc = merged(chunked(rings, chunk_size,
+                                             bg::centroid_accumulator<P>(origin)), tree);
+            P centroid;
+            BOOST_CHECK(centroid_acc.centroid(centroid));
+            BOOST_CHECK_MESSAGE(bg::distance(centroid, expected_centroid) < 1e-9,
+                                caseid << " chunk size: " << chunk_size
+                                << " centroid: " << bg::wkt(centroid)
+                                << " expected: " << bg::wkt(expected_centroid));
+        }
+    }
+
+    // Rings streamed without closing point and without close_ring at the end
+    bg::area_accumulator<P> acc;
+    acc.add(rings.front().begin(), rings.front().end() - 1);
+    BOOST_CHECK_CLOSE(double(acc.area()),
+                      double(bg::area(mpoly.front().outer())), 1e-9);
+}
+
+template <typename P>
+void test_linear()
+{
+    typedef bg::model::multi_linestring<bg::model::linestring<P> > multi_linestring;
+
+    multi_linestring mls;
+    bg::read_wkt("MULTILINESTRING((0 0,3 4,3 8),(1 1,2 2),(5 5),(0 0,0 10,10 10,10 0))",
+                 mls);
+    double const expected = bg::length(mls);
+
+    std::vector<P> points;
+    std::vector<bool> ends;
+    for (auto const& ls : mls)
+    {
+        for (auto const& p : ls)
+        {
+            points.push_back(p);
+            ends.push_back(false);
+        }
+        ends.back() = true;
+    }
+
+    for (std::size_t chunk_size : {1, 2, 3, 4, 100})
+    {
+        std::vector<bg::length_accumulator<P> > chunks;
+        for (std::size_t i = 0; i < points.size(); i++)
+        {
+            if (i % chunk_size == 0)
+            {
+                chunks.emplace_back();
+            }
+            chunks.back().add(points[i]);
+            if (ends[i])
+            {
+                chunks.back().end_linestring();
+            }
+        }
+        BOOST_CHECK_CLOSE(double(merged(chunks, false).length()), expected, 1e-9);
+        BOOST_CHECK_CLOSE(double(merged(chunks, true).length()), expected, 1e-9);
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    test_areal<P>("square", "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)))");
+    test_areal<P>("holes",
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 2,1 1),"
+        "(5 5,8 5,8 7,5 5)),((20 0,20 3,25 3,20 0)))");
+    test_areal<P>("far", "MULTIPOLYGON(((100000 100000,100000 100010,"
+        "100013 100010,100011 100003,100000 100000)))");
+
+    test_linear<P>();
+}
+
+void test_spherical_geographic()
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > geo_point;
+    typedef bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > sph_point;
+
+    bg::model::polygon<geo_point> geo_poly;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 2))", geo_poly);
+    auto const geo_rings = ring_points(std::vector<bg::model::polygon<geo_point> >(1, geo_poly));
+    auto const geo_acc = merged(chunked(geo_rings, 3, bg::area_accumulator<geo_point>()), true);
+    BOOST_CHECK_CLOSE(geo_acc.area(), bg::area(geo_poly), 1e-9);
+
+    bg::model::polygon<sph_point> sph_poly;
+    bg::read_wkt("POLYGON((170 0,170 10,-170 10,-170 0,170 0))", sph_poly);
+    auto const sph_rings = ring_points(std::vector<bg::model::polygon<sph_point> >(1, sph_poly));
+    auto const sph_acc = merged(chunked(sph_rings, 2, bg::area_accumulator<sph_point>()), false);
+    BOOST_CHECK_CLOSE(sph_acc.area(), bg::area(sph_poly), 1e-9);
+
+    bg::model::linestring<geo_point> ls;
+    bg::read_wkt("LINESTRING(0 0,1 1,2 0,5 5)", ls);
+    bg::length_accumulator<geo_point> head, tail;
+    head.add(ls.begin(), ls.begin() + 2);
+    tail.add(ls.begin() + 2, ls.end());
+    head.merge(tail);
+    BOOST_CHECK_CLOSE(head.length(), bg::length(ls), 1e-9);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+
+    test_spherical_geographic();
+
+    return 0;
+}
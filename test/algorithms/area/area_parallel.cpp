@@ -0,0 +1,145 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/algorithms/reverse.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// A star shaped ring around (cx, cy), in the point order of the ring type
+template <typename Ring>
+Ring star(double cx, double cy, double radius, std::size_t count)
+{
+    typedef typename bg::point_type<Ring>::type point_type;
+
+    Ring ring;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const angle = -2.0 * bg::math::pi<double>() * double(i) / double(count);
+        double const r = radius * (i % 2 == 0 ? 1.0 : 0.7);
+        ring.push_back(point_type(cx + r * std::cos(angle), cy + r * std::sin(angle)));
+    }
+    bg::correct(ring);
+    return ring;
+}
+
+template <typename MultiPolygon>
+MultiPolygon polygons(std::size_t count, std::size_t ring_size)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename bg::ring_type<polygon_type>::type ring_type;
+
+    MultiPolygon result;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        polygon_type poly;
+        double const cx = double(i % 100) * 10.0;
+        double const cy = double(i / 100) * 10.0;
+        poly.outer() = star<ring_type>(cx, cy, 4.5, ring_size);
+        ring_type hole = star<ring_type>(cx, cy, 1.0, 8);
+        bg::reverse(hole);
+        poly.inners().push_back(hole);
+        result.push_back(poly);
+    }
+    return result;
+}
+
+template <typename Geometry>
+void test_geometry(std::string const& caseid, Geometry const& geometry,
+                   double tolerance = 1e-10)
+{
+    double const expected_area = bg::area(geometry);
+    double const expected_perimeter = bg::perimeter(geometry);
+
+    auto const area1 = bg::area(bg::parallel_execution(1), geometry);
+    auto const perimeter1 = bg::perimeter(bg::parallel_execution(1), geometry);
+
+    BOOST_CHECK_CLOSE(double(area1), expected_area, tolerance);
+    BOOST_CHECK_CLOSE(double(perimeter1), expected_perimeter, tolerance);
+
+    // The results do not depend on the number of threads
+    for (std::size_t threads = 0; threads <= 4; threads++)
+    {
+        BOOST_CHECK_MESSAGE(bg::area(bg::parallel_execution(threads), geometry) == area1,
+                            caseid << " area, threads: " << threads);
+        BOOST_CHECK_MESSAGE(bg::perimeter(bg::parallel_execution(threads), geometry) == perimeter1,
+                            caseid << " perimeter, threads: " << threads);
+    }
+}
+
+template <typename P, bool ClockWise, bool Closed>
+void test_all()
+{
+    typedef bg::model::polygon<P, ClockWise, Closed> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::ring<P, ClockWise, Closed> ring;
+
+    test_geometry("many", polygons<multi_polygon>(5000, 20));
+    test_geometry("large", polygons<multi_polygon>(3, 50000));
+    test_geometry("ring", star<ring>(0, 0, 10, 100001));
+    test_geometry("polygon", polygons<multi_polygon>(1, 3000).front());
+    test_geometry("empty", multi_polygon());
+
+    polygon poly;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 2))", poly);
+    test_geometry("small", poly);
+
+    // Other geometries are calculated sequentially
+    bg::model::box<P> box(P(0, 0), P(3, 4));
+    BOOST_CHECK_CLOSE(bg::area(bg::parallel_execution(2), box), 12.0, 1e-10);
+}
+
+void test_geographic()
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+    typedef bg::model::polygon<point_type> polygon;
+
+    polygon poly;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 2))", poly);
+    test_geometry("geographic", poly);
+
+    // Dense segments, calculated in blocks
+    polygon dense;
+    for (std::size_t i = 0; i < 4000; i++)
+    {
+        double const t = double(i % 1000) / 100.0;
+        double const corners[4][2] = { {0, 0}, {0, 10}, {10, 10}, {10, 0} };
+        double const* c1 = corners[i / 1000];
+        double const* c2 = corners[(i / 1000 + 1) % 4];
+        dense.outer().push_back(point_type(c1[0] + (c2[0] - c1[0]) * t / 10.0,
+                                           c1[1] + (c2[1] - c1[1]) * t / 10.0));
+    }
+    bg::correct(dense);
+    test_geometry("geographic_dense", dense, 1e-8);
+
+    bg::strategy::area::geographic<> strategy;
+    BOOST_CHECK_CLOSE(bg::area(bg::parallel_execution(2), poly, strategy),
+                      bg::area(poly, strategy), 1e-10);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double>, true, true>();
+    test_all<bg::model::d2::point_xy<double>, false, false>();
+    test_all<bg::model::point<float, 2, bg::cs::cartesian>, true, true>();
+
+    test_geographic();
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/convex_hull.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Points in a disc or a square, deterministically scattered
+template <typename MultiPoint>
+MultiPoint scattered_points(std::size_t count, bool disc, double scale = 1000.0)
+{
+    typedef typename bg::point_type<MultiPoint>::type point_type;
+
+    MultiPoint result;
+    unsigned long state = 12345;
+    auto const next = [&state]()
+    {
+        state = (state * 1103515245ul + 12345ul) % 2147483648ul;
+        return double(state) / 2147483648.0;
+    };
+    while (result.size() < count)
+    {
+        double const x = next() * 2 - 1;
+        double const y = next() * 2 - 1;
+        if (! disc || x * x + y * y <= 1)
+        {
+            result.push_back(point_type(std::floor(x * scale), std::floor(y * scale)));
+        }
+    }
+    return result;
+}
+
+template <typename Geometry>
+std::string wkt_string(Geometry const& geometry)
+{
+    std::ostringstream out;
+    out << bg::wkt(geometry);
+    return out.str();
+}
+
+template <typename Hull, typename Geometry>
+void test_geometry(std::string const& caseid, Geometry const& geometry)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+
+    Hull expected;
+    bg::convex_hull(geometry, expected);
+
+    for (std::size_t threads = 0; threads <= 3; threads++)
+    {
+        Hull hull;
+        bg::convex_hull(bg::parallel_execution(threads), geometry, hull);
+        BOOST_CHECK_MESSAGE(wkt_string(hull) == wkt_string(expected),
+                            caseid << " threads: " << threads
+                            << " hull: " << wkt_string(hull)
+                            << " expected: " << wkt_string(expected));
+    }
+
+    for (std::size_t block_size : {10, 100, 65536})
+    {
+        bg::convex_hull_stream<point_type> stream(
+            typename bg::convex_hull_stream<point_type>::strategy_type(),
+            block_size);
+        stream.add(boost::begin(geometry), boost::end(geometry));
+
+        Hull hull;
+        stream.hull(hull);
+        BOOST_CHECK_MESSAGE(wkt_string(hull) == wkt_string(expected),
+                            caseid << " block size: " << block_size
+                            << " hull: " << wkt_string(hull)
+                            << " expected: " << wkt_string(expected));
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::multi_point<P> multi_point;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::ring<P, false, false> ring_ccw_open;
+
+    test_geometry<polygon>("disc", scattered_points<multi_point>(200000, true));
+    test_geometry<polygon>("square", scattered_points<multi_point>(200000, false));
+    test_geometry<ring_ccw_open>("disc_ccw", scattered_points<multi_point>(50000, true));
+    // many points on the hull
+    test_geometry<polygon>("dense", scattered_points<multi_point>(100000, false, 10.0));
+
+    multi_point circle;
+    for (int i = 0; i < 10000; i++)
+    {
+        circle.push_back(P(std::cos(i * 0.001) * 100, std::sin(i * 0.001) * 100));
+    }
+    test_geometry<polygon>("circle", circle);
+
+    multi_point mp;
+    bg::read_wkt("MULTIPOINT((1 0),(5 0),(3 0),(4 0),(2 0))", mp);
+    test_geometry<polygon>("collinear", mp);
+    bg::read_wkt("MULTIPOINT((1 0))", mp);
+    test_geometry<polygon>("single", mp);
+    bg::read_wkt("MULTIPOINT((1 0),(1 0),(2 2))", mp);
+    test_geometry<polygon>("two", mp);
+
+    linestring ls;
+    bg::read_wkt("LINESTRING(0 0,10 10,20 0,30 10,15 5,0 10)", ls);
+    test_geometry<polygon>("linestring", ls);
+
+    // other geometries are processed sequentially
+    polygon poly, hull;
+    bg::read_wkt("POLYGON((0 0,0 5,2 3,5 5,5 0,0 0))", poly);
+    bg::convex_hull(bg::parallel_execution(2), poly, hull);
+    BOOST_CHECK_EQUAL(wkt_string(hull), "POLYGON((0 0,0 5,5 5,5 0,0 0))");
+}
+
+void test_geographic()
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+    typedef bg::model::multi_point<point_type> multi_point;
+
+    test_geometry<bg::model::polygon<point_type> >("geographic",
+        scattered_points<multi_point>(20000, true, 10.0));
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::point<int, 2, bg::cs::cartesian> >();
+    test_geographic();
+
+    return 0;
+}
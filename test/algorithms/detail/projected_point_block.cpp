@@ -0,0 +1,122 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/closest_points.hpp>
+#include <boost/geometry/algorithms/detail/distance/projected_point_block.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/simplify.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Point>
+std::vector<Point> noisy_line(std::size_t count)
+{
+    std::vector<Point> result;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const t = i * 0.1;
+        result.push_back(Point(t * 3.0 + std::sin(t * 7.0), std::cos(t * 2.3) * 5.0 + t));
+    }
+    return result;
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    // the points of a deque are not contiguous, the strategy is used
+    typedef bg::model::linestring<P, std::deque> deque_linestring;
+    typedef bg::model::point<double, 2, bg::cs::cartesian> query_point;
+
+    typedef bg::strategy::distance::projected_point
+        <
+            void, bg::strategy::distance::comparable::pythagoras<void>
+        > comparable_strategy;
+    BOOST_CHECK((bg::detail::distance::use_projected_point_block
+        <
+            typename linestring::const_iterator, comparable_strategy
+        >::value));
+    BOOST_CHECK((! bg::detail::distance::use_projected_point_block
+        <
+            typename deque_linestring::const_iterator, comparable_strategy
+        >::value));
+
+    for (std::size_t count : {2, 3, 4, 5, 6, 7, 8, 9, 100, 1001})
+    {
+        std::vector<P> const points = noisy_line<P>(count);
+        linestring const ls(points.begin(), points.end());
+        deque_linestring const dls(points.begin(), points.end());
+
+        for (int k = 0; k < 50; k++)
+        {
+            query_point const p(std::sin(k * 1.7) * 20.0 + k, std::cos(k * 0.9) * 20.0);
+
+            double const d = bg::distance(p, ls);
+            double const expected = bg::distance(p, dls);
+            BOOST_CHECK_MESSAGE(d == expected,
+                                "count: " << count << " k: " << k
+                                << " distance: " << d << " expected: " << expected);
+
+            bg::model::segment<query_point> s, expected_s;
+            bg::closest_points(p, ls, s);
+            bg::closest_points(p, dls, expected_s);
+            BOOST_CHECK((bg::get<1, 0>(s) == bg::get<1, 0>(expected_s)
+                         && bg::get<1, 1>(s) == bg::get<1, 1>(expected_s)));
+        }
+
+        // a point of the line has distance zero, the first segment is used
+        BOOST_CHECK_EQUAL(bg::distance(points[count / 2], ls), 0.0);
+
+        for (double max_distance : {0.01, 0.3, 1.0, 3.0})
+        {
+            linestring simplified;
+            deque_linestring expected;
+            bg::simplify(ls, simplified, max_distance);
+            bg::simplify(dls, expected, max_distance);
+            BOOST_CHECK_EQUAL(simplified.size(), expected.size());
+            BOOST_CHECK(std::equal(simplified.begin(), simplified.end(), expected.begin(),
+                                   [](P const& p1, P const& p2)
+                                   {
+                                       return bg::get<0>(p1) == bg::get<0>(p2)
+                                           && bg::get<1>(p1) == bg::get<1>(p2);
+                                   }));
+        }
+    }
+
+    // collinear and degenerate segments
+    std::vector<P> points;
+    for (int i = 0; i < 20; i++)
+    {
+        points.push_back(P(i / 2, 0));
+    }
+    linestring const ls(points.begin(), points.end());
+    deque_linestring const dls(points.begin(), points.end());
+    for (int k = -2; k < 12; k++)
+    {
+        query_point const p(k, k % 3);
+        BOOST_CHECK_EQUAL(bg::distance(p, ls), bg::distance(p, dls));
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::d2::point_xy<float> >();
+
+    return 0;
+}
@@ -0,0 +1,260 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/is_simple.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/detail/overlay/self_turn_points.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_sweep.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
+#include <boost/geometry/strategies/cartesian.hpp>
+
+
+// Zigzag along the x axis, for rings closed along another zigzag above,
+// in the same phase or in the opposite one
+std::string zigzag_wkt(std::string const& type, int count,
+                       bool closed = false, double offset = 0,
+                       bool opposite = false)
+{
+    std::ostringstream out;
+    out << type << (closed ? "((0 0," : "(");
+    if (closed)
+    {
+        for (int i = 0; i <= count; i++)
+        {
+            out << i << " " << offset + ((i + (opposite ? 1 : 0)) % 2) * 2 << ",";
+        }
+    }
+    for (int i = count; i >= 0; i--)
+    {
+        out << i << " " << (i % 2) * 2 << (i > 0 ? "," : "");
+    }
+    out << (closed ? "))" : ")");
+    return out.str();
+}
+
+template <typename Sections>
+struct pairs_visitor
+{
+    template <typename Section>
+    bool apply(Section const& sec1, Section const& sec2)
+    {
+        if (! bg::disjoint(sec1.bounding_box, sec2.bounding_box))
+        {
+            pairs.insert(std::make_pair(std::min(key(sec1), key(sec2)),
+                                        std::max(key(sec1), key(sec2))));
+        }
+        return true;
+    }
+
+    template <typename Section>
+    static std::pair<bg::signed_size_type, bg::signed_size_type>
+        key(Section const& section)
+    {
+        return std::make_pair(section.ring_id.ring_index, section.begin_index);
+    }
+
+    typedef std::pair<bg::signed_size_type, bg::signed_size_type> key_type;
+    std::set<std::pair<key_type, key_type> > pairs;
+};
+
+template <typename Geometry>
+void test_pairs(std::string const& caseid, Geometry const& geometry)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef bg::model::box<point_type> box_type;
+    typedef bg::sections<box_type, 2> sections_type;
+    typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
+
+    bg::strategies::relate::cartesian<> strategy;
+
+    sections_type sections;
+    bg::sectionalize<false, dimensions>(geometry, bg::detail::no_rescale_policy(),
+                                        sections, strategy);
+
+    pairs_visitor<sections_type> partition_visitor, sweep_visitor;
+    bg::detail::section::visit_overlapping_sections<box_type>(sections,
+        partition_visitor, strategy);
+    bg::detail::section::visit_overlapping_sections<box_type>(sections,
+        sweep_visitor, bg::with_plane_sweep(strategy));
+
+    BOOST_CHECK_MESSAGE(partition_visitor.pairs == sweep_visitor.pairs,
+                        caseid << " pairs: " << sweep_visitor.pairs.size()
+                        << " expected: " << partition_visitor.pairs.size());
+}
+
+template <typename Geometry>
+std::size_t self_turn_count(Geometry const& geometry)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef bg::detail::overlay::turn_info<point_type> turn_info;
+
+    bg::strategies::relate::cartesian<> strategy;
+    std::vector<turn_info> turns;
+    bg::detail::self_get_turn_points::no_interrupt_policy policy;
+
+    bg::self_turns<bg::detail::overlay::assign_null_policy>(geometry,
+        bg::with_plane_sweep(strategy), bg::detail::no_rescale_policy(),
+        turns, policy);
+    std::size_t const count = turns.size();
+
+    turns.clear();
+    bg::self_turns<bg::detail::overlay::assign_null_policy>(geometry,
+        strategy, bg::detail::no_rescale_policy(), turns, policy);
+
+    BOOST_CHECK_EQUAL(count, turns.size());
+    return count;
+}
+
+template <typename Geometry>
+void test_linear(std::string const& caseid, std::string const& wkt,
+                 bool expected)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bg::strategies::relate::cartesian<> strategy;
+
+    BOOST_CHECK_MESSAGE(bg::is_simple(geometry, bg::with_plane_sweep(strategy)) == expected,
+                        caseid << " is_simple expected: " << expected);
+    BOOST_CHECK_EQUAL(bg::is_simple(geometry, strategy), expected);
+
+    test_pairs(caseid, geometry);
+}
+
+template <typename Geometry>
+void test_areal(std::string const& caseid, std::string const& wkt,
+                bool expected)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bg::strategies::relate::cartesian<> strategy;
+
+    // the reported turn can be another one, the failure is the same
+    bg::validity_failure_type failure, sweep_failure;
+    std::string message;
+    bool const valid = bg::is_valid(geometry, failure);
+    bool const sweep_valid = bg::is_valid(geometry, sweep_failure,
+                                          bg::with_plane_sweep(strategy));
+    bg::is_valid(geometry, message, bg::with_plane_sweep(strategy));
+
+    BOOST_CHECK_MESSAGE(sweep_valid == expected && valid == expected,
+                        caseid << " is_valid expected: " << expected
+                        << " detected: " << sweep_valid << " " << message);
+    BOOST_CHECK_EQUAL(sweep_failure, failure);
+
+    test_pairs(caseid, geometry);
+    self_turn_count(geometry);
+}
+
+template <typename Sections>
+struct count_visitor
+{
+    template <typename Section>
+    bool apply(Section const&, Section const&)
+    {
+        ++count;
+        return true;
+    }
+
+    std::size_t count = 0;
+};
+
+// Finds the pairs of sections of a zigzag along the y axis, all crossed by
+// the sweep line at once, and returns the duration
+template <typename P>
+double sweep_duration(int count)
+{
+    typedef bg::model::box<P> box_type;
+    typedef bg::sections<box_type, 2> sections_type;
+    typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
+
+    bg::model::linestring<P> ls;
+    for (int i = 0; i < count; i++)
+    {
+        ls.push_back(P(i % 2, i));
+    }
+
+    bg::strategies::relate::cartesian<> strategy;
+    sections_type sections;
+    bg::sectionalize<false, dimensions>(ls, bg::detail::no_rescale_policy(),
+                                        sections, strategy);
+
+    count_visitor<sections_type> visitor;
+    auto const start = std::chrono::steady_clock::now();
+    bg::detail::section::visit_overlapping_sections<box_type>(sections,
+        visitor, bg::with_plane_sweep(strategy));
+    auto const finish = std::chrono::steady_clock::now();
+
+    // Each section overlaps the next one
+    BOOST_CHECK_EQUAL(visitor.count, sections.size() - 1);
+    return std::chrono::duration<double>(finish - start).count();
+}
+
+// The active sections overlapping a section are found without scanning the
+// others, the duration is not quadratic (64 times longer)
+template <typename P>
+void test_complexity()
+{
+    double const small = sweep_duration<P>(5000);
+    double const large = sweep_duration<P>(40000);
+    BOOST_CHECK_MESSAGE(large < 24 * small + 0.01,
+                        "sweep durations: " << small << " " << large);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+
+    test_linear<linestring>("ls_simple", zigzag_wkt("LINESTRING", 1000), true);
+    test_linear<linestring>("ls_closed",
+        "LINESTRING(0 0,0 10,10 10,10 0,0 0)", true);
+    test_linear<linestring>("ls_self_crossing",
+        "LINESTRING(0 0,10 10,10 0,0 10)", false);
+    test_linear<linestring>("ls_zigzag_crossing",
+        zigzag_wkt("LINESTRING", 1000).replace(11, 0, "0 1,"), false);
+
+    test_areal<polygon>("ring_zigzag", zigzag_wkt("POLYGON", 1000, true, 3), true);
+    test_areal<polygon>("ring_close", zigzag_wkt("POLYGON", 1000, true, 1), true);
+    // the zigzags touch each other
+    test_areal<polygon>("ring_touching", zigzag_wkt("POLYGON", 1000, true, 2, true), false);
+    // the zigzags cross each other
+    test_areal<polygon>("ring_crossing", zigzag_wkt("POLYGON", 1000, true, 1, true), false);
+    test_areal<polygon>("spike",
+        "POLYGON((0 0,0 10,10 10,10 5,15 5,10 5,10 0,0 0))", false);
+
+    test_pairs("vertical_zigzag",
+        bg::from_wkt<linestring>("LINESTRING(0 0,1 1,0 2,1 3,0 4,1 5,0 6,1 7,1 0)"));
+
+    test_complexity<P>();
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
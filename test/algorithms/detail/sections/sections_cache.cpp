@@ -0,0 +1,284 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstddef>
+#include <utility>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/relate.hpp>
+#include <boost/geometry/algorithms/relation.hpp>
+#include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
+#include <boost/geometry/algorithms/detail/sections/sections_cache.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/cartesian.hpp>
+
+
+template <typename Polygon>
+std::vector<Polygon> make_tiles(double size, int count)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+
+    std::vector<Polygon> result;
+    for (int i = 0; i < count; i++)
+    {
+        for (int j = 0; j < count; j++)
+        {
+            double const x = i * size;
+            double const y = j * size;
+            Polygon tile;
+            bg::append(tile.outer(), point_type(x, y));
+            bg::append(tile.outer(), point_type(x, y + size));
+            bg::append(tile.outer(), point_type(x + size, y + size));
+            bg::append(tile.outer(), point_type(x + size, y));
+            bg::append(tile.outer(), point_type(x, y));
+            result.push_back(tile);
+        }
+    }
+    return result;
+}
+
+// Counts the boxes calculated and expanded, sectionalize calculates one of
+// them per segment
+std::size_t box_count = 0;
+
+template <typename Strategy>
+struct counting_box_strategy
+    : Strategy
+{
+    template <typename ...Args>
+    static inline void apply(Args&& ...args)
+    {
+        ++box_count;
+        Strategy::apply(std::forward<Args>(args)...);
+    }
+};
+
+struct counting_strategy
+    : bg::strategies::relate::cartesian<>
+{
+    typedef bg::strategies::relate::cartesian<> base_type;
+
+    template <typename Geometry, typename Box>
+    auto envelope(Geometry const& geometry, Box const& box) const
+    {
+        return counting_box_strategy
+            <
+                decltype(base_type::envelope(geometry, box))
+            >();
+    }
+
+    template <typename Box, typename Geometry>
+    auto expand(Box const& box, Geometry const& geometry) const
+    {
+        return counting_box_strategy
+            <
+                decltype(base_type::expand(box, geometry))
+            >();
+    }
+};
+
+// The cached geometry is not sectionalized again by get_turns without
+// rescaling, nor by relate if it doesn't rescale
+template <typename Geometry, typename Polygon>
+void test_reuse(Geometry const& geometry, std::vector<Polygon> const& tiles)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef bg::detail::no_rescale_policy rescale_policy_type;
+    typedef bg::detail::overlay::turn_info
+        <
+            point_type,
+            typename bg::detail::segment_ratio_type<point_type, rescale_policy_type>::type
+        > turn_info;
+
+    // Areal geometries are rescaled by relate, which doesn't use the cache
+    bool const relate_uses_cache = std::is_same
+        <
+            typename bg::rescale_overlay_policy_type<Geometry, Polygon>::type,
+            rescale_policy_type
+        >::value;
+
+    std::size_t& count = box_count;
+    counting_strategy const strategy;
+
+    // Boxes calculated to sectionalize the geometry
+    count = 0;
+    {
+        bg::sections_cache<Geometry> cache(geometry);
+        cache.template get<false>(strategy);
+    }
+    std::size_t const sectionalize_count = count;
+    BOOST_CHECK_GT(sectionalize_count, 0u);
+
+    bg::sections_cache<Geometry> cache(geometry);
+    for (Polygon const& tile : tiles)
+    {
+        std::vector<turn_info> turns, cached_turns;
+        bg::detail::get_turns::no_interrupt_policy policy;
+
+        count = 0;
+        bg::get_turns<false, false, bg::detail::overlay::assign_null_policy>(
+            geometry, tile, strategy, rescale_policy_type(), turns, policy);
+        std::size_t const uncached_count = count;
+
+        count = 0;
+        bg::get_turns<false, false, bg::detail::overlay::assign_null_policy>(
+            geometry, tile, bg::with_sections_cache(strategy, cache),
+            rescale_policy_type(), cached_turns, policy);
+
+        // Only the first call sectionalizes the geometry
+        BOOST_CHECK_EQUAL(count, &tile == &tiles.front()
+                                 ? uncached_count
+                                 : uncached_count - sectionalize_count);
+        BOOST_CHECK_EQUAL(cached_turns.size(), turns.size());
+
+        count = 0;
+        bool const expected = bg::relate(geometry, tile,
+                                         bg::de9im::mask("T********"), strategy);
+        std::size_t const uncached_relate_count = count;
+
+        count = 0;
+        bool const detected = bg::relate(geometry, tile, bg::de9im::mask("T********"),
+                                         bg::with_sections_cache(strategy, cache));
+        BOOST_CHECK_EQUAL(detected, expected);
+        BOOST_CHECK_EQUAL(count, relate_uses_cache
+                                 ? uncached_relate_count - sectionalize_count
+                                 : uncached_relate_count);
+
+        // Intersects doesn't rescale, also not for areal geometries
+        count = 0;
+        bool const intersects = bg::intersects(geometry, tile, strategy);
+        std::size_t const uncached_intersects_count = count;
+
+        count = 0;
+        BOOST_CHECK_EQUAL(bg::intersects(geometry, tile,
+                                         bg::with_sections_cache(strategy, cache)),
+                          intersects);
+        BOOST_CHECK_EQUAL(count, uncached_intersects_count - sectionalize_count);
+    }
+
+    // The sections are created again with another type of strategy
+    bg::strategies::relate::cartesian<> const other_strategy;
+    cache.template get<false>(other_strategy);
+    count = 0;
+    cache.template get<false>(strategy);
+    BOOST_CHECK_EQUAL(count, sectionalize_count);
+    count = 0;
+    cache.template get<false>(strategy);
+    BOOST_CHECK_EQUAL(count, 0u);
+}
+
+template <typename Geometry, typename Polygon>
+void test_geometry(std::string const& caseid, std::string const& wkt,
+                   std::vector<Polygon> const& tiles)
+{
+    typedef bg::strategies::relate::cartesian<> strategy_type;
+
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bg::sections_cache<Geometry> cache(geometry);
+    strategy_type strategy;
+
+    for (Polygon const& tile : tiles)
+    {
+        bool const d = bg::disjoint(geometry, tile, strategy);
+        bool const d1 = bg::disjoint(geometry, tile, bg::with_sections_cache(strategy, cache));
+        bool const d2 = bg::disjoint(tile, geometry, bg::with_sections_cache(strategy, cache));
+        bool const i1 = bg::intersects(geometry, tile, bg::with_sections_cache(strategy, cache));
+
+        BOOST_CHECK_MESSAGE(d == d1 && d == d2 && d == ! i1,
+                            caseid << " disjoint: " << d << " " << d1
+                            << " " << d2 << " " << i1);
+
+        std::string const m = bg::relation(geometry, tile, strategy).str();
+        std::string const m1 = bg::relation(geometry, tile,
+                                  bg::with_sections_cache(strategy, cache)).str();
+        std::string const m2 = bg::relation(tile, geometry,
+                                  bg::with_sections_cache(strategy, cache)).str();
+        BOOST_CHECK_MESSAGE(m == m1 && m2 == bg::relation(tile, geometry, strategy).str(),
+                            caseid << " relation: " << m << " " << m1 << " " << m2);
+
+        bool const r1 = bg::relate(geometry, tile, bg::de9im::mask("T********"),
+                                   bg::with_sections_cache(strategy, cache));
+        BOOST_CHECK_EQUAL(r1, m[0] != 'F');
+    }
+
+    // The sections were created at the first call and are reused
+    BOOST_CHECK(! cache.template get<false>(strategy).empty());
+    BOOST_CHECK(&cache.template get<false>(strategy)
+                == &cache.template get<false>(strategy));
+
+    cache.clear();
+    BOOST_CHECK(bg::is_valid(geometry, bg::with_sections_cache(strategy, cache)));
+
+    test_reuse(geometry, tiles);
+}
+
+template <typename Polygon>
+void test_areal(std::string const& caseid, std::string const& wkt,
+                std::vector<Polygon> const& tiles)
+{
+    typedef bg::strategies::relate::cartesian<> strategy_type;
+
+    Polygon geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bg::sections_cache<Polygon> cache(geometry);
+    strategy_type strategy;
+
+    for (Polygon const& tile : tiles)
+    {
+        bg::model::multi_polygon<Polygon> expected, detected;
+        bg::intersection(geometry, tile, expected, strategy);
+        bg::intersection(geometry, tile, detected,
+                         bg::with_sections_cache(strategy, cache));
+
+        BOOST_CHECK_CLOSE(bg::area(expected) + 1.0, bg::area(detected) + 1.0, 0.0001);
+    }
+
+    test_geometry<Polygon>(caseid, wkt, tiles);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+
+    std::vector<polygon> const tiles = make_tiles<polygon>(2.0, 6);
+
+    test_geometry<linestring>("zigzag",
+        "LINESTRING(0.5 0.5,3 9,4.5 0.5,6 11,7.5 0.5,9.5 11.5)", tiles);
+    test_geometry<multi_linestring>("multi",
+        "MULTILINESTRING((0.5 0.5,3 9,4.5 0.5),(6 11,7.5 0.5,9.5 11.5))", tiles);
+
+    test_areal<polygon>("star",
+        "POLYGON((1 1,3 6,1 11,6 9,11 11,9 6,11 1,6 3,1 1),(5 5,7 5,7 7,5 7,5 5))",
+        tiles);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
@@ -0,0 +1,196 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/closest_points.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/distance_index.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Points in the square [-scale, scale] deterministically scattered
+template <typename MultiPoint>
+MultiPoint scattered_points(std::size_t count, double scale)
+{
+    typedef typename bg::point_type<MultiPoint>::type point_type;
+
+    MultiPoint result;
+    unsigned long state = 12345;
+    auto const next = [&state]()
+    {
+        state = (state * 1103515245ul + 12345ul) % 2147483648ul;
+        return double(state) / 2147483648.0;
+    };
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const x = (next() * 2 - 1) * scale;
+        double const y = (next() * 2 - 1) * scale;
+        result.push_back(point_type(x, y));
+    }
+    return result;
+}
+
+template <typename Geometry, typename MultiPoint>
+void test_distances(std::string const& caseid, Geometry const& geometry,
+                    MultiPoint const& points)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef bg::model::segment<point_type> segment_type;
+
+    bg::distance_index<Geometry> const index(geometry);
+
+    std::vector<double> expected;
+    for (auto const& point : points)
+    {
+        expected.push_back(bg::distance(point, geometry));
+    }
+
+    for (std::size_t threads = 0; threads <= 3; threads++)
+    {
+        std::vector<double> distances(points.size(), -1.0);
+        index.batch_distance(bg::parallel_execution(threads), points, distances.begin());
+        for (std::size_t i = 0; i < points.size(); i++)
+        {
+            BOOST_CHECK_MESSAGE(bg::math::equals(distances[i], expected[i]),
+                                caseid << " threads: " << threads << " point: " << i
+                                << " distance: " << distances[i]
+                                << " expected: " << expected[i]);
+        }
+    }
+
+    std::vector<segment_type> segments(points.size());
+    index.batch_closest_points(bg::parallel_execution(2), points, segments.begin());
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        segment_type expected_segment;
+        bg::closest_points(points[i], geometry, expected_segment);
+        BOOST_CHECK_MESSAGE(bg::equals(segments[i].first, points[i])
+                            && bg::math::equals(bg::distance(segments[i].first,
+                                                             segments[i].second),
+                                                expected[i])
+                            && bg::distance(segments[i].second,
+                                            expected_segment.second) < 1e-9,
+                            caseid << " point: " << i
+                            << " closest points: " << bg::wkt(segments[i])
+                            << " expected: " << bg::wkt(expected_segment));
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::multi_point<P> multi_point;
+
+    multi_point const points = scattered_points<multi_point>(2000, 120.0);
+
+    // road network like grid of noisy lines
+    multi_linestring network;
+    for (int k = 0; k < 10; k++)
+    {
+        linestring horizontal, vertical;
+        for (int i = 0; i <= 200; i++)
+        {
+            double const noise = std::sin(i * 0.7 + k) * 2.0;
+            horizontal.push_back(P(i - 100.0, k * 20.0 - 90.0 + noise));
+            vertical.push_back(P(k * 20.0 - 90.0 + noise, i - 100.0));
+        }
+        network.push_back(horizontal);
+        network.push_back(vertical);
+    }
+    test_distances("network", network, points);
+    test_distances("linestring", network.front(), points);
+
+    multi_polygon mpoly;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 50,50 50,50 0,0 0),(10 10,40 10,40 40,10 40,10 10)),"
+                 "((-80 -80,-80 -20,-20 -20,-80 -80)))", mpoly);
+    test_distances("multi_polygon", mpoly, points);
+    test_distances("polygon", mpoly.front(), points);
+
+    // points on the boundary, on vertices and in line with vertices
+    multi_point aligned;
+    for (int x = -85; x <= 55; x += 5)
+    {
+        for (int y = -85; y <= 55; y += 5)
+        {
+            aligned.push_back(P(x, y));
+        }
+    }
+    test_distances("multi_polygon_aligned", mpoly, aligned);
+
+    // many vertices, the points inside are found with the segments
+    // below them
+    polygon star;
+    for (int i = 0; i <= 720; i++)
+    {
+        double const angle = -i * 3.14159265358979 / 360.0;
+        double const radius = 100.0 - (i % 2) * 40.0;
+        star.outer().push_back(P(radius * std::cos(angle), radius * std::sin(angle)));
+    }
+    star.outer().back() = star.outer().front();
+    star.inners().resize(1);
+    for (int i = 0; i <= 360; i++)
+    {
+        double const angle = i * 3.14159265358979 / 180.0;
+        star.inners().front().push_back(P(20.0 * std::cos(angle), 20.0 * std::sin(angle)));
+    }
+    star.inners().front().back() = star.inners().front().front();
+    test_distances("star", star, points);
+
+    multi_point const mp = scattered_points<multi_point>(500, 100.0);
+    test_distances("multi_point", mp, scattered_points<multi_point>(200, 110.0));
+
+    // single query, geometry not changing
+    bg::distance_index<linestring> const index(network.front());
+    BOOST_CHECK(! index.empty());
+    BOOST_CHECK_CLOSE(index.distance(P(0, 0)), bg::distance(P(0, 0), network.front()),
+                      1e-9);
+}
+
+void test_geographic()
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+    typedef bg::model::linestring<point_type> linestring;
+    typedef bg::model::multi_point<point_type> multi_point;
+
+    linestring ls;
+    for (int i = 0; i <= 100; i++)
+    {
+        ls.push_back(point_type(i * 0.1, std::sin(i * 0.3)));
+    }
+    multi_point const points = scattered_points<multi_point>(200, 10.0);
+
+    bg::distance_index<linestring> const index(ls);
+    std::vector<double> distances(points.size());
+    index.batch_distance(bg::parallel_execution(2), points, distances.begin());
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        BOOST_CHECK_CLOSE(distances[i], bg::distance(points[i], ls), 1e-9);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_geographic();
+
+    return 0;
+}
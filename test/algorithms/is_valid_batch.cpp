@@ -0,0 +1,125 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Geometry>
+void test_geometries(std::string const& caseid,
+                     std::vector<std::string> const& wkts,
+                     std::size_t expected_invalid)
+{
+    std::vector<Geometry> geometries;
+    for (std::string const& wkt : wkts)
+    {
+        Geometry geometry;
+        bg::read_wkt(wkt, geometry);
+        geometries.push_back(geometry);
+    }
+
+    std::vector<bg::validity_failure_type> expected;
+    for (Geometry const& geometry : geometries)
+    {
+        bg::validity_failure_type failure;
+        bg::is_valid(geometry, failure);
+        expected.push_back(failure);
+    }
+
+    std::vector<bg::validity_failure_type> failures(geometries.size());
+    BOOST_CHECK_EQUAL(bg::is_valid_batch(geometries, failures.begin()),
+                      expected_invalid);
+    BOOST_CHECK_MESSAGE(failures == expected, caseid << " sequential");
+
+    for (std::size_t threads = 0; threads <= 4; threads++)
+    {
+        bg::parallel_execution const policy(threads);
+
+        std::vector<std::uint8_t> compact(geometries.size(), 255);
+        BOOST_CHECK_EQUAL(bg::is_valid_batch(policy, geometries, compact.begin()),
+                          expected_invalid);
+        BOOST_CHECK_EQUAL(bg::is_valid_batch(policy, geometries, compact.begin(),
+                              bg::strategies::relate::cartesian<>()),
+                          expected_invalid);
+
+        for (std::size_t i = 0; i < geometries.size(); i++)
+        {
+            BOOST_CHECK_MESSAGE(compact[i] == static_cast<std::uint8_t>(expected[i]),
+                                caseid << " threads: " << threads
+                                << " item: " << i
+                                << " failure: " << int(compact[i])
+                                << " expected: " << expected[i]);
+        }
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    std::vector<std::string> polygons;
+    std::size_t invalid = 0;
+    for (int i = 0; i < 20; i++)
+    {
+        // valid
+        polygons.push_back("POLYGON((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 2,1 1))");
+        // spike
+        polygons.push_back("POLYGON((0 0,0 10,10 10,10 5,15 5,10 5,10 0,0 0))");
+        // self-intersections
+        polygons.push_back("POLYGON((0 0,0 10,10 0,10 10,0 0))");
+        // wrong orientation
+        polygons.push_back("POLYGON((0 0,10 0,10 10,0 10,0 0))");
+        // interior ring outside
+        polygons.push_back("POLYGON((0 0,0 10,10 10,10 0,0 0),(11 11,12 11,12 12,11 12,11 11))");
+        // nested interior rings
+        polygons.push_back("POLYGON((0 0,0 10,10 10,10 0,0 0),(1 1,9 1,9 9,1 9,1 1),(2 2,3 2,3 3,2 3,2 2))");
+        // disconnected interior
+        polygons.push_back("POLYGON((0 0,0 10,10 10,10 0,0 0),(0 5,5 0,10 5,5 10,0 5))");
+        // too few points
+        polygons.push_back("POLYGON((0 0,0 10,0 0))");
+        invalid += 7;
+    }
+    test_geometries<polygon>("polygons", polygons, invalid);
+
+    test_geometries<multi_polygon>("multi_polygons",
+        {
+            "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((20 20,20 30,30 30,30 20,20 20)))",
+            "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((5 5,5 30,30 30,30 5,5 5)))",
+            "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((2 2,2 3,3 3,3 2,2 2)))",
+            "MULTIPOLYGON()"
+        }, 2);
+
+    test_geometries<linestring>("linestrings",
+        {
+            "LINESTRING(0 0,10 10)",
+            "LINESTRING(0 0)",
+            "LINESTRING(0 0,10 10,5 5)",
+            "LINESTRING(0 0,10 10,10 0,0 10)"
+        }, 1);
+
+    test_geometries<polygon>("empty", {}, 0);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
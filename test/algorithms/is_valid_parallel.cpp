@@ -0,0 +1,136 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <sstream>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Squares with holes in rows, separated by gaps
+std::string grid_wkt(int count, std::string const& extra = "")
+{
+    std::ostringstream out;
+    out << "MULTIPOLYGON(";
+    for (int i = 0; i < count; i++)
+    {
+        int const x = (i % 10) * 4;
+        int const y = (i / 10) * 4;
+        out << (i > 0 ? "," : "")
+            << "((" << x << " " << y << "," << x << " " << y + 3 << ","
+            << x + 3 << " " << y + 3 << "," << x + 3 << " " << y << ","
+            << x << " " << y << "),"
+            << "(" << x + 1 << " " << y + 1 << "," << x + 2 << " " << y + 1 << ","
+            << x + 2 << " " << y + 2 << "," << x + 1 << " " << y + 2 << ","
+            << x + 1 << " " << y + 1 << "))";
+    }
+    out << extra << ")";
+    return out.str();
+}
+
+template <typename MultiPolygon>
+void test_geometry(std::string const& caseid, std::string const& wkt,
+                   bool expected)
+{
+    MultiPolygon geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bg::validity_failure_type failure = bg::no_failure;
+    std::string message;
+    bool const valid = bg::is_valid(geometry, failure);
+    bg::is_valid(geometry, message);
+
+    BOOST_CHECK_MESSAGE(valid == expected,
+                        caseid << " expected: " << expected
+                        << " detected: " << valid << " " << message);
+
+    for (std::size_t threads = 0; threads <= 4; threads++)
+    {
+        bg::parallel_execution const policy(threads);
+
+        bg::validity_failure_type parallel_failure = bg::no_failure;
+        std::string parallel_message;
+
+        BOOST_CHECK_EQUAL(bg::is_valid(policy, geometry), valid);
+        BOOST_CHECK_EQUAL(bg::is_valid(policy, geometry, parallel_failure), valid);
+        BOOST_CHECK_EQUAL(bg::is_valid(policy, geometry, parallel_message), valid);
+        BOOST_CHECK_EQUAL(bg::is_valid(policy, geometry,
+            bg::strategies::relate::cartesian<>()), valid);
+
+        BOOST_CHECK_MESSAGE(parallel_failure == failure,
+                            caseid << " threads: " << threads
+                            << " failure: " << parallel_failure
+                            << " expected: " << failure);
+        BOOST_CHECK_MESSAGE(parallel_message == message,
+                            caseid << " threads: " << threads
+                            << " message: " << parallel_message
+                            << " expected: " << message);
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    test_geometry<multi_polygon>("empty", "MULTIPOLYGON()", true);
+    test_geometry<multi_polygon>("single", grid_wkt(1), true);
+    test_geometry<multi_polygon>("grid", grid_wkt(100), true);
+
+    // touching at points
+    test_geometry<multi_polygon>("touch",
+        grid_wkt(100, ",((3 3,3 4,4 4,4 3,3 3))"), true);
+    // polygon inside the hole of another one
+    test_geometry<multi_polygon>("inside_hole",
+        grid_wkt(100, ",((41.2 41.2,41.2 41.8,41.8 41.8,41.8 41.2,41.2 41.2))"),
+        true);
+
+    // invalid ring, wrong orientation
+    test_geometry<multi_polygon>("orientation",
+        grid_wkt(100, ",((50 50,51 50,51 51,50 51,50 50))"), false);
+    // invalid rings in several polygons, the first one is reported
+    test_geometry<multi_polygon>("few_points",
+        grid_wkt(50, ",((50 50,50 51,50 50)),((60 60,60 61,61 61,61 60))"), false);
+    // crossing polygons
+    test_geometry<multi_polygon>("crossing",
+        grid_wkt(100, ",((2 2,2 6,6 6,6 2,2 2))"), false);
+    // shared edge
+    test_geometry<multi_polygon>("shared_edge",
+        grid_wkt(100, ",((3 0,3 3,3.5 3,3.5 0,3 0))"), false);
+    // polygon inside the interior of another one
+    test_geometry<multi_polygon>("nested",
+        grid_wkt(100, ",((12.1 12.1,12.1 12.9,12.9 12.9,12.9 12.1,12.1 12.1))"),
+        false);
+    // hole outside
+    test_geometry<multi_polygon>("hole_outside",
+        grid_wkt(100, ",((50 50,50 53,53 53,53 50,50 50),(54 54,55 54,55 55,54 55,54 54))"),
+        false);
+    // nested holes
+    test_geometry<multi_polygon>("nested_holes",
+        grid_wkt(100, ",((50 50,50 55,55 55,55 50,50 50),(51 51,54 51,54 54,51 54,51 51),(52 52,53 52,53 53,52 53,52 52))"),
+        false);
+    // disconnected interior
+    test_geometry<multi_polygon>("disconnected",
+        grid_wkt(100, ",((50 50,50 54,54 54,54 50,50 50),(50 52,52 50,54 52,52 54,50 52))"),
+        false);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Linestring>
+Linestring spiral(std::size_t count, double scale)
+{
+    typedef typename bg::point_type<Linestring>::type point_type;
+
+    Linestring result;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const t = double(i) * 0.01;
+        result.push_back(point_type(scale * t * std::cos(t) / double(count),
+                                    scale * t * std::sin(t) / double(count)));
+    }
+    return result;
+}
+
+template <typename Geometry>
+void test_geometry(std::string const& caseid, Geometry const& geometry,
+                   double tolerance = 1e-10)
+{
+    auto const expected = bg::length(geometry);
+    auto const length1 = bg::length(bg::parallel_execution(1), geometry);
+
+    BOOST_CHECK_CLOSE(double(length1), double(expected), tolerance);
+
+    // The result does not depend on the number of threads
+    for (std::size_t threads = 0; threads <= 4; threads++)
+    {
+        BOOST_CHECK_MESSAGE(bg::length(bg::parallel_execution(threads), geometry) == length1,
+                            caseid << " threads: " << threads);
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+
+    test_geometry("spiral", spiral<linestring>(100000, 1000.0));
+
+    multi_linestring many;
+    for (std::size_t i = 0; i < 3000; i++)
+    {
+        many.push_back(spiral<linestring>(10 + i % 50, 100.0));
+    }
+    many.push_back(spiral<linestring>(5000, 100.0));
+    many.push_back(linestring());
+    test_geometry("many", many);
+    test_geometry("empty", multi_linestring());
+
+    linestring ls;
+    bg::read_wkt("LINESTRING(0 0,3 4,3 8)", ls);
+    test_geometry("small", ls);
+
+    // Other geometries are calculated sequentially
+    bg::model::segment<P> seg(P(0, 0), P(3, 4));
+    BOOST_CHECK_CLOSE(double(bg::length(bg::parallel_execution(2), seg)), 5.0, 1e-10);
+}
+
+void test_geographic()
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+    typedef bg::model::linestring<point_type> linestring;
+
+    test_geometry("geographic", spiral<linestring>(5000, 2000.0));
+
+    bg::strategy::distance::andoyer<> strategy;
+    linestring const ls = spiral<linestring>(3000, 2000.0);
+    BOOST_CHECK_CLOSE(double(bg::length(bg::parallel_execution(2), ls, strategy)),
+                      double(bg::length(ls, strategy)), 1e-10);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::point<float, 2, bg::cs::cartesian> >();
+
+    test_geographic();
+
+    return 0;
+}
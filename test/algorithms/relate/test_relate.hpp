@@ -206,6 +206,36 @@ void check_geometry(Geometry1 const& geometry1,
                     << " -> Expected interrupt for:" << expected_interrupt);
             }
         }
+
+        // masks which may be satisfied before the analysis is finished
+        for (std::size_t i = 0 ; i < expected1.size() ; ++i)
+        {
+            char const c = expected1[i];
+            if ( c != 'F' && ( c < '0' || c > '9' ) )
+            {
+                continue;
+            }
+
+            std::string expected_satisfied(9, '*');
+            expected_satisfied[i] = 'T';
+            bool const expected = c != 'F';
+
+            bool result = bg::relate(geometry1, geometry2, bg::de9im::mask(expected_satisfied));
+            BOOST_CHECK_MESSAGE(result == expected,
+                "relate: " << wkt1
+                << " and " << wkt2
+                << " -> Expected " << (expected ? "" : "not ")
+                << "satisfied: " << expected_satisfied);
+        }
+
+        if ( expected1[0] == 'F' || ( expected1[0] >= '0' && expected1[0] <= '9' ) )
+        {
+            bool result = bg::relate(geometry1, geometry2, bg::de9im::static_mask<'T'>());
+            BOOST_CHECK_MESSAGE(result == (expected1[0] != 'F'),
+                "relate: " << wkt1
+                << " and " << wkt2
+                << " -> Expected static mask T******** for: " << expected1);
+        }
     }
 }
 
@@ -10,12 +10,99 @@
 
 #include <vector>
 
+#include <boost/geometry/algorithms/distance.hpp>
 #include <boost/geometry/geometries/linestring.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/polygon.hpp>
 
 #include "test_frechet_distance.hpp"
 
+// Random walk, deterministically generated
+template <typename Linestring>
+Linestring random_walk(std::size_t count, unsigned long seed)
+{
+    typedef typename bg::point_type<Linestring>::type point_type;
+
+    Linestring result;
+    unsigned long state = seed;
+    auto const next = [&state]()
+    {
+        state = (state * 1103515245ul + 12345ul) % 2147483648ul;
+        return double(state) / 2147483648.0;
+    };
+    double x = 0, y = 0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        x += next() - 0.4;
+        y += next() - 0.5;
+        result.push_back(point_type(x, y));
+    }
+    return result;
+}
+
+// Coupling measure calculated with the full coupling matrix
+template <typename Linestring>
+double frechet_reference(Linestring const& ls1, Linestring const& ls2)
+{
+    std::size_t const a = ls1.size();
+    std::size_t const b = ls2.size();
+    std::vector<double> m(a * b);
+    for (std::size_t i = 0; i < a; i++)
+    {
+        for (std::size_t j = 0; j < b; j++)
+        {
+            double const d = bg::distance(ls1[i], ls2[j]);
+            double& c = m[i * b + j];
+            if (i == 0 && j == 0)
+                c = d;
+            else if (i == 0)
+                c = (std::max)(m[j - 1], d);
+            else if (j == 0)
+                c = (std::max)(m[(i - 1) * b], d);
+            else
+                c = (std::max)((std::min)(m[i * b + j - 1],
+                                          (std::min)(m[(i - 1) * b + j],
+                                                     m[(i - 1) * b + j - 1])),
+                               d);
+        }
+    }
+    return m[a * b - 1];
+}
+
+template <typename P>
+void test_random_walks()
+{
+    typedef bg::model::linestring<P> linestring_2d;
+
+    for (unsigned long seed = 1; seed < 6; seed++)
+    {
+        linestring_2d const ls1 = random_walk<linestring_2d>(300 + seed * 50, seed);
+        linestring_2d const ls2 = random_walk<linestring_2d>(400 - seed * 30, seed + 10);
+
+        double const expected = frechet_reference(ls1, ls2);
+        BOOST_CHECK_EQUAL(bg::discrete_frechet_distance(ls1, ls2), expected);
+        BOOST_CHECK_EQUAL(bg::discrete_frechet_distance(ls2, ls1), expected);
+
+        for (double f : {0.5, 0.99, 0.999999, 1.000001, 1.01, 2.0})
+        {
+            BOOST_CHECK_EQUAL(bg::discrete_frechet_distance_within(ls1, ls2, expected * f),
+                              f > 1);
+            BOOST_CHECK_EQUAL(bg::discrete_frechet_distance_within(ls2, ls1, expected * f),
+                              f > 1);
+        }
+    }
+
+    // long linestrings, the coupling matrix would not fit in memory
+    linestring_2d const ls1 = random_walk<linestring_2d>(100000, 21);
+    linestring_2d ls2 = ls1;
+    for (auto& p : ls2)
+    {
+        bg::set<1>(p, bg::get<1>(p) + 0.25);
+    }
+    BOOST_CHECK(bg::discrete_frechet_distance_within(ls1, ls2, 0.26));
+    BOOST_CHECK(! bg::discrete_frechet_distance_within(ls1, ls2, 0.24));
+}
+
     template <typename P>
 void test_all_cartesian()
 {
@@ -84,6 +171,7 @@ int test_main(int, char* [])
 {
     //Cartesian Coordinate System
     test_all_cartesian<bg::model::d2::point_xy<double,bg::cs::cartesian> >();
+    test_random_walks<bg::model::d2::point_xy<double,bg::cs::cartesian> >();
 
     //Geographic Coordinate System
     test_all_geographic<bg::model::d2::point_xy<double,bg::cs::geographic<bg::degree> > >();
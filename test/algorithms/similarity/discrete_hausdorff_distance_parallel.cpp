@@ -0,0 +1,149 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <cstddef>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/discrete_hausdorff_distance.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Random walk, deterministically generated
+template <typename Range>
+Range trajectory(std::size_t count, unsigned long seed, double step)
+{
+    typedef typename bg::point_type<Range>::type point_type;
+
+    Range result;
+    unsigned long state = seed;
+    auto const next = [&state]()
+    {
+        state = (state * 1103515245ul + 12345ul) % 2147483648ul;
+        return double(state) / 2147483648.0;
+    };
+    double x = 0, y = 0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        x += (next() - 0.45) * step;
+        y += (next() - 0.5) * step;
+        result.push_back(point_type(x, y));
+    }
+    return result;
+}
+
+// Directed Hausdorff distance, the maximum of the nearest distances
+template <typename Range1, typename Range2, typename Strategy>
+double brute_force(Range1 const& r1, Range2 const& r2, Strategy const& strategy)
+{
+    double result = 0;
+    for (auto const& p1 : r1)
+    {
+        double nearest = -1;
+        for (auto const& p2 : r2)
+        {
+            double const d = bg::distance(p1, p2, strategy);
+            if (nearest < 0 || d < nearest)
+            {
+                nearest = d;
+            }
+        }
+        if (result < nearest)
+        {
+            result = nearest;
+        }
+    }
+    return result;
+}
+
+template <typename Geometry1, typename Geometry2, typename Strategy>
+void test_geometry(std::string const& caseid,
+                   Geometry1 const& geometry1, Geometry2 const& geometry2,
+                   double expected, Strategy const& strategy)
+{
+    double const sequential = bg::discrete_hausdorff_distance(geometry1, geometry2,
+                                                              strategy);
+    BOOST_CHECK_MESSAGE(std::abs(sequential - expected) <= std::abs(expected) * 1e-12,
+                        caseid << " sequential: " << sequential
+                        << " expected: " << expected);
+
+    for (std::size_t threads = 0; threads <= 3; threads++)
+    {
+        double const parallel = bg::discrete_hausdorff_distance(
+            bg::parallel_execution(threads), geometry1, geometry2, strategy);
+        BOOST_CHECK_MESSAGE(parallel == sequential,
+                            caseid << " threads: " << threads
+                            << " distance: " << parallel
+                            << " expected: " << sequential);
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_point<P> multi_point;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+
+    bg::strategies::distance::cartesian<> const strategy;
+
+    linestring const ls1 = trajectory<linestring>(5000, 1, 1.0);
+    linestring const ls2 = trajectory<linestring>(4000, 2, 1.0);
+    test_geometry("random_walks", ls1, ls2, brute_force(ls1, ls2, strategy), strategy);
+    test_geometry("random_walks_rev", ls2, ls1, brute_force(ls2, ls1, strategy), strategy);
+
+    // nearly the same trajectories, most points break early
+    linestring const ls3 = trajectory<linestring>(5000, 1, 1.001);
+    test_geometry("similar", ls1, ls3, brute_force(ls1, ls3, strategy), strategy);
+
+    // small ranges are scanned without rtree
+    linestring const ls4 = trajectory<linestring>(20, 3, 1.0);
+    test_geometry("small", ls1, ls4, brute_force(ls1, ls4, strategy), strategy);
+    test_geometry("small_rev", ls4, ls1, brute_force(ls4, ls1, strategy), strategy);
+
+    multi_point const mp1 = trajectory<multi_point>(3000, 4, 10.0);
+    multi_point const mp2 = trajectory<multi_point>(3000, 5, 10.0);
+    test_geometry("multi_point", mp1, mp2, brute_force(mp1, mp2, strategy), strategy);
+
+    multi_linestring mls;
+    mls.push_back(ls2);
+    mls.push_back(ls4);
+    test_geometry("multi_linestring", ls1, mls,
+                  (std::max)(brute_force(ls1, ls2, strategy),
+                             brute_force(ls1, ls4, strategy)),
+                  strategy);
+
+    // default strategy
+    BOOST_CHECK_EQUAL(bg::discrete_hausdorff_distance(bg::parallel_execution(2), ls1, ls2),
+                      bg::discrete_hausdorff_distance(ls1, ls2));
+}
+
+void test_geographic()
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+    typedef bg::model::linestring<point_type> linestring;
+
+    bg::strategies::distance::geographic<> const strategy;
+
+    linestring const ls1 = trajectory<linestring>(1000, 6, 0.01);
+    linestring const ls2 = trajectory<linestring>(800, 7, 0.01);
+    test_geometry("geographic", ls1, ls2, brute_force(ls1, ls2, strategy), strategy);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+    test_geographic();
+
+    return 0;
+}
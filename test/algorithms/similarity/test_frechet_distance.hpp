@@ -47,6 +47,12 @@ void test_frechet_distance(Geometry1 const& geometry1,Geometry2 const& geometry2
 #endif
 
     BOOST_CHECK_CLOSE(h_distance, expected_frechet_distance, 0.001);
+
+    BOOST_CHECK(bg::discrete_frechet_distance_within(geometry1, geometry2,
+                                                     h_distance * (1 + 1e-9)));
+    BOOST_CHECK(h_distance == 0
+                || ! bg::discrete_frechet_distance_within(geometry1, geometry2,
+                                                          h_distance * (1 - 1e-6)));
 }
 
 
@@ -101,6 +107,12 @@ void test_frechet_distance(Geometry1 const& geometry1,Geometry2 const& geometry2
 #endif
 
     BOOST_CHECK_CLOSE(h_distance, expected_frechet_distance, 0.001);
+
+    BOOST_CHECK(bg::discrete_frechet_distance_within(geometry1, geometry2,
+                                                     h_distance * (1 + 1e-9), strategy));
+    BOOST_CHECK(h_distance == 0
+                || ! bg::discrete_frechet_distance_within(geometry1, geometry2,
+                                                          h_distance * (1 - 1e-6), strategy));
 }
 
 
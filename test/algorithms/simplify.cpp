@@ -16,10 +16,16 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <algorithm>
+#include <cmath>
 #include <iterator>
+#include <vector>
 
 
 #include <algorithms/test_simplify.hpp>
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
 #include <boost/geometry/geometries/geometries.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 
@@ -278,6 +284,246 @@ void test_zigzag()
 }
 
 
+// Simplifying to the number of points of the result simplified with
+// a distance gives the same result
+template <typename Geometry>
+void test_to_count(std::string const& wkt, std::string const& expected_wkt,
+                   double distance)
+{
+    Geometry geometry, expected;
+    bg::read_wkt(wkt, geometry);
+    bg::read_wkt(expected_wkt, expected);
+
+    std::size_t const count = bg::num_points(expected);
+
+    Geometry simplified;
+    bg::simplify_to_count(geometry, simplified, count);
+    test_equality<Geometry>::apply(simplified, expected);
+
+    bg::simplify_to_count(geometry, simplified, count + 1, distance);
+    test_equality<Geometry>::apply(simplified, expected);
+
+    bg::simplify_to_count(geometry, simplified, bg::num_points(geometry),
+                          distance, bg::strategies::simplify::cartesian<>());
+    test_equality<Geometry>::apply(simplified, expected);
+
+    bg::simplify_to_count(geometry, simplified, 2);
+    BOOST_CHECK_EQUAL(bg::num_points(simplified), 2u);
+}
+
+template <typename P>
+void test_count()
+{
+    typedef bg::model::linestring<P> linestring;
+
+    test_to_count<linestring>("LINESTRING(0 0,5 5,7 5,10 10)",
+                              "LINESTRING(0 0,7 5,10 10)", 1.2);
+
+    std::string const zigzag = "LINESTRING(0 10,1 7,1 9,2 6,2 7,3 4,3 5,5 3,4 5,6 2,6 3,9 1,7 3,10 1,9 2,12 1,10 2,13 1,11 2,14 1,12 2,16 1,14 2,17 3,15 3,18 4,16 4,19 5,17 5,20 6,18 6,21 8,19 7,21 9,19 8,21 10,19 9,21 11,19 10,20 13,19 11)";
+    test_to_count<linestring>(zigzag, "LINESTRING(0 10,6 2,16 1,14 2,21 8,19 7,21 9,19 8,21 10,19 9,20 13,19 11)", 1.5001);
+    test_to_count<linestring>(zigzag, "LINESTRING(0 10,6 2,16 1,14 2,21 8,19 7,20 13,19 11)", 2.0001);
+    test_to_count<linestring>(zigzag, "LINESTRING(0 10,6 2,16 1,21 8,19 11)", 2.25);
+
+    // the collinear points are removed
+    {
+        linestring geometry, simplified;
+        bg::read_wkt("LINESTRING(0 0,1 1,2 2,3 3,3 4)", geometry);
+        bg::simplify_to_count(geometry, simplified, 10);
+        BOOST_CHECK_EQUAL(bg::num_points(simplified), 3u);
+    }
+
+    // a long spiral, the spans are not processed recursively
+    {
+        linestring geometry, simplified;
+        for (int i = 0; i < 100000; i++)
+        {
+            double const angle = i * 0.01;
+            double const radius = 1.0 + i * 0.001;
+            bg::append(geometry, P(radius * std::cos(angle), radius * std::sin(angle)));
+        }
+        bg::simplify_to_count(geometry, simplified, 1000);
+        BOOST_CHECK_EQUAL(bg::num_points(simplified), 1000u);
+        bg::simplify(geometry, simplified, 0.01);
+        BOOST_CHECK_LT(bg::num_points(simplified), bg::num_points(geometry));
+    }
+
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::polygon<P> polygon;
+
+    // a ring keeps at least the four points of a closed triangle,
+    // in the same direction
+    {
+        ring geometry, simplified;
+        bg::read_wkt("POLYGON((0 0,0 5,1 9,0 10,5 11,10 10,11 5,10 0,5 -1,0 0))", geometry);
+        for (std::size_t count = 1; count <= 4; count++)
+        {
+            bg::simplify_to_count(geometry, simplified, count);
+            BOOST_CHECK_EQUAL(bg::num_points(simplified), 4u);
+            BOOST_CHECK_GT(bg::area(simplified), 0.0);
+        }
+        bg::simplify_to_count(geometry, simplified, 6);
+        BOOST_CHECK_EQUAL(bg::num_points(simplified), 6u);
+        bg::simplify_to_count(geometry, simplified, 0);
+        BOOST_CHECK_EQUAL(bg::num_points(simplified), bg::num_points(geometry));
+    }
+
+    // the interior rings are simplified to the number of points, each
+    {
+        polygon geometry, simplified;
+        bg::read_wkt("POLYGON((0 0,0 5,1 9,0 10,5 11,10 10,11 5,10 0,5 -1,0 0),"
+                     "(2 2,4 2.2,8 2,8.2 5,8 8,5 7.8,2 8,2.2 5,2 2))", geometry);
+        for (std::size_t count = 2; count <= 9; count++)
+        {
+            bg::simplify_to_count(geometry, simplified, count);
+            std::size_t const expected = (std::max)(count, std::size_t(4));
+            BOOST_CHECK_EQUAL(bg::num_points(bg::exterior_ring(simplified)), expected);
+            BOOST_CHECK_EQUAL(bg::num_interior_rings(simplified), 1u);
+            if (bg::num_interior_rings(simplified) == 1u)
+            {
+                ring const& interior = bg::interior_rings(simplified).front();
+                BOOST_CHECK_EQUAL(bg::num_points(interior), expected);
+                BOOST_CHECK_LT(bg::area(interior), 0.0);
+            }
+        }
+    }
+}
+
+
+// Removes the point with the smallest triangle, one by one
+template <typename Linestring>
+Linestring visvalingam_whyatt_reference(Linestring ls, double min_area)
+{
+    auto const triangle_area = [&](std::size_t i)
+    {
+        typedef typename bg::point_type<Linestring>::type point_type;
+        bg::model::ring<point_type, true, false> triangle;
+        bg::append(triangle, ls[i - 1]);
+        bg::append(triangle, ls[i]);
+        bg::append(triangle, ls[i + 1]);
+        return std::fabs(bg::area(triangle));
+    };
+
+    while (ls.size() > 2)
+    {
+        std::size_t smallest = 1;
+        for (std::size_t i = 2; i + 1 < ls.size(); i++)
+        {
+            if (triangle_area(i) < triangle_area(smallest))
+            {
+                smallest = i;
+            }
+        }
+        if (triangle_area(smallest) > min_area)
+        {
+            break;
+        }
+        ls.erase(ls.begin() + smallest);
+    }
+    return ls;
+}
+
+template <typename P>
+void test_visvalingam_whyatt()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+
+    {
+        linestring geometry, simplified, expected;
+        bg::read_wkt("LINESTRING(0 0,1 0.1,2 0,3 3,4 0)", geometry);
+        bg::read_wkt("LINESTRING(0 0,2 0,3 3,4 0)", expected);
+        bg::simplify_visvalingam_whyatt(geometry, simplified, 0.5);
+        test_equality<linestring>::apply(simplified, expected);
+        bg::simplify_visvalingam_whyatt(geometry, simplified, 7.0);
+        BOOST_CHECK_EQUAL(bg::num_points(simplified), 2u);
+    }
+
+    {
+        polygon geometry, simplified;
+        bg::read_wkt("POLYGON((0 0,0 10,5 10.1,10 10,10 0,5 0,0 0))", geometry);
+        bg::simplify_visvalingam_whyatt(geometry, simplified, 1.0);
+        BOOST_CHECK_EQUAL(bg::num_points(simplified), 5u);
+        BOOST_CHECK_CLOSE(bg::area(simplified), 100.0, 0.001);
+    }
+
+    // The minimal area is not compared with the perimeter, the ring is kept
+    // although its perimeter is less than 3 times the minimal area
+    {
+        polygon geometry, simplified, expected;
+        bg::read_wkt("POLYGON((2 6,7 7,10 9,10 2,9 1,2 6))", geometry);
+        bg::read_wkt("POLYGON((2 6,10 9,9 1,2 6))", expected);
+        BOOST_CHECK_LT(bg::perimeter(geometry), 3 * 29.0);
+        bg::simplify_visvalingam_whyatt(geometry, simplified, 29.0);
+        BOOST_CHECK_EQUAL(bg::num_points(simplified), 4u);
+        BOOST_CHECK_CLOSE(bg::area(simplified), bg::area(expected), 0.001);
+    }
+
+    // The same as removing the points one by one, and as thresholding
+    // the effective areas calculated once
+    {
+        linestring geometry;
+        for (int i = 0; i < 500; i++)
+        {
+            bg::append(geometry, P(i * 0.1, std::sin(i * 0.37) + std::sin(i * 0.05) * 3));
+        }
+
+        std::vector<double> areas;
+        bg::effective_areas(geometry, areas);
+        BOOST_CHECK_EQUAL(areas.size(), geometry.size());
+
+        // The same with a legacy strategy
+        std::vector<double> legacy_areas;
+        bg::effective_areas(geometry, legacy_areas,
+            bg::strategy::simplify::douglas_peucker
+                <
+                    P, bg::strategy::distance::projected_point<double>
+                >());
+        BOOST_CHECK(legacy_areas == areas);
+
+        for (double min_area : {0.0001, 0.001, 0.01, 0.1, 1.0})
+        {
+            linestring simplified, thresholded;
+            bg::simplify_visvalingam_whyatt(geometry, simplified, min_area,
+                                            bg::strategies::simplify::cartesian<>());
+            for (std::size_t i = 0; i < geometry.size(); i++)
+            {
+                if (areas[i] > min_area)
+                {
+                    bg::append(thresholded, geometry[i]);
+                }
+            }
+
+            test_equality<linestring>::apply(simplified,
+                visvalingam_whyatt_reference(geometry, min_area));
+            test_equality<linestring>::apply(simplified, thresholded);
+        }
+    }
+}
+
+template <typename P>
+void test_visvalingam_whyatt_geographic()
+{
+    typedef bg::model::linestring<P> linestring;
+
+    linestring geometry, simplified;
+    bg::read_wkt("LINESTRING(4.1 52.1,4.2 52.2001,4.3 52.3)", geometry);
+
+    bg::simplify_visvalingam_whyatt(geometry, simplified, 1.0e-6,
+                                    bg::strategies::simplify::spherical<>());
+    BOOST_CHECK_EQUAL(bg::num_points(simplified), 2u);
+    bg::simplify_visvalingam_whyatt(geometry, simplified, 1.0e-12,
+                                    bg::strategies::simplify::spherical<>());
+    BOOST_CHECK_EQUAL(bg::num_points(simplified), 3u);
+
+    // in square meters
+    bg::simplify_visvalingam_whyatt(geometry, simplified, 1.0e6,
+                                    bg::strategies::simplify::geographic<>());
+    BOOST_CHECK_EQUAL(bg::num_points(simplified), 2u);
+    bg::simplify_visvalingam_whyatt(geometry, simplified, 1.0,
+                                    bg::strategies::simplify::geographic<>());
+    BOOST_CHECK_EQUAL(bg::num_points(simplified), 3u);
+}
+
 template <typename P>
 void test_3d()
 {
@@ -316,6 +562,11 @@ int test_main(int, char* [])
 
     test_zigzag<bg::model::d2::point_xy<double> >();
 
+    test_count<bg::model::d2::point_xy<double> >();
+
+    test_visvalingam_whyatt<bg::model::d2::point_xy<double> >();
+    test_visvalingam_whyatt_geographic<bg::model::point<double, 2, bg::cs::geographic<bg::degree> > >();
+
 #endif
 
 
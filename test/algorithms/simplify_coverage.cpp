@@ -0,0 +1,183 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/simplify_coverage.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Grid of cells with noisy borders, shared by the adjacent cells
+std::string coverage_wkt(int count, int steps)
+{
+    auto const x_at = [&](int i, int j)
+    {
+        // vertical border i, point j, the corners are not moved
+        return i * 10.0 + ((i > 0 && i < count && j % steps != 0)
+                           ? std::sin(i * 7.0 + j * 1.3) * 0.3 : 0.0);
+    };
+    auto const y_at = [&](int i, int j)
+    {
+        // horizontal border j, point i
+        return j * 10.0 + ((j > 0 && j < count && i % steps != 0)
+                           ? std::sin(j * 5.0 + i * 1.7) * 0.3 : 0.0);
+    };
+
+    std::ostringstream out;
+    out.precision(17);
+    out << "MULTIPOLYGON(";
+    for (int cx = 0; cx < count; cx++)
+    {
+        for (int cy = 0; cy < count; cy++)
+        {
+            out << (cx + cy > 0 ? "," : "") << "((";
+            // clockwise: up the left border, right along the top,
+            // down the right border, left along the bottom
+            for (int k = 0; k < steps; k++)
+            {
+                int const j = cy * steps + k;
+                out << x_at(cx, j) << " " << cy * 10.0 + k * 10.0 / steps << ",";
+            }
+            for (int k = 0; k < steps; k++)
+            {
+                int const i = cx * steps + k;
+                out << cx * 10.0 + k * 10.0 / steps << " " << y_at(i, cy + 1) << ",";
+            }
+            for (int k = steps; k > 0; k--)
+            {
+                int const j = cy * steps + k;
+                out << x_at(cx + 1, j) << " " << cy * 10.0 + k * 10.0 / steps << ",";
+            }
+            for (int k = steps; k > 0; k--)
+            {
+                int const i = cx * steps + k;
+                out << cx * 10.0 + k * 10.0 / steps << " " << y_at(i, cy) << ",";
+            }
+            out << x_at(cx, cy * steps) << " " << cy * 10.0 << "))";
+        }
+    }
+    out << ")";
+    return out.str();
+}
+
+template <typename MultiPolygon>
+double overlap_area(MultiPolygon const& mp)
+{
+    double result = 0;
+    for (std::size_t i = 0; i < mp.size(); i++)
+    {
+        for (std::size_t j = i + 1; j < mp.size(); j++)
+        {
+            MultiPolygon overlap;
+            bg::intersection(mp[i], mp[j], overlap);
+            result += bg::area(overlap);
+        }
+    }
+    return result;
+}
+
+template <typename MultiPolygon>
+void test_geometry(std::string const& caseid, std::string const& wkt,
+                   double max_distance, bool simplifies = true)
+{
+    MultiPolygon geometry;
+    bg::read_wkt(wkt, geometry);
+
+    // The polygons of a coverage share their borders, so they are checked
+    // one by one, a multi polygon with touching borders is not valid
+    for (auto const& polygon : geometry)
+    {
+        BOOST_CHECK_MESSAGE(bg::is_valid(polygon), caseid << " invalid input");
+    }
+
+    MultiPolygon simplified;
+    bg::simplify_coverage(geometry, simplified, max_distance);
+
+    BOOST_CHECK_EQUAL(simplified.size(), geometry.size());
+    BOOST_CHECK_MESSAGE(bg::num_points(simplified) < bg::num_points(geometry)
+                        || ! simplifies,
+                        caseid << " not simplified: " << bg::num_points(simplified));
+
+    for (auto const& polygon : simplified)
+    {
+        std::string message;
+        BOOST_CHECK_MESSAGE(bg::is_valid(polygon, message),
+                            caseid << " invalid: " << message);
+    }
+
+    // No overlaps and no gaps between the polygons
+    BOOST_CHECK_SMALL(overlap_area(simplified), 1.0e-9);
+    MultiPolygon united;
+    for (auto const& polygon : simplified)
+    {
+        MultiPolygon u;
+        bg::union_(united, polygon, u);
+        united = u;
+    }
+    BOOST_CHECK_CLOSE(bg::area(united), bg::area(simplified), 1.0e-6);
+
+    // The concurrently simplified polygons are the same
+    for (std::size_t threads = 0; threads <= 3; threads++)
+    {
+        MultiPolygon parallel;
+        bg::simplify_coverage(bg::parallel_execution(threads), geometry, parallel,
+                              max_distance, bg::strategies::simplify::cartesian<>());
+
+        std::ostringstream out1, out2;
+        out1 << bg::wkt(simplified);
+        out2 << bg::wkt(parallel);
+        BOOST_CHECK_EQUAL(out1.str(), out2.str());
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    test_geometry<multi_polygon>("single",
+        "MULTIPOLYGON(((0 0,0 5,0 10,5 10.1,10 10,10 5,10 0,5 -0.1,0 0)))", 0.5);
+    test_geometry<multi_polygon>("two",
+        "MULTIPOLYGON(((0 0,0 10,5 10,5.1 7,4.9 5,5.1 3,5 0,0 0)),"
+        "((5 0,5.1 3,4.9 5,5.1 7,5 10,10 10,10 0,5 0)))", 0.5);
+    // island inside a hole
+    test_geometry<multi_polygon>("island",
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(3 3,6 3,6.1 4.5,6 6,3 6,3 3)),"
+        "((3 3,3 6,6 6,6.1 4.5,6 3,3 3)))", 0.5);
+    test_geometry<multi_polygon>("grid", coverage_wkt(4, 20), 0.5);
+    // borders simplified to straight lines would cross each other
+    test_geometry<multi_polygon>("narrow",
+        "MULTIPOLYGON(((0 0,0 5,0 10,5 10,6 5,5 0,0 0),(4.8 4,5.5 4,5.5 6,4.8 6,4.8 4)),"
+        "((5 0,6 5,5 10,10 10,10 0,5 0)),"
+        "((4.8 4,4.8 6,5.5 6,5.5 4,4.8 4)))", 2.0);
+    // the spike around the hole would be removed, without crossings
+    test_geometry<multi_polygon>("hole_in_spike",
+        "MULTIPOLYGON(((0 0,0 10,4 10,5 11,6 10,10 10,10 0,0 0),"
+        "(4.9 10.2,5.1 10.2,5 10.5,4.9 10.2)))", 2.0, false);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
@@ -0,0 +1,144 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/concept/assert.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/columnar_polygons.hpp>
+#include <boost/geometry/geometries/concepts/polygon_concept.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+static std::string const wkts[] =
+{
+    "POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 2),(6 6,8 6,8 8,6 6))",
+    "POLYGON((5 5,5 15,15 15,15 5,5 5))",
+    "POLYGON((20 20,20 21,21 21,21 20,20 20))"
+};
+
+template <bool ClockWise, bool Closed>
+void test_polygons()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bg::model::polygon<P, ClockWise, Closed> polygon;
+    typedef bg::model::columnar_polygons<P, ClockWise, Closed> columnar;
+    typedef typename columnar::value_type view;
+
+    BOOST_CONCEPT_ASSERT( (bg::concepts::ConstPolygon<view>) );
+
+    std::vector<polygon> polygons;
+    columnar container;
+    container.reserve(3, 5, 20);
+    for (std::string const& wkt : wkts)
+    {
+        polygons.push_back(bg::from_wkt<polygon>(wkt));
+        bg::correct(polygons.back());
+        container.push_back(polygons.back());
+    }
+
+    BOOST_CHECK_EQUAL(container.size(), 3u);
+    BOOST_CHECK_EQUAL(container.ring_offsets().size(), 6u);
+    BOOST_CHECK_EQUAL(container.polygon_offsets().back(), 5u);
+
+    std::size_t i = 0;
+    for (view const& v : container)
+    {
+        polygon const& p = polygons[i++];
+        BOOST_CHECK_EQUAL(bg::num_points(v), bg::num_points(p));
+        BOOST_CHECK_EQUAL(bg::num_interior_rings(v), bg::num_interior_rings(p));
+        BOOST_CHECK_CLOSE(bg::area(v), bg::area(p), 1e-9);
+        BOOST_CHECK_CLOSE(bg::perimeter(v), bg::perimeter(p), 1e-9);
+        BOOST_CHECK(bg::is_valid(v));
+
+        bg::model::box<P> box1, box2;
+        bg::envelope(v, box1);
+        bg::envelope(p, box2);
+        BOOST_CHECK(bg::equals(box1, box2));
+
+        P c1, c2;
+        bg::centroid(v, c1);
+        bg::centroid(p, c2);
+        BOOST_CHECK_CLOSE(bg::get<0>(c1), bg::get<0>(c2), 1e-9);
+        BOOST_CHECK_CLOSE(bg::get<1>(c1), bg::get<1>(c2), 1e-9);
+    }
+
+    // Relations between the polygons of the container
+    BOOST_CHECK(bg::intersects(container[0], container[1]));
+    BOOST_CHECK(! bg::intersects(container[0], container[2]));
+    BOOST_CHECK(bg::equals(container[1], polygons[1]));
+    BOOST_CHECK(bg::within(P(3, 5), container[0]));
+    BOOST_CHECK(! bg::within(P(3, 2.5), container[0]));
+    BOOST_CHECK_CLOSE(bg::distance(container[1], container[2]), std::sqrt(50.0), 1e-9);
+}
+
+void test_buffers()
+{
+    typedef bg::model::d2::point_xy<double> P;
+    typedef bg::model::columnar_polygons<P> columnar;
+
+    // Two triangles, the second with a hole
+    std::vector<P> points{ P(0, 0), P(0, 1), P(1, 0), P(0, 0),
+                           P(0, 0), P(0, 4), P(4, 0), P(0, 0),
+                           P(1, 1), P(2, 1), P(1, 2), P(1, 1) };
+    columnar const container(points, { 0, 4, 8, 12 }, { 0, 1, 3 });
+    BOOST_CHECK_EQUAL(container.size(), 2u);
+    BOOST_CHECK_CLOSE(bg::area(container[0]), 0.5, 1e-9);
+    BOOST_CHECK_CLOSE(bg::area(container[1]), 7.5, 1e-9);
+    BOOST_CHECK_EQUAL(boost::size(bg::interior_rings(container[1])), 1u);
+
+    // Polygons are built point by point
+    columnar built;
+    for (P const& p : points)
+    {
+        built.append_point(p);
+        if (built.points().size() % 4 == 0)
+        {
+            built.finish_ring();
+        }
+        if (built.points().size() == 4 || built.points().size() == 12)
+        {
+            built.finish_polygon();
+        }
+    }
+    BOOST_CHECK(built.ring_offsets() == container.ring_offsets());
+    BOOST_CHECK(built.polygon_offsets() == container.polygon_offsets());
+
+    built.clear();
+    BOOST_CHECK(built.empty());
+
+    BOOST_CHECK_THROW(columnar(points, { 0, 4, 8 }, { 0, 1, 3 }), bg::invalid_input_exception);
+    BOOST_CHECK_THROW(columnar(points, { 0, 8, 4, 12 }, { 0, 1, 3 }), bg::invalid_input_exception);
+    BOOST_CHECK_THROW(columnar(points, { 0, 4, 8, 12 }, { 1, 3 }), bg::invalid_input_exception);
+}
+
+int test_main(int, char* [])
+{
+    test_polygons<true, true>();
+    test_polygons<false, true>();
+    test_polygons<true, false>();
+    test_buffers();
+
+    return 0;
+}
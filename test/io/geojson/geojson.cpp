@@ -0,0 +1,254 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/geojson/geojson.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+#include <boost/variant/variant.hpp>
+
+
+template <typename Geometry>
+void test_geojson(std::string const& wkt, std::string const& json)
+{
+    Geometry const expected = bg::from_wkt<Geometry>(wkt);
+
+    BOOST_CHECK_EQUAL(bg::to_geojson(expected), json);
+
+    std::string appended = "x";
+    bg::write_geojson(expected, appended);
+    BOOST_CHECK_EQUAL(appended, "x" + json);
+
+    std::vector<char> chars;
+    bg::write_geojson(expected, std::back_inserter(chars));
+    BOOST_CHECK_EQUAL(std::string(chars.begin(), chars.end()), json);
+
+    Geometry geometry;
+    bg::read_geojson(json, geometry);
+    BOOST_CHECK_MESSAGE(bg::to_wkt(geometry) == bg::to_wkt(expected),
+                        "read " << json << " as " << bg::wkt(geometry));
+}
+
+template <typename Geometry>
+void test_read(std::string const& json, std::string const& wkt)
+{
+    Geometry const geometry = bg::from_geojson<Geometry>(json);
+    BOOST_CHECK_MESSAGE(bg::to_wkt(geometry) == wkt,
+                        "read " << json << " as " << bg::wkt(geometry)
+                        << " expected " << wkt);
+}
+
+template <typename Geometry>
+void test_invalid(std::string const& json)
+{
+    Geometry geometry;
+    BOOST_CHECK_THROW(bg::read_geojson(json, geometry), bg::read_geojson_exception);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::multi_point<P> multi_point;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    test_geojson<P>("POINT(1 2.5)", R"({"type":"Point","coordinates":[1,2.5]})");
+    test_geojson<linestring>("LINESTRING(1 2,3 4)",
+        R"({"type":"LineString","coordinates":[[1,2],[3,4]]})");
+    test_geojson<linestring>("LINESTRING()",
+        R"({"type":"LineString","coordinates":[]})");
+    test_geojson<polygon>("POLYGON((0 0,0 5,5 5,5 0,0 0),(1 1,2 1,2 2,1 1))",
+        R"({"type":"Polygon","coordinates":[[[0,0],[0,5],[5,5],[5,0],[0,0]],[[1,1],[2,1],[2,2],[1,1]]]})");
+    test_geojson<ring>("POLYGON((0 0,0 5,5 5,0 0))",
+        R"({"type":"Polygon","coordinates":[[[0,0],[0,5],[5,5],[0,0]]]})");
+    test_geojson<multi_point>("MULTIPOINT((1 2),(3 4))",
+        R"({"type":"MultiPoint","coordinates":[[1,2],[3,4]]})");
+    test_geojson<multi_linestring>("MULTILINESTRING((1 2,3 4),(5 6,7 8))",
+        R"({"type":"MultiLineString","coordinates":[[[1,2],[3,4]],[[5,6],[7,8]]]})");
+    test_geojson<multi_polygon>("MULTIPOLYGON(((0 0,0 1,1 1,0 0)),((5 5,5 6,6 6,5 5)))",
+        R"({"type":"MultiPolygon","coordinates":[[[[0,0],[0,1],[1,1],[0,0]]],[[[5,5],[5,6],[6,6],[5,5]]]]})");
+    test_geojson<bg::model::segment<P> >("SEGMENT(1 2,3 4)",
+        R"({"type":"LineString","coordinates":[[1,2],[3,4]]})");
+    test_geojson<bg::model::box<P> >("BOX(1 2,3 4)",
+        R"({"type":"Polygon","coordinates":[[[1,2],[3,2],[3,4],[1,4],[1,2]]]})");
+
+    // Open rings are closed in GeoJSON
+    typedef bg::model::polygon<P, true, false> open_polygon;
+    test_geojson<open_polygon>("POLYGON((0 0,0 5,5 5,5 0))",
+        R"({"type":"Polygon","coordinates":[[[0,0],[0,5],[5,5],[5,0],[0,0]]]})");
+
+    // Dynamic geometries and geometry collections
+    typedef boost::variant<P, linestring, polygon> variant;
+    typedef bg::model::geometry_collection<variant> collection;
+    test_geojson<variant>("LINESTRING(1 2,3 4)",
+        R"({"type":"LineString","coordinates":[[1,2],[3,4]]})");
+    test_geojson<collection>("GEOMETRYCOLLECTION(POINT(1 2),LINESTRING(1 2,3 4))",
+        R"({"type":"GeometryCollection","geometries":[{"type":"Point","coordinates":[1,2]},{"type":"LineString","coordinates":[[1,2],[3,4]]}]})");
+    test_geojson<collection>("GEOMETRYCOLLECTION()",
+        R"({"type":"GeometryCollection","geometries":[]})");
+
+    // Members in any order, whitespace, other members and features
+    test_read<P>(R"( { "coordinates" : [ 1 , -2e1 ] , "bbox":[1,2,{"a":[null,true,false,"]"]}],
+                     "type" : "Point" } )", "POINT(1 -20)");
+    test_read<P>(R"({"type":"Point","coordinates":[1,2,3]})", "POINT(1 2)");
+    test_read<P>(R"({"type":"Feature","properties":{"name":"a\"bé😀"},
+                     "geometry":{"type":"Point","coordinates":[1,2]},"id":1})", "POINT(1 2)");
+    test_read<polygon>(R"({"type":"Polygon","coordinates":[[[0,0],[0,1],[1,1],[0,0]]],"crs":null})",
+                       "POLYGON((0 0,0 1,1 1,0 0))");
+    test_read<variant>(R"({"type":"Polygon","coordinates":[[[0,0],[0,1],[1,1],[0,0]]]})",
+                       "POLYGON((0 0,0 1,1 1,0 0))");
+
+    // 3D points
+    typedef bg::model::point<double, 3, bg::cs::cartesian> point_3d;
+    BOOST_CHECK_EQUAL(bg::to_geojson(point_3d(1, 2, 3)),
+                      R"({"type":"Point","coordinates":[1,2,3]})");
+    test_read<point_3d>(R"({"type":"Point","coordinates":[1,2]})", "POINT(1 2 0)");
+
+    // Precision
+    BOOST_CHECK_EQUAL(bg::to_geojson(P(1.0 / 3.0, 2), 3),
+                      R"({"type":"Point","coordinates":[0.333,2]})");
+
+    test_invalid<P>("");
+    test_invalid<P>("[]");
+    test_invalid<P>(R"({"type":"Point"})");
+    test_invalid<P>(R"({"type":"Point","coordinates":[1]})");
+    test_invalid<P>(R"({"type":"Point","coordinates":[[1,2]]})");
+    test_invalid<P>(R"({"type":"Point","coordinates":[1,2]} x)");
+    test_invalid<P>(R"({"type":"Point","coordinates":[1,x]})");
+    test_invalid<P>(R"({"type":"Circle","coordinates":[1,2]})");
+    test_invalid<P>(R"({"type":"LineString","coordinates":[[1,2],[3,4]]})");
+    test_invalid<P>(R"({"type":"Feature","geometry":null,"properties":null})");
+    test_invalid<linestring>(R"({"type":"LineString","coordinates":[[1,2],3]})");
+    test_invalid<polygon>(R"({"type":"Polygon","coordinates":[[[[0,0]]]]]})");
+    test_invalid<polygon>(R"({"type":"Polygon","coordinates":[[[0,0],[1,1]]})");
+    test_invalid<ring>(R"({"type":"Polygon","coordinates":[]})");
+    test_invalid<variant>(R"({"type":"MultiPoint","coordinates":[]})");
+    test_invalid<P>(R"({"type":"Point","coordinates":[1,2],"x":"\q"})");
+    test_invalid<P>(R"({"type":"Point","coordinates":[1,2],"x":[1,}})");
+}
+
+void test_int()
+{
+    typedef bg::model::d2::point_xy<int> point;
+    test_geojson<point>("POINT(1 -2)", R"({"type":"Point","coordinates":[1,-2]})");
+    test_geojson<bg::model::linestring<point> >("LINESTRING(1 2,3 4)",
+        R"({"type":"LineString","coordinates":[[1,2],[3,4]]})");
+}
+
+template <typename P>
+void test_stream()
+{
+    typedef bg::model::polygon<P> polygon;
+
+    std::ostringstream out;
+    {
+        bg::geojson_writer writer(out);
+        for (int i = 0; i < 1000; i++)
+        {
+            polygon poly;
+            bg::append(poly, P(i, 0));
+            bg::append(poly, P(i, 1));
+            bg::append(poly, P(i + 1, 1));
+            bg::append(poly, P(i, 0));
+            writer.write(poly, i % 2 == 0 ? "null" : R"({"index":)" + std::to_string(i) + "}");
+            if (i % 10 == 0)
+            {
+                // Features without geometry are skipped by the reader
+                out << R"(,{"type":"Feature","geometry":null,"properties":null})";
+            }
+        }
+        BOOST_CHECK_EQUAL(writer.count(), 1000u);
+    }
+
+    std::string const json = out.str();
+    BOOST_CHECK_EQUAL(json.substr(0, 40), R"({"type":"FeatureCollection","features":[)");
+    BOOST_CHECK_EQUAL(json.substr(json.size() - 2), "]}");
+
+    // Members before and after the features
+    std::istringstream in(R"({"type":"FeatureCollection","bbox":[0,0,1001,1],)"
+                          + json.substr(28, json.size() - 29)
+                          + R"(,"name":{"features":[]}})");
+    bg::geojson_reader<polygon> reader(in);
+    polygon poly;
+    int count = 0;
+    while (reader.next(poly))
+    {
+        BOOST_CHECK_CLOSE(bg::get<0>(poly.outer().front()), double(count), 0.0001);
+        count++;
+    }
+    BOOST_CHECK_EQUAL(count, 1000);
+    BOOST_CHECK(! reader.next(poly));
+
+    {
+        std::istringstream empty(R"({"type":"FeatureCollection","features":[]})");
+        bg::geojson_reader<P> empty_reader(empty);
+        P p;
+        BOOST_CHECK(! empty_reader.next(p));
+    }
+    {
+        std::istringstream invalid(R"({"type":"FeatureCollection","features":[{"type":"Feature"})");
+        bg::geojson_reader<P> invalid_reader(invalid);
+        P p;
+        BOOST_CHECK_THROW(invalid_reader.next(p), bg::read_geojson_exception);
+    }
+}
+
+// NaN and infinity can't be written in JSON
+template <typename P>
+void test_non_finite()
+{
+    typedef bg::model::linestring<P> linestring;
+
+    double const nan = std::numeric_limits<double>::quiet_NaN();
+    double const inf = std::numeric_limits<double>::infinity();
+
+    BOOST_CHECK_THROW(bg::to_geojson(P(nan, 1)), bg::invalid_input_exception);
+    BOOST_CHECK_THROW(bg::to_geojson(P(1, -inf)), bg::invalid_input_exception);
+    BOOST_CHECK_THROW(bg::to_geojson(linestring{P(0, 0), P(inf, 1)}),
+                      bg::invalid_input_exception);
+    BOOST_CHECK_THROW(bg::to_geojson(bg::model::box<P>(P(0, 0), P(1, nan))),
+                      bg::invalid_input_exception);
+    BOOST_CHECK_THROW(bg::to_geojson(bg::model::segment<P>(P(0, 0), P(nan, 1))),
+                      bg::invalid_input_exception);
+
+    // The feature is not written, nor is a feature written after closing
+    std::ostringstream out;
+    {
+        bg::geojson_writer writer(out);
+        BOOST_CHECK_THROW(writer.write(P(nan, 1)), bg::invalid_input_exception);
+        writer.write(P(1, 2));
+        BOOST_CHECK_EQUAL(writer.count(), 1u);
+        writer.close();
+        BOOST_CHECK_THROW(writer.write(P(3, 4)), bg::invalid_output_exception);
+        BOOST_CHECK_EQUAL(writer.count(), 1u);
+    }
+    BOOST_CHECK_EQUAL(out.str(), R"({"type":"FeatureCollection","features":[)"
+        R"({"type":"Feature","geometry":{"type":"Point","coordinates":[1,2]},"properties":null}]})");
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+    test_int();
+    test_stream<bg::model::point<double, 2, bg::cs::cartesian> >();
+    test_non_finite<bg::model::point<double, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
@@ -0,0 +1,218 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/variant/variant.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/io/svg/svg_mapper.hpp>
+#include <boost/geometry/io/svg/svg_stream_mapper.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+inline std::size_t count_of(std::string const& svg, std::string const& str)
+{
+    std::size_t result = 0;
+    for (std::size_t pos = svg.find(str); pos != std::string::npos;
+         pos = svg.find(str, pos + 1))
+    {
+        ++result;
+    }
+    return result;
+}
+
+// Without tolerance, the output is the output of svg_mapper
+template <typename P, typename Geometry>
+void test_same(std::string const& wkt)
+{
+    Geometry const geometry = bg::from_wkt<Geometry>(wkt);
+    bg::model::box<P> const viewport(P(0, 0), P(100, 100));
+
+    std::ostringstream expected;
+    {
+        bg::svg_mapper<P> mapper(expected, 200, 200);
+        mapper.add(viewport);
+        mapper.map(geometry, "fill:red", 3);
+    }
+
+    std::ostringstream out;
+    {
+        bg::svg_stream_mapper<P> mapper(out, viewport, 200, 200, 0.0);
+        BOOST_CHECK(mapper.map(geometry, "fill:red", 3));
+    }
+
+    BOOST_CHECK_EQUAL(out.str(), expected.str());
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::box<P> box;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+
+    test_same<P, P>("POINT(10 20)");
+    test_same<P, box>("BOX(10 10,20 30)");
+    test_same<P, bg::model::segment<P> >("SEGMENT(10 10,20 30)");
+    test_same<P, linestring>("LINESTRING(0 0,50 50,50 100)");
+    test_same<P, bg::model::ring<P> >("POLYGON((0 0,0 50,50 50,50 0,0 0))");
+    test_same<P, polygon>("POLYGON((0 0,0 50,50 50,50 0,0 0),(10 10,20 10,20 20,10 10))");
+    test_same<P, bg::model::multi_point<P> >("MULTIPOINT((1 2),(3 4))");
+    test_same<P, bg::model::multi_linestring<linestring> >(
+        "MULTILINESTRING((1 2,3 4),(5 6,7 8))");
+    test_same<P, bg::model::multi_polygon<polygon> >(
+        "MULTIPOLYGON(((0 0,0 5,5 5,5 0,0 0)),((6 6,6 7,7 7,6 6)))");
+
+    box const viewport(P(0, 0), P(100, 100));
+
+    // Culling
+    {
+        std::ostringstream out;
+        {
+            bg::svg_stream_mapper<P> mapper(out, viewport, 100, 100);
+            BOOST_CHECK(! mapper.map(P(200, 200), "fill:red"));
+            BOOST_CHECK(mapper.map(P(101, 50), "fill:red"));
+            BOOST_CHECK(! mapper.map(P(110, 50), "fill:red"));
+            BOOST_CHECK(! mapper.map(bg::from_wkt<linestring>("LINESTRING(150 0,150 100)"), "s"));
+            BOOST_CHECK(mapper.map(bg::from_wkt<linestring>("LINESTRING(-50 50,150 50)"), "s"));
+            BOOST_CHECK(! mapper.map(bg::from_wkt<polygon>("POLYGON((200 0,200 1,201 1,200 0))"), "s"));
+            BOOST_CHECK(! mapper.map(linestring(), "s"));
+
+            bg::model::multi_point<P> const mp
+                = bg::from_wkt<bg::model::multi_point<P> >("MULTIPOINT((50 50),(500 500))");
+            BOOST_CHECK(mapper.map(mp, "fill:blue"));
+
+            typedef boost::variant<P, linestring> variant;
+            BOOST_CHECK(! mapper.map(variant(P(500, 500)), "fill:blue"));
+            BOOST_CHECK(mapper.map(variant(P(5, 5)), "fill:blue"));
+        }
+        std::string const svg = out.str();
+        BOOST_CHECK_EQUAL(count_of(svg, "<circle"), 3u);
+        BOOST_CHECK_EQUAL(count_of(svg, "<polyline"), 1u);
+        BOOST_CHECK_EQUAL(count_of(svg, "<path"), 0u);
+        BOOST_CHECK_EQUAL(count_of(svg, "</svg>"), 1u);
+    }
+
+    // Vertices closer than one pixel are skipped, the last one is kept
+    {
+        linestring ls;
+        for (int i = 0; i <= 1000; i++)
+        {
+            ls.push_back(P(i / 10.0, 50));
+        }
+
+        std::ostringstream out;
+        {
+            bg::svg_stream_mapper<P> mapper(out, viewport, 100, 100, 1.0);
+            mapper.map(ls, "s");
+        }
+        std::string const svg = out.str();
+        BOOST_CHECK_EQUAL(count_of(svg, ","), 101u);
+        BOOST_CHECK_EQUAL(count_of(svg, "points=\"0,50 1,50 "), 1u);
+        BOOST_CHECK_EQUAL(count_of(svg, " 100,50\""), 1u);
+    }
+
+    // Interior rings collapsing to a point are removed
+    {
+        std::ostringstream out;
+        {
+            bg::svg_stream_mapper<P> mapper(out, viewport, 100, 100, 1.0);
+            mapper.map(bg::from_wkt<polygon>(
+                "POLYGON((0 0,0 50,50 50,50 0,0 0),(10 10,10.1 10,10.1 10.1,10 10))"), "s");
+        }
+        BOOST_CHECK_EQUAL(count_of(out.str(), "M "), 1u);
+    }
+
+    // Coordinates are written with a resolution of 1/100 pixel
+    {
+        std::ostringstream out;
+        {
+            bg::svg_stream_mapper<P> mapper(out, viewport, 100, 100);
+            mapper.map(P(1.23456, 2.0), "s");
+        }
+        BOOST_CHECK_EQUAL(count_of(out.str(), "cx=\"1.23\" cy=\"98\""), 1u);
+    }
+
+    // Many geometries, culled by an rtree and written in blocks
+    {
+        typedef std::pair<box, std::size_t> value;
+        std::vector<box> boxes;
+        for (int i = 0; i < 100; i++)
+        {
+            for (int j = 0; j < 100; j++)
+            {
+                boxes.push_back(box(P(i * 10, j * 10), P(i * 10 + 5, j * 10 + 5)));
+            }
+        }
+
+        bg::index::rtree<value, bg::index::quadratic<16> > rtree;
+        for (std::size_t i = 0; i < boxes.size(); i++)
+        {
+            rtree.insert(value(boxes[i], i));
+        }
+
+        std::ostringstream out;
+        {
+            bg::svg_stream_mapper<P> mapper(out, viewport, 100, 100);
+            std::vector<value> result;
+            rtree.query(bg::index::intersects(mapper.viewport()), std::back_inserter(result));
+            for (std::size_t i = 0; i < result.size(); i++)
+            {
+                BOOST_CHECK(mapper.map(boxes[result[i].second], "fill:green"));
+            }
+            for (std::size_t i = 0; i < boxes.size(); i++)
+            {
+                mapper.map(boxes[i], "fill:green");
+            }
+        }
+        // 11 x 11 boxes, the ones at 100 touch the viewport
+        BOOST_CHECK_EQUAL(count_of(out.str(), "<rect"), 2u * 121u);
+    }
+
+    // Output larger than the buffer is written to the stream in blocks
+    {
+        std::size_t const count = 2 * bg::detail::svg::stream_buffer_size / 50;
+
+        std::ostringstream out;
+        {
+            bg::svg_stream_mapper<P> mapper(out, viewport, 100, 100);
+            for (std::size_t i = 0; i < count; i++)
+            {
+                mapper.map(P(i % 100, i % 97), "fill:red");
+            }
+            BOOST_CHECK_GE(out.str().size(), bg::detail::svg::stream_buffer_size);
+            BOOST_CHECK_EQUAL(count_of(out.str(), "</svg>"), 0u);
+        }
+
+        std::string const svg = out.str();
+        BOOST_CHECK_EQUAL(count_of(svg, "<?xml"), 1u);
+        BOOST_CHECK_EQUAL(count_of(svg, "<svg "), 1u);
+        BOOST_CHECK_EQUAL(count_of(svg, "<circle"), count);
+        BOOST_CHECK_EQUAL(count_of(svg, "</svg>"), 1u);
+        BOOST_CHECK_EQUAL(svg.substr(svg.size() - 7), "</svg>\n");
+    }
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
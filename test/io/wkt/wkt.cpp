@@ -17,9 +17,11 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <iterator>
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include <boost/algorithm/string.hpp>
 
@@ -28,6 +30,7 @@
 #include <boost/geometry/geometries/geometries.hpp>
 
 #include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
 #include <boost/geometry/algorithms/make.hpp>
 #include <boost/geometry/algorithms/length.hpp>
 #include <boost/geometry/algorithms/num_points.hpp>
@@ -46,6 +49,16 @@ void check_wkt(G const& geometry, std::string const& expected)
     out << bg::wkt(geometry);
     BOOST_CHECK_EQUAL(boost::to_upper_copy(out.str()),
                       boost::to_upper_copy(expected));
+
+    std::string buffer = "WKT:";
+    bg::write_wkt(geometry, buffer);
+    BOOST_CHECK_EQUAL(boost::to_upper_copy(buffer),
+                      "WKT:" + boost::to_upper_copy(expected));
+
+    std::vector<char> chars;
+    bg::write_wkt(geometry, std::back_inserter(chars));
+    BOOST_CHECK_EQUAL(boost::to_upper_copy(std::string(chars.begin(), chars.end())),
+                      boost::to_upper_copy(expected));
 }
 
 template <typename G>
@@ -260,6 +273,66 @@ void test_wkt_output_iterator(std::string const& wkt)
     bg::read_wkt<G>(wkt, std::back_inserter(geometry));
 }
 
+void test_char_range()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+
+    // WKT in a larger buffer, the characters after the range are not read
+    std::string const buffer = "POLYGON((0 0,0 4,4 4,4 0,0 0),(1 1,1 2,2 2,2 1,1 1))POINT(5 6)";
+    std::size_t const n = buffer.find("POINT");
+
+    polygon_type poly;
+    bg::read_wkt(buffer.data(), buffer.data() + n, poly);
+    check_wkt(poly, buffer.substr(0, n));
+
+    point_type p;
+    bg::read_wkt(buffer.data() + n, buffer.data() + buffer.size(), p);
+    check_wkt(p, "POINT(5 6)");
+
+    bg::read_wkt(std::string("POINT(+1.5 -2e3)"), p);
+    BOOST_CHECK_EQUAL(bg::get<0>(p), 1.5);
+    BOOST_CHECK_EQUAL(bg::get<1>(p), -2000.0);
+    bg::read_wkt(std::string("POINT(.25 1E-2)"), p);
+    BOOST_CHECK_EQUAL(bg::get<0>(p), 0.25);
+    BOOST_CHECK_EQUAL(bg::get<1>(p), 0.01);
+
+    // Errors are reported with the characters of the range
+    std::string message;
+    try
+    {
+        bg::read_wkt(buffer.data() + n, buffer.data() + buffer.size() - 1, p);
+    }
+    catch (bg::read_wkt_exception const& e)
+    {
+        message = e.what();
+    }
+    BOOST_CHECK_EQUAL(message, "Expected ')' in 'POINT(5 6'");
+
+    test_wrong_wkt<point_type>("POINT(1x 2)", "bad lexical cast");
+    test_wrong_wkt<point_type>("POINT(1 -)", "bad lexical cast");
+    test_wrong_wkt<bg::model::point<int, 2, bg::cs::cartesian> >("POINT(1.5 2)", "bad lexical cast");
+
+    // Large coordinate sequences
+    bg::model::linestring<point_type> ls, expected;
+    std::ostringstream out;
+    out << "LINESTRING(";
+    for (int i = 0; i < 10000; i++)
+    {
+        out << (i > 0 ? "," : "") << i << ".5 " << -i;
+        expected.push_back(point_type(i + 0.5, -i));
+    }
+    out << ")";
+    bg::read_wkt(out.str(), ls);
+    BOOST_CHECK(bg::equals(ls, expected));
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+    std::string_view const view(buffer.data(), n);
+    bg::read_wkt(view, poly);
+    check_wkt(poly, buffer.substr(0, n));
+#endif
+}
+
 void test_precise_to_wkt()
 {
     typedef boost::geometry::model::d2::point_xy<double> point_type;
@@ -274,6 +347,44 @@ void test_precise_to_wkt()
     check_precise_to_wkt(polygon,"POLYGON((0 0,0 4,4 4,4 0,0 0))",3);
 }
 
+void test_write_wkt()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+    typedef bg::model::point<float, 2, bg::cs::cartesian> fpoint_type;
+
+    // Shortest representation reading back the same value
+    point_type const p(0.1, 1.0 / 3.0);
+    std::string str;
+    bg::write_wkt(p, str);
+    BOOST_CHECK_EQUAL(str, "POINT(0.1 0.3333333333333333)");
+
+    point_type q;
+    bg::read_wkt(str, q);
+    BOOST_CHECK_EQUAL(bg::get<0>(q), bg::get<0>(p));
+    BOOST_CHECK_EQUAL(bg::get<1>(q), bg::get<1>(p));
+
+    str.clear();
+    bg::write_wkt(point_type(1e21, -2.5e-8), str);
+    BOOST_CHECK_EQUAL(str, "POINT(1e+21 -2.5e-08)");
+
+    str.clear();
+    bg::write_wkt(fpoint_type(0.1f, 1.0f / 3.0f), str);
+    BOOST_CHECK_EQUAL(str, "POINT(0.1 0.33333334)");
+
+    // Significant digits as in to_wkt
+    bg::model::linestring<point_type> ls;
+    bg::read_wkt("LINESTRING(1.2345 6.789,0.00001 123456)", ls);
+    str.clear();
+    bg::write_wkt(ls, str, 3);
+    BOOST_CHECK_EQUAL(str, bg::to_wkt(ls, 3));
+    BOOST_CHECK_EQUAL(str, "LINESTRING(1.23 6.79,1e-05 1.23e+05)");
+
+    // The output iterator past the written characters is returned
+    char buffer[32];
+    char* end = bg::write_wkt(bg::model::point<int, 2, bg::cs::cartesian>(-12, 345), buffer);
+    BOOST_CHECK_EQUAL(std::string(buffer, end), "POINT(-12 345)");
+}
+
 #ifndef GEOMETRY_TEST_MULTI
 template <typename T>
 void test_order_closure()
@@ -391,6 +502,8 @@ int test_main(int, char* [])
     test_all<double>();
     test_all<int>();
     test_precise_to_wkt();
+    test_char_range();
+    test_write_wkt();
 
 #if defined(HAVE_TTMATH)
     test_all<ttmath_big>();